@@ -31,6 +31,8 @@
 #include "Lib/BaseType.h"
 #include "Common/AsciiString.h"
 #include "Common/ArchiveFileSystem.h"
+#include "Common/FileMapping.h"
+#include "Common/GameDefines.h"
 
 class File;
 
@@ -67,6 +69,9 @@ public:
 protected:
 	const ArchivedFileInfo *		getArchivedFileInfo(const AsciiString& filename) const;	///< return the ArchivedFileInfo from the directory tree.
 
+	enum { MIN_MAPPED_FILE_SIZE = 64 * 1024 }; ///< smaller files are copied, because a view costs a system call and at least one page
+
 	File *m_file; ///< file pointer to the archive file on disk.  Kept open so we don't have to continuously open and close the file all the time.
+	FileMapping m_mapping; ///< the archive file on disk mapped into memory, if USE_MAPPED_ARCHIVE_FILES is enabled and the mapping succeeded.
 	DetailedArchivedDirectoryInfo m_rootDirectory;
 };
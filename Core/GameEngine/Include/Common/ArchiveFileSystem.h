@@ -164,11 +164,37 @@ protected:
 	};
 
 	ArchivedDirectoryInfoResult getArchivedDirectoryInfo(const Char* directory);
+	ArchivedDirectoryInfoResult getArchivedFileDirectoryInfo(const Char* filename) const;	///< same as getArchivedDirectoryInfo for file paths, but uses the file index
 
 	virtual void loadIntoDirectoryTree(ArchiveFile *archiveFile, Bool overwrite = FALSE);	///< load the archive file's header information and apply it to the global archive directory tree.
 
 	ArchiveFileMap m_archiveFileMap;
 	ArchivedDirectoryInfo m_rootDirectory;
+
+private:
+	// TheSuperHackers @performance The file index finds the directory of an archived file with one hash
+	// lookup instead of walking the directory tree token by token. It is an open addressed hash table
+	// keyed on the normalized path, such as "data\ini\object\airforcegeneral.ini". Each entry refers
+	// to the files of the directory tree, which keep the order of the archives that contain the file.
+	struct ArchivedFileIndexEntry
+	{
+		ArchivedFileIndexEntry() : hash(0), dirInfo(nullptr) {}
+
+		UnsignedInt hash;
+		AsciiString path;
+		ArchivedDirectoryInfo *dirInfo; ///< null for an empty slot
+		AsciiString fileName;
+	};
+	typedef std::vector<ArchivedFileIndexEntry> ArchivedFileIndex;
+
+	static UnsignedInt hashArchivedPath(const Char *path, Int length);
+	static Int normalizeArchivedPath(const Char *filename, Char *buffer, Int bufferSize); ///< returns the length, or -1 if the path has no file name or does not fit
+
+	void addToFileIndex(ArchivedDirectoryInfo *dirInfo, const AsciiString& fileName);
+	void growFileIndex();
+
+	ArchivedFileIndex m_fileIndex;
+	Int m_fileIndexCount;
 };
 
 
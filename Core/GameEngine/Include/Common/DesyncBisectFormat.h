@@ -0,0 +1,104 @@
+/*
+**	Command & Conquer Generals Zero Hour(tm)
+**	Copyright 2026 TheSuperHackers
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// FILE: DesyncBisectFormat.h /////////////////////////////////////////////////////////////////////
+// Desc:   File format of the per object CRC files written by -desyncBisect and compared by the
+//         desyncdiff tool. Shared by both, so it only depends on the base types.
+//
+// The file starts with a FileHeader, followed by records. Every record starts with a RecordHeader
+// that holds the size of the data that follows, so readers can skip records they do not need.
+//
+// RECORD_STRING   The characters of a name, without terminator. Strings are numbered in the
+//                 order they appear in the file, starting at 0.
+// RECORD_FRAME    A FrameHeader, followed by objectCount objects. Each object is an ObjectHeader
+//                 followed by entryCount Entry. Only objects with at least one changed entry
+//                 since the previous frame record are written, always with all their entries.
+//                 Objects that no longer exist are written with entryCount OBJECT_REMOVED.
+//                 The state at any frame is therefore the sum of all frame records up to it.
+// RECORD_INDEX    An IndexEntry for every frame record. Written last, followed by an IndexTrailer
+//                 at the very end of the file. Missing if the game did not end normally.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "Lib/BaseTypeCore.h"
+
+namespace DesyncBisect
+{
+
+enum
+{
+	FILE_MAGIC = 0x42535344, // "DSSB"
+	FILE_VERSION = 1,
+	GLOBAL_OBJECT_ID = 0, // pseudo object for the CRCs that do not belong to an object
+	OBJECT_REMOVED = 0xFFFFFFFF,
+};
+
+enum RecordType
+{
+	RECORD_STRING = 1,
+	RECORD_FRAME = 2,
+	RECORD_INDEX = 3,
+};
+
+struct FileHeader
+{
+	UnsignedInt magic;
+	UnsignedInt version;
+};
+
+struct RecordHeader
+{
+	UnsignedInt type;
+	UnsignedInt size; ///< bytes of record data after this header
+};
+
+struct FrameHeader
+{
+	UnsignedInt frame;
+	UnsignedInt logicCRC; ///< the CRC that is compared between peers and with replays
+	UnsignedInt objectCount;
+};
+
+struct ObjectHeader
+{
+	UnsignedInt objectID;
+	UnsignedInt templateName; ///< string number
+	UnsignedInt entryCount;
+};
+
+struct Entry
+{
+	UnsignedInt name; ///< string number
+	UnsignedInt crc;
+};
+
+struct IndexEntry
+{
+	UnsignedInt frame;
+	UnsignedInt logicCRC;
+	UnsignedInt offset; ///< file offset of the record header of the frame record
+};
+
+struct IndexTrailer
+{
+	UnsignedInt indexOffset; ///< file offset of the record header of the index record
+	UnsignedInt magic;
+};
+
+} // namespace DesyncBisect
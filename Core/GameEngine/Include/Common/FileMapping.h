@@ -0,0 +1,69 @@
+/*
+**	Command & Conquer Generals Zero Hour(tm)
+**	Copyright 2026 TheSuperHackers
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// FILE: FileMapping.h ////////////////////////////////////////////////////////////////////////////
+// Desc:   Read only memory mapping of a file on disk, for handing out parts of a file without
+//         copying them.
+//
+// Each view maps only the pages around the requested bytes, because the BIG files together are
+// larger than the address space of the game. A view stays valid after the mapping is closed, and
+// must be unmapped by its owner.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "Lib/BaseType.h"
+
+//-------------------------------------------------------------------------------------------------
+class FileMapping
+{
+public:
+
+	struct View
+	{
+		View() : data(nullptr), base(nullptr), length(0) {}
+
+		const Char *data;		///< the requested bytes
+		void *base;					///< start of the mapped pages
+		size_t length;			///< length of the mapped pages
+	};
+
+	FileMapping();
+	~FileMapping();
+
+	Bool open( const Char *filename );
+	void close();
+	Bool isOpen() const;
+
+	Bool mapView( View &view, UnsignedInt offset, UnsignedInt size ) const;	///< map the bytes at offset, fails if they are not in the file
+	static void unmapView( View &view );
+
+private:
+
+	FileMapping( const FileMapping& );
+	FileMapping& operator=( const FileMapping& );
+
+	static UnsignedInt getGranularity();
+
+#ifdef _WIN32
+	void *m_mappingHandle;
+#else
+	int m_fileDescriptor;
+#endif
+	UnsignedInt m_fileSize;
+};
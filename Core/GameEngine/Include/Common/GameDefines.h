@@ -45,6 +45,33 @@
 #define RETAIL_COMPATIBLE_PATHFINDING_ALLOCATION (0)
 #endif
 
+// Use an indexed binary heap for the pathfinder open list instead of the sorted linked list.
+// Ties in total cost are broken by insertion order, so the expansion order matches the sorted list exactly.
+// Only available when RETAIL_COMPATIBLE_PATHFINDING is disabled.
+#ifndef USE_PATHFIND_OPEN_LIST_HEAP
+#define USE_PATHFIND_OPEN_LIST_HEAP (1)
+#endif
+
+// Let objects cache their contribution to the logic CRC and only serialize it again after they were marked dirty.
+// This changes the value of the CRC, so all peers and replays must be built with the same setting.
+// Only available when RETAIL_COMPATIBLE_CRC is disabled.
+#ifndef ENABLE_INCREMENTAL_CRC
+#define ENABLE_INCREMENTAL_CRC (0)
+#endif
+
+// Recompute every cached object CRC when it is used and assert that it still matches.
+// Catches state changes that are missing a dirty mark. Slower than the full CRC, so keep it for debugging.
+#ifndef VALIDATE_INCREMENTAL_CRC
+#define VALIDATE_INCREMENTAL_CRC (0)
+#endif
+
+// Limit how many idle units may scan for a target in one frame, see AI::requestTargetScan.
+// This changes when units acquire their targets, so all peers and replays must be built with the same setting.
+// Only available when RETAIL_COMPATIBLE_CRC is disabled.
+#ifndef ENABLE_TARGET_SCAN_BUDGET
+#define ENABLE_TARGET_SCAN_BUDGET (0)
+#endif
+
 // Disable non retail fixes in the networking, such as putting more data per UDP packet
 #ifndef RETAIL_COMPATIBLE_NETWORKING
 #define RETAIL_COMPATIBLE_NETWORKING (0)
@@ -81,12 +108,24 @@
 #define ENABLE_FILESYSTEM_EXISTENCE_CACHE (1)
 #endif
 
+// Map the BIG files into memory and let large read only files point into them instead of copying them.
+// Falls back to copying when the mapping fails, such as for a BIG file on a device that cannot be mapped.
+#ifndef USE_MAPPED_ARCHIVE_FILES
+#define USE_MAPPED_ARCHIVE_FILES (1)
+#endif
+
 // Enable prioritization of textures by size. This will improve the texture quality of 481 textures in Zero Hour
 // by using the larger resolution textures from Generals. Content wise these textures are identical.
 #ifndef PRIORITIZE_TEXTURES_BY_SIZE
 #define PRIORITIZE_TEXTURES_BY_SIZE (1)
 #endif
 
+// Compile in the PerfTrace timeline of the USE_PERF_TIMER scopes and the GameLogic update phases.
+// Recording starts with -perfTrace <file>. Costs a branch per scope when not recording.
+#ifndef ENABLE_PERF_TRACE
+#define ENABLE_PERF_TRACE (0)
+#endif
+
 // Enable obsolete code. This mainly refers to code that existed in Generals but was removed in GeneralsMD.
 // Disable and remove this when Generals and GeneralsMD are merged.
 #if RTS_GENERALS
@@ -59,6 +59,13 @@
 	#define MEMORYPOOL_DEBUG
 #endif
 
+// TheSuperHackers @performance Keep a small magazine of free blocks per registered thread in front of every pool,
+// so that most allocations and frees do not take the lock. Not with MEMORYPOOL_DEBUG, which keeps
+// books on every single block for the checkpoint and leak reports.
+#if !defined(MEMORYPOOL_DEBUG) && !defined(DISABLE_MEMORYPOOL_MAGAZINES)
+	#define MEMORYPOOL_MAGAZINES
+#endif
+
 // SYSTEM INCLUDES ////////////////////////////////////////////////////////////
 
 #include <new.h>
@@ -223,6 +230,9 @@ class MemoryPool;
 class MemoryPoolFactory;
 class DynamicMemoryAllocator;
 class BlockCheckpointInfo;
+#ifdef MEMORYPOOL_MAGAZINES
+struct MemoryPoolMagazine;
+#endif
 
 // TYPE DEFINES ///////////////////////////////////////////////////////////////
 
@@ -306,6 +316,9 @@ private:
 	MemoryPoolBlob		*m_firstBlob;								///< head of linked list: first blob for this pool.
 	MemoryPoolBlob		*m_lastBlob;								///< tail of linked list: last blob for this pool. (needed for efficiency)
 	MemoryPoolBlob		*m_firstBlobWithFreeBlocks;	///< first blob in this pool that has at least one unallocated block.
+#ifdef MEMORYPOOL_MAGAZINES
+	Int								m_magazineIndex;						///< slot of this pool in the magazine table of every thread, or -1 if it has no magazines
+#endif
 
 private:
 	/// create a new blob with the given number of blocks.
@@ -314,12 +327,29 @@ private:
 	/// destroy a blob.
 	Int freeBlob(MemoryPoolBlob *blob);
 
+	/// allocate a block from the blobs. the caller must hold TheMemoryPoolCriticalSection.
+	void *allocateBlockFromBlobs(DECLARE_LITERALSTRING_ARG1);
+
+	/// return a block to its blob. the caller must hold TheMemoryPoolCriticalSection.
+	void freeBlockToBlob(void *pBlockPtr);
+
+#ifdef MEMORYPOOL_MAGAZINES
+	MemoryPoolMagazine *getMagazine();						///< the magazine of the calling thread, or null if this pool has none
+	void refillMagazine(MemoryPoolMagazine *magazine DECLARE_LITERALSTRING_ARG2);
+	void flushMagazine(MemoryPoolMagazine *magazine, Int count);
+	void discardMagazines();											///< forget the blocks in the magazines of all threads, for when the blobs go away
+#endif
+
 public:
 
 	// 'public' funcs that are really only for use by MemoryPoolFactory
 	MemoryPool *getNextPoolInList();					///< return next pool in linked list
 	void addToList(MemoryPool **pHead);				///< add this pool to head of the linked list
 	void removeFromList(MemoryPool **pHead);	///< remove this pool from the linked list
+	#ifdef MEMORYPOOL_MAGAZINES
+		static void createThreadMagazines();		///< let the calling thread allocate from magazines
+		static void releaseThreadMagazines();		///< return the magazines of the calling thread to their pools
+	#endif
 	#ifdef MEMORYPOOL_DEBUG
 		static void debugPoolInfoReport( MemoryPool *pool, FILE *fp = nullptr );	///< dump a report about this pool to the logfile
 		const char *debugGetBlockTagString(void *pBlock);		///< return the tagstring for the given block (assumed to belong to this pool)
@@ -360,7 +390,7 @@ public:
 	/// return the number of free (available) blocks in this pool.
 	Int getFreeBlockCount();
 
-	/// return the number of blocks in use in this pool.
+	/// return the number of blocks in use in this pool. with MEMORYPOOL_MAGAZINES, this includes the free blocks in the magazines.
 	Int getUsedBlockCount();
 
 	/// return the total number of blocks in this pool. [ == getFreeBlockCount() + getUsedBlockCount() ]
@@ -817,6 +847,19 @@ extern Bool isMemoryManagerOfficiallyInited();
 */
 extern void shutdownMemoryManager();
 
+/**
+	Let the calling thread keep memory for faster allocation. initMemoryManager() does this for
+	the main thread. Other threads that allocate a lot may call this when they start, and must
+	then call releaseMemoryManagerThreadCache() before they end. Threads that do not call it
+	allocate under the shared lock.
+*/
+extern void initMemoryManagerThreadCache();
+
+/**
+	Return the memory that the calling thread keeps for faster allocation.
+*/
+extern void releaseMemoryManagerThreadCache();
+
 extern MemoryPoolFactory *TheMemoryPoolFactory;
 extern DynamicMemoryAllocator *TheDynamicMemoryAllocator;
 
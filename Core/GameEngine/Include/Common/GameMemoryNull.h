@@ -139,6 +139,19 @@ extern Bool isMemoryManagerOfficiallyInited();
 */
 extern void shutdownMemoryManager();
 
+/**
+	Let the calling thread keep memory for faster allocation. initMemoryManager() does this for
+	the main thread. Other threads that allocate a lot may call this when they start, and must
+	then call releaseMemoryManagerThreadCache() before they end. Threads that do not call it
+	allocate under the shared lock.
+*/
+inline void initMemoryManagerThreadCache() {}
+
+/**
+	Return the memory that the calling thread keeps for faster allocation.
+*/
+inline void releaseMemoryManagerThreadCache() {}
+
 extern MemoryPoolFactory *TheMemoryPoolFactory;
 extern DynamicMemoryAllocator *TheDynamicMemoryAllocator;
 
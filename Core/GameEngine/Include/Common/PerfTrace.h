@@ -0,0 +1,85 @@
+/*
+**	Command & Conquer Generals Zero Hour(tm)
+**	Copyright 2026 TheSuperHackers
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// FILE: PerfTrace.h //////////////////////////////////////////////////////////////////////////////
+// Desc:   Records every USE_PERF_TIMER scope and every logic frame as a timeline, and writes it in
+//         the Chrome trace event format. Open the file with chrome://tracing or ui.perfetto.dev.
+//
+// Each thread records into its own buffer without locking. A full buffer is written to the file
+// by the thread that owns it. Scope names must be string literals, because only the pointer is
+// kept until the buffer is written.
+//
+// Scopes that are shorter than the minimum time are not recorded, which keeps the file of a long
+// replay small enough to load while the spikes remain.
+//
+// Compiled in with ENABLE_PERF_TRACE, and recording with -perfTrace <file>.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "Lib/BaseType.h"
+#include "Common/GameDefines.h"
+
+//-------------------------------------------------------------------------------------------------
+class PerfTrace
+{
+public:
+
+	static Bool open( const char *filename, Int minMicroseconds = 0 );	///< start recording, the calling thread is named the main thread
+	static void close();												///< write all buffers and end the file. Other threads must not record meanwhile.
+	static Bool isRecording() { return s_recording; }
+
+	static Int64 getTicks();
+	static void addScope( const char *name, Int64 startTicks, Int64 endTicks );
+	static void markFrame( UnsignedInt frame );	///< a global marker, and the frame number of the following scopes
+
+private:
+
+	static Bool s_recording;
+};
+
+//-------------------------------------------------------------------------------------------------
+class PerfTraceScope
+{
+public:
+
+	PerfTraceScope( const char *name ) : m_name(name)
+	{
+		m_startTicks = PerfTrace::isRecording() ? PerfTrace::getTicks() : -1;
+	}
+
+	~PerfTraceScope()
+	{
+		if (m_startTicks >= 0 && PerfTrace::isRecording())
+			PerfTrace::addScope(m_name, m_startTicks, PerfTrace::getTicks());
+	}
+
+private:
+
+	const char *m_name;
+	Int64 m_startTicks;
+};
+
+//-------------------------------------------------------------------------------------------------
+#if ENABLE_PERF_TRACE
+	#define PERF_TRACE_SCOPE(id)			PerfTraceScope t_##id(#id);
+	#define PERF_TRACE_FRAME(frame)		PerfTrace::markFrame(frame);
+#else
+	#define PERF_TRACE_SCOPE(id)
+	#define PERF_TRACE_FRAME(frame)
+#endif
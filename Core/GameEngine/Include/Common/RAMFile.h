@@ -48,6 +48,7 @@
 //----------------------------------------------------------------------------
 
 #include "Common/file.h"
+#include "Common/FileMapping.h"
 
 //----------------------------------------------------------------------------
 //           Forward References
@@ -75,6 +76,7 @@ class RAMFile : public File
 		Char				*m_data;											///< File data in memory
 		Int					m_pos;												///< current read position
 		Int					m_size;												///< size of file in memory
+		FileMapping::View	m_view;										///< mapped pages of m_data, if it points into a mapped file instead of owning a copy
 
 	public:
 
@@ -102,6 +104,7 @@ class RAMFile : public File
 
 		virtual Bool	open( File *file );																	///< Open file for fast RAM access
 		virtual Bool	openFromArchive(File *archiveFile, const AsciiString& filename, Int offset, Int size); ///< copy file data from the given file at the given offset for the given size.
+		virtual Bool	openFromMapping(const FileMapping& mapping, const AsciiString& filename, Int offset, Int size); ///< refer to the file data in the given mapped file at the given offset for the given size, without copying.
 		virtual Bool	copyDataToFile(File *localFile);										///< write the contents of the RAM file to the given local file.  This could be REALLY slow.
 
 		/**
@@ -37,4 +37,14 @@ extern void InitGameLogicRandom( UnsignedInt seed ); ///< Set the GameLogic seed
 extern UnsignedInt GetGameLogicRandomSeed( void );   ///< Get the seed (used for replays)
 extern UnsignedInt GetGameLogicRandomSeedCRC( void );///< Get the seed (used for CRCs)
 
+// TheSuperHackers @feature The complete GameLogic generator state. Save games do not store it,
+// so replay snapshots capture and restore it alongside the save data.
+struct GameLogicRandomState
+{
+	UnsignedInt seed[6];
+	UnsignedInt baseSeed;
+};
+extern void GetGameLogicRandomState( GameLogicRandomState *state );
+extern void SetGameLogicRandomState( const GameLogicRandomState *state );
+
 //--------------------------------------------------------------------------------------------------------------
@@ -18,6 +18,10 @@
 
 #pragma once
 
+#ifndef _WIN32
+#include <sys/types.h>
+#endif
+
 // Helper class that allows you to start a worker process and retrieve its exit code
 // and console output as a string.
 // It also makes sure that the started process is killed in case our process exits in any way.
@@ -26,7 +30,12 @@ class WorkerProcess
 public:
 	WorkerProcess();
 
+#ifdef _WIN32
 	bool startProcess(UnicodeString command);
+#else
+	// args[0] is the path of the executable, the remaining entries are passed as its arguments
+	bool startProcess(const std::vector<AsciiString>& args);
+#endif
 
 	void update();
 
@@ -35,7 +44,7 @@ public:
 	// returns true iff the process exited.
 	bool isDone() const;
 
-	DWORD getExitCode() const;
+	int getExitCode() const;
 	AsciiString getStdOutput() const;
 
 	// Terminate Process if it's running
@@ -46,11 +55,18 @@ private:
 	// returns false if the worker is still running
 	bool fetchStdOutput();
 
+	void appendStdOutput(char *buffer, int readBytes);
+
 private:
+#ifdef _WIN32
 	HANDLE m_processHandle;
 	HANDLE m_readHandle;
 	HANDLE m_jobHandle;
+#else
+	pid_t m_processId;
+	int m_readFd;
+#endif
 	AsciiString m_stdOutput;
-	DWORD m_exitcode;
+	int m_exitcode;
 	bool m_isDone;
 };
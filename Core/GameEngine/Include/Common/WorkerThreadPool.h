@@ -0,0 +1,96 @@
+/*
+**	Command & Conquer Generals Zero Hour(tm)
+**	Copyright 2026 TheSuperHackers
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// FILE: WorkerThreadPool.h ///////////////////////////////////////////////////////////////////////
+// Desc:   A small pool of threads that runs a function for every index of a range and returns
+//         when all indices are done.
+//
+// The calling thread works on the range as well, so a pool without threads runs everything on
+// the caller. Which thread runs which index is not defined, so the function must only write
+// data that belongs to its index if the result is to be the same in every run.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "Lib/BaseType.h"
+
+#ifndef _WIN32
+#include <pthread.h>
+#endif
+
+//-------------------------------------------------------------------------------------------------
+class WorkerThreadPool
+{
+public:
+
+	typedef void (*JobFunction)( void *userData, Int index );
+
+	enum
+	{
+		MAX_THREADS = 8,
+	};
+
+	WorkerThreadPool();
+	~WorkerThreadPool();
+
+	void init( Int numThreads = -1 );	///< -1 uses one thread less than there are processors, at most MAX_THREADS
+	void shutdown();
+
+	Int getThreadCount() const { return m_threadCount; }
+
+	/// Calls function for every index in [0, count) and returns when all are done. The caller takes part.
+	/// Must only be called by one thread at a time, and not from within a job.
+	void run( JobFunction function, void *userData, Int count );
+
+	static void parallelFor( JobFunction function, void *userData, Int count );	///< runs on TheWorkerThreadPool, or on the caller when there is none
+
+private:
+
+	static Int getProcessorCount();
+	void work();
+	void workerLoop();
+
+#ifdef _WIN32
+	static unsigned long __stdcall threadProc( void *param );
+#else
+	static void *threadProc( void *param );
+#endif
+
+	JobFunction m_function;
+	void *m_userData;
+	Int m_count;
+	long m_nextIndex;
+	long m_busyThreads;						///< threads of the current run that did not finish yet, including the caller
+	Bool m_quit;
+
+	Int m_threadCount;
+
+#ifdef _WIN32
+	HANDLE m_threads[MAX_THREADS];
+	HANDLE m_wakeSemaphore;
+	HANDLE m_doneEvent;
+#else
+	pthread_t m_threads[MAX_THREADS];
+	pthread_mutex_t m_mutex;
+	pthread_cond_t m_wakeCondition;
+	pthread_cond_t m_doneCondition;
+	Int m_wakeCount;							///< threads that may still start on the current run
+#endif
+};
+
+extern WorkerThreadPool *TheWorkerThreadPool;
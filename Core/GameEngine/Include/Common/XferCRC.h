@@ -62,7 +62,44 @@ protected:
 	virtual void xferImplementation( void *data, Int dataSize );
 
 	inline void addCRC( UnsignedInt val );								///< CRC a 4-byte block
+	inline void crcBytes( const void *data, Int dataSize );		///< CRC a block of data, shared by all CRC paths
 
 	UnsignedInt m_crc;
 
 };
+
+//-------------------------------------------------------------------------------------------------
+/** TheSuperHackers @performance XferCRC with the fixed size xfer methods folding their value straight
+	* into the CRC, instead of taking a second virtual call into the generic xferImplementation.
+	* It produces the exact same CRC as XferCRC. Do not derive from it to capture the data like
+	* XferDeepCRC does, because the overridden methods never reach xferImplementation. */
+//-------------------------------------------------------------------------------------------------
+class XferFastCRC : public XferCRC
+{
+
+public:
+
+	XferFastCRC( void ) { }
+
+	virtual void xferVersion( XferVersion *versionData, XferVersion currentVersion );
+	virtual void xferByte( Byte *byteData );
+	virtual void xferUnsignedByte( UnsignedByte *unsignedByteData );
+	virtual void xferBool( Bool *boolData );
+	virtual void xferInt( Int *intData );
+	virtual void xferInt64( Int64 *int64Data );
+	virtual void xferUnsignedInt( UnsignedInt *unsignedIntData );
+	virtual void xferShort( Short *shortData );
+	virtual void xferUnsignedShort( UnsignedShort *unsignedShortData );
+	virtual void xferReal( Real *realData );
+	virtual void xferAsciiString( AsciiString *asciiStringData );
+	virtual void xferCoord3D( Coord3D *coord3D );
+	virtual void xferICoord3D( ICoord3D *iCoord3D );
+	virtual void xferCoord2D( Coord2D *coord2D );
+	virtual void xferICoord2D( ICoord2D *iCoord2D );
+	virtual void xferColor( Color *color );
+	virtual void xferObjectID( ObjectID *objectID );
+	virtual void xferDrawableID( DrawableID *drawableID );
+	virtual void xferUser( void *data, Int dataSize );
+	virtual void xferMatrix3D( Matrix3D* mtx );
+
+};
@@ -64,3 +64,31 @@ protected:
 	FILE * m_fileFP;																					///< pointer to file
 
 };
+
+//-------------------------------------------------------------------------------------------------
+/** Xfer load implementation that reads from a memory buffer instead of a file.
+	* The buffer is not copied and must stay valid until the xfer is closed */
+//-------------------------------------------------------------------------------------------------
+class XferLoadBuffer : public XferLoad
+{
+
+public:
+
+	XferLoadBuffer( const void *data, Int dataSize );
+	virtual ~XferLoadBuffer( void );
+
+	virtual void open( AsciiString identifier );				///< start reading at the beginning of the buffer
+	virtual void close( void );													///< stop reading
+	virtual Int beginBlock( void );											///< read placeholder block size
+	virtual void skip( Int dataSize );									///< skip forward dataSize bytes in the buffer
+
+protected:
+
+	virtual void xferImplementation( void *data, Int dataSize );		///< the xfer implementation
+
+	const UnsignedByte *m_data;																///< data to read from
+	Int m_dataSize;																						///< size of data in bytes
+	Int m_pos;																								///< current read position
+	Bool m_isOpen;
+
+};
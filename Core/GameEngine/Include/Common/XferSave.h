@@ -70,3 +70,33 @@ protected:
 	XferBlockData *m_blockStack;													///< stack of block data
 
 };
+
+//-------------------------------------------------------------------------------------------------
+/** Xfer save implementation that writes into a memory buffer instead of a file */
+//-------------------------------------------------------------------------------------------------
+class XferSaveBuffer : public XferSave
+{
+
+public:
+
+	XferSaveBuffer( void );
+	virtual ~XferSaveBuffer( void );
+
+	// Xfer methods
+	virtual void open( AsciiString identifier );		///< clear the buffer for writing
+	virtual void close( void );											///< stop writing, the buffer is kept
+	virtual Int beginBlock( void );									///< write placeholder block size
+	virtual void endBlock( void );									///< write size at the last begin block
+	virtual void skip( Int dataSize );							///< skipping during a write is a no-op
+
+	const std::vector<UnsignedByte>& getBuffer( void ) const { return m_buffer; }
+	std::vector<UnsignedByte>& getBuffer( void ) { return m_buffer; }
+
+protected:
+
+	virtual void xferImplementation( void *data, Int dataSize );		///< the xfer implementation
+
+	std::vector<UnsignedByte> m_buffer;										///< the written data
+	Bool m_isOpen;
+
+};
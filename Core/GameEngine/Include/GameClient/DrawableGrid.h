@@ -0,0 +1,84 @@
+/*
+**	Command & Conquer Generals Zero Hour(tm)
+**	Copyright 2026 TheSuperHackers
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// FILE: DrawableGrid.h ///////////////////////////////////////////////////////////////////////////
+// Desc:   Uniform grid of all client Drawables by position, for region queries that do not walk
+//         the whole Drawable list.
+//
+// The grid does not depend on the map size. Cells wrap around after DRAWABLE_GRID_CELLS cells in
+// each direction, so a bucket can hold Drawables from far apart cells. Queries therefore always
+// test the exact position, and return the same Drawables as a walk of the whole list would.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "Lib/BaseType.h"
+#include "Common/STLTypedefs.h"
+
+class Drawable;
+
+//-------------------------------------------------------------------------------------------------
+class DrawableGrid
+{
+public:
+
+	enum
+	{
+		DRAWABLE_GRID_CELLS = 128,						///< cells per axis, must be a power of two
+		DRAWABLE_GRID_CELL_SIZE = 160,				///< world units per cell
+	};
+
+	typedef std::vector<Drawable *> DrawableList;
+
+	/**
+		* Finds the Drawables in a region. The result is collected before the caller looks at it, so
+		* Drawables may move or be destroyed while the result is processed. Destroyed Drawables read
+		* as null. Queries can nest.
+		*/
+	class Query
+	{
+	public:
+		Query( DrawableGrid *grid, const Region3D *region );
+		~Query();
+
+		Int getCount() const { return (Int)m_grid->m_results[m_depth].size(); }
+		Drawable *get( Int i ) const { return m_grid->m_results[m_depth][i]; }	///< null if the Drawable was destroyed since
+
+	private:
+		DrawableGrid *m_grid;
+		Int m_depth;												///< index of the result in m_grid
+	};
+
+	DrawableGrid();
+
+	void add( Drawable *draw );
+	void remove( Drawable *draw );
+	void update( Drawable *draw );	///< call after the Drawable moved
+
+private:
+
+	friend class Query;
+
+	static Int getCell( Real coord );
+	static Int getBucket( const Coord3D *pos );
+	void removeFromBucket( Drawable *draw );
+
+	DrawableList m_buckets[ DRAWABLE_GRID_CELLS * DRAWABLE_GRID_CELLS ];
+	std::vector<DrawableList> m_results;		///< one result per nested query, kept for reuse
+	Int m_queryDepth;
+};
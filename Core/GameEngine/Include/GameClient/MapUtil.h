@@ -96,12 +96,14 @@ public:
 class MapCache : public std::map<AsciiString, MapMetaData>
 {
 	typedef std::set<AsciiString> MapNameSet;
+	struct MapFileCandidate;
 
 public:
 	MapCache()
 		: m_doCreateStandardMapCacheINI(TRUE)
 		, m_doLoadStandardMapCacheINI(TRUE)
-		, m_doLoadUserMapCacheINI(TRUE)
+		, m_doLoadUserMapCache(TRUE)
+		, m_doWriteUserMapCacheBinary(FALSE)
 	{}
 
 	void updateCache( void );
@@ -120,15 +122,25 @@ private:
 	Bool clearUnseenMaps(const AsciiString &mapDir);
 	void loadMapsFromMapCacheINI(const AsciiString &mapDir);
 	Bool loadMapsFromDisk(const AsciiString &mapDir, Bool isOfficial, Bool filterByAllowedMaps = FALSE); // returns true if we needed to (re)parse a map
-	Bool addMap(const AsciiString &mapDir, const AsciiString &fname, const AsciiString &lowerFname, FileInfo &fileInfo, Bool isOfficial); ///< returns true if it had to (re)parse the map
+	Bool addCachedMap(const AsciiString &fname, const AsciiString &lowerFname, const FileInfo &fileInfo); ///< returns true if the cached entry still matches the file size and timestamp
+	Bool addMaps(const AsciiString &mapDir, const std::vector<MapFileCandidate> &candidates, Bool isOfficial); ///< returns true if the map list changed
+	void addParsedMap(const AsciiString &mapDir, const MapFileCandidate &candidate, Bool isOfficial, UnsignedInt crc);
+	void updateDisplayName(const AsciiString &fname, MapMetaData &md);
 	void writeCacheINI(const AsciiString &mapDir);
 
+	// TheSuperHackers @performance The user map cache is also kept in a binary file, which loads without the INI parser.
+	// The INI is still written, because other builds of the game read it from the same folder.
+	Bool loadMapsFromMapCacheBinary(const AsciiString &mapDir); ///< returns false if the file is missing or unusable
+	void writeCacheBinary(const AsciiString &mapDir);
+
 	static const char *const m_mapCacheName;
+	static const char *const m_mapCacheBinaryName;
 
 	MapNameSet m_allowedMaps;
 	Bool m_doCreateStandardMapCacheINI;
 	Bool m_doLoadStandardMapCacheINI;
-	Bool m_doLoadUserMapCacheINI;
+	Bool m_doLoadUserMapCache;
+	Bool m_doWriteUserMapCacheBinary;
 };
 
 extern MapCache *TheMapCache;
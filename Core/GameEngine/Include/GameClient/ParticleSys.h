@@ -111,147 +111,6 @@ enum ParticlePriorityType CPP_11(: Int)
 	PARTICLE_PRIORITY_HIGHEST = NUM_PARTICLE_PRIORITIES - 1,
 };
 
-/**
- * This structure is filled out and passed to the constructor of a Particle to initialize it
- */
-class ParticleInfo : public Snapshot
-{
-
-public:
-
-	ParticleInfo( void );
-
-	Coord3D m_vel;															///< initial velocity
-	Coord3D m_pos;															///< initial position
-	Coord3D m_emitterPos;												///< position of the emitter
-	Real m_velDamping;													///< velocity damping coefficient
-
-#if PARTICLE_USE_XY_ROTATION
-	Real m_angleX;															///< initial angle around X axis
-	Real m_angleY;															///< initial angle around Y axis
-#endif
-	Real m_angleZ;															///< initial angle around Z axis
-#if PARTICLE_USE_XY_ROTATION
-	Real m_angularRateX;												///< initial angle around X axis
-	Real m_angularRateY;												///< initial angle around Y axis
-#endif
-	Real m_angularRateZ;												///< initial angle around Z axis
-	Real m_angularDamping;											///< angular velocity damping coefficient
-
-	UnsignedInt m_lifetime;											///< lifetime of this particle
-
-	Real m_size;																///< size of the particle
-	Real m_sizeRate;														///< rate of change of size
-	Real m_sizeRateDamping;											///< damping of size change rate
-
-	Keyframe m_alphaKey[ MAX_KEYFRAMES ];
-	RGBColorKeyframe m_colorKey[ MAX_KEYFRAMES ];
-
-	Real m_colorScale;													///< color "scaling" coefficient
-
-	Real m_windRandomness;											///< multiplier for wind randomness per particle
-
-	Bool m_particleUpTowardsEmitter;						///< if this is true, then the 0.0 Z rotation should actually
-																							///< correspond to the direction of the emitter.
-
-protected:
-
-	// snapshot methods
-	virtual void crc( Xfer *xfer );
-	virtual void xfer( Xfer *xfer );
-	virtual void loadPostProcess( void );
-
-};
-
-
-/**
- * An individual particle created by a ParticleSystem.
- * NOTE: Particles cannot exist without a parent particle system.
- */
-class Particle : public MemoryPoolObject,
-								 public ParticleInfo
-{
-
-	MEMORY_POOL_GLUE_WITH_USERLOOKUP_CREATE( Particle, "ParticlePool" )
-
-public:
-
-	Particle( ParticleSystem *system, const ParticleInfo *data );
-
-	Bool update( void );												///< update this particle's behavior - return false if dead
-	void doWindMotion( void );									///< do wind motion (if present) from particle system
-
-	void applyForce( const Coord3D *force );		///< add the given acceleration
-
-	const Coord3D *getPosition( void ) { return &m_pos; }
-	Real getSize( void ) { return m_size; }
-	Real getAngle( void ) { return m_angleZ; }
-	Real getAlpha( void ) { return m_alpha; }
-	const RGBColor *getColor( void ) { return &m_color; }
-	void setColor( RGBColor *color ) { m_color = *color; }
-
-	Bool isInvisible( void );										///< return true if this particle is invisible
-	Bool isCulled (void) {return m_isCulled;}				///< return true if the particle falls off the edge of the screen
-	void setIsCulled (Bool enable) { m_isCulled = enable;}		///< set particle to not visible because it's outside view frustum
-
-	void controlParticleSystem( ParticleSystem *sys ) { m_systemUnderControl = sys; }
-	void detachControlledParticleSystem( void ) { m_systemUnderControl = nullptr; }
-
-	// get priority of this particle ... which is the priority of the system it belongs to
-	ParticlePriorityType getPriority( void );
-
-	UnsignedInt getPersonality(void) { return m_personality; };
-	void setPersonality(UnsignedInt p) { m_personality = p; };
-
-protected:
-
-	// snapshot methods
-	virtual void crc( Xfer *xfer );
-	virtual void xfer( Xfer *xfer );
-	virtual void loadPostProcess( void );
-
-	void computeAlphaRate( void );							///< compute alpha rate to get to next key
-	void computeColorRate( void );							///< compute color change to get to next key
-
-public:
-	Particle *				m_systemNext;
-	Particle *				m_systemPrev;
-	Particle *				m_overallNext;
-	Particle *				m_overallPrev;
-
-protected:
-	ParticleSystem *	m_system;										///< the particle system this particle belongs to
-	UnsignedInt				m_personality;							    ///< each new particle assigned a number one higher than the previous
-
-	// most of the particle data is derived from ParticleInfo
-
-	Coord3D						m_accel;														///< current acceleration
-	Coord3D						m_lastPos;													///< previous position
-	UnsignedInt				m_lifetimeLeft;									///< lifetime remaining, if zero -> destroy
-	UnsignedInt				m_createTimestamp;							///< frame this particle was created
-
-	Real							m_alpha;																///< current alpha of this particle
-	Real							m_alphaRate;														///< current rate of alpha change
-	Int								m_alphaTargetKey;												///< next index into key array
-
-	RGBColor					m_color;														///< current color of this particle
-	RGBColor					m_colorRate;												///< current rate of color change
-	Int								m_colorTargetKey;												///< next index into key array
-
-
-	Bool							m_isCulled;														///< status of particle relative to screen bounds
-public:
-	Bool							m_inSystemList;
-	Bool							m_inOverallList;
-
-	union
-	{
-		ParticleSystem *	m_systemUnderControl;			///< the particle system attached to this particle (not the system that created us)
-		ParticleSystemID	m_systemUnderControlID;	///< id of system attached to this particle (not the system that created us);
-	};
-
-};
-
 /**
  * All of the properties of a particle system, used by both ParticleSystemTemplates
  * and ParticleSystem classes.
@@ -502,6 +361,224 @@ static_assert(ARRAY_SIZE(WindMotionNames) == ParticleSystemInfo::WIND_MOTION_COU
 
 #endif
 
+/**
+ * TheSuperHackers @performance The state of a ParticleSystem that all of its particles read during
+ * an update. It is computed once per system update, instead of once per particle.
+ */
+struct ParticleUpdateContext
+{
+	Coord3D m_driftVelocity;														///< drift velocity of the system
+	Real m_gravity;																			///< gravity acceleration (global Z)
+	ParticleSystemInfo::ParticleShaderType m_shaderType;
+	UnsignedInt m_frame;																///< current client frame
+	Bool m_doWindMotion;																///< TRUE if the system has wind motion
+	Coord3D m_windPos;																	///< world position of the wind source
+	Real m_windDirX;																		///< Cos of the wind angle
+	Real m_windDirY;																		///< Sin of the wind angle
+};
+
+/**
+ * This structure is filled out and passed to the constructor of a Particle to initialize it
+ */
+class ParticleInfo : public Snapshot
+{
+
+public:
+
+	ParticleInfo( void );
+
+	Coord3D m_vel;															///< initial velocity
+	Coord3D m_pos;															///< initial position
+	Coord3D m_emitterPos;												///< position of the emitter
+	Real m_velDamping;													///< velocity damping coefficient
+
+#if PARTICLE_USE_XY_ROTATION
+	Real m_angleX;															///< initial angle around X axis
+	Real m_angleY;															///< initial angle around Y axis
+#endif
+	Real m_angleZ;															///< initial angle around Z axis
+#if PARTICLE_USE_XY_ROTATION
+	Real m_angularRateX;												///< initial angle around X axis
+	Real m_angularRateY;												///< initial angle around Y axis
+#endif
+	Real m_angularRateZ;												///< initial angle around Z axis
+	Real m_angularDamping;											///< angular velocity damping coefficient
+
+	UnsignedInt m_lifetime;											///< lifetime of this particle
+
+	Real m_size;																///< size of the particle
+	Real m_sizeRate;														///< rate of change of size
+	Real m_sizeRateDamping;											///< damping of size change rate
+
+	Keyframe m_alphaKey[ MAX_KEYFRAMES ];
+	RGBColorKeyframe m_colorKey[ MAX_KEYFRAMES ];
+
+	Real m_colorScale;													///< color "scaling" coefficient
+
+	Real m_windRandomness;											///< multiplier for wind randomness per particle
+
+	Bool m_particleUpTowardsEmitter;						///< if this is true, then the 0.0 Z rotation should actually
+																							///< correspond to the direction of the emitter.
+
+protected:
+
+	// snapshot methods
+	virtual void crc( Xfer *xfer );
+	virtual void xfer( Xfer *xfer );
+	virtual void loadPostProcess( void );
+
+};
+
+
+/**
+ * TheSuperHackers @performance The motion state of the particles of one ParticleSystem, kept as one
+ * array per field. The system moves, turns, grows and ages all of its particles in tight loops over
+ * these arrays, and drops its dead particles from them in a single pass. Each Particle knows the
+ * index of its entry and reads its position, size and angle from here.
+ */
+class ParticleStore
+{
+
+public:
+
+	void add( Particle *particle );												///< append an entry that holds the state of the given particle
+	void remove( Particle *particle );										///< remove the entry of the given particle if it has one, the last entry takes its place
+	Int getCount( void ) const { return (Int)m_particle.size(); }
+	Particle *getParticle( Int index ) const { return m_particle[ index ]; }
+
+	void update( const ParticleUpdateContext& context );	///< integrate the motion, size and lifetime of all entries
+	Bool isDead( Int index ) const { return m_isDead[ index ] != 0; }
+	void setDead( Int index ) { m_isDead[ index ] = TRUE; }
+	void deleteDeadParticles( void );											///< drop all dead entries in one pass and delete their particles
+
+	void getPosition( Int index, Coord3D *pos ) const;
+	void copyToParticle( Int index, Particle *particle ) const;		///< write the state of an entry back into its particle
+	void copyFromParticle( Int index, const Particle *particle );	///< read the state of an entry from its particle
+
+protected:
+
+	void moveEntry( Int from, Int to );
+	void resize( Int count );
+
+public:
+
+	std::vector<Particle *>		m_particle;								///< the particle of each entry
+	std::vector<Real>					m_posX;
+	std::vector<Real>					m_posY;
+	std::vector<Real>					m_posZ;
+	std::vector<Real>					m_velX;
+	std::vector<Real>					m_velY;
+	std::vector<Real>					m_velZ;
+	std::vector<Real>					m_accelX;
+	std::vector<Real>					m_accelY;
+	std::vector<Real>					m_accelZ;
+	std::vector<Real>					m_velDamping;
+	std::vector<Real>					m_angleZ;
+	std::vector<Real>					m_angularRateZ;
+	std::vector<Real>					m_angularDamping;
+	std::vector<Real>					m_size;
+	std::vector<Real>					m_sizeRate;
+	std::vector<Real>					m_sizeRateDamping;
+	std::vector<Real>					m_windRandomness;
+	std::vector<UnsignedInt>	m_lifetimeLeft;
+	std::vector<UnsignedByte>	m_isDead;									///< set by update when the lifetime of the entry runs out
+};
+
+/**
+ * An individual particle created by a ParticleSystem.
+ * NOTE: Particles cannot exist without a parent particle system.
+ * While the particle is in the list of its system, its motion state lives in the ParticleStore of
+ * the system. The inherited members only hold a copy of it for xfer and after the particle left the store.
+ */
+class Particle : public MemoryPoolObject,
+								 public ParticleInfo
+{
+
+	MEMORY_POOL_GLUE_WITH_USERLOOKUP_CREATE( Particle, "ParticlePool" )
+
+	friend class ParticleStore;
+
+public:
+
+	Particle( ParticleSystem *system, const ParticleInfo *data );
+
+	Bool update( const ParticleUpdateContext& context );	///< update everything but the motion state of this particle - return false if dead
+
+	void applyForce( const Coord3D *force );		///< add the given acceleration
+
+	const Coord3D *getPosition( void ) { if (m_store) m_store->getPosition( m_storeIndex, &m_pos ); return &m_pos; }
+	Real getSize( void ) { return m_store ? m_store->m_size[ m_storeIndex ] : m_size; }
+	Real getAngle( void ) { return m_store ? m_store->m_angleZ[ m_storeIndex ] : m_angleZ; }
+	Real getAlpha( void ) { return m_alpha; }
+	const RGBColor *getColor( void ) { return &m_color; }
+	void setColor( RGBColor *color ) { m_color = *color; }
+
+	Bool isInvisible( void );													///< return true if this particle is invisible
+	Bool isInvisible( const ParticleUpdateContext& context );	///< return true if this particle is invisible, using the shader type of the context
+	Bool isCulled (void) {return m_isCulled;}				///< return true if the particle falls off the edge of the screen
+	void setIsCulled (Bool enable) { m_isCulled = enable;}		///< set particle to not visible because it's outside view frustum
+
+	void controlParticleSystem( ParticleSystem *sys ) { m_systemUnderControl = sys; }
+	void detachControlledParticleSystem( void ) { m_systemUnderControl = nullptr; }
+
+	// get priority of this particle ... which is the priority of the system it belongs to
+	ParticlePriorityType getPriority( void );
+
+	UnsignedInt getPersonality(void) { return m_personality; };
+	void setPersonality(UnsignedInt p) { m_personality = p; };
+
+protected:
+
+	// snapshot methods
+	virtual void crc( Xfer *xfer );
+	virtual void xfer( Xfer *xfer );
+	virtual void loadPostProcess( void );
+
+	void computeAlphaRate( void );							///< compute alpha rate to get to next key
+	void computeColorRate( void );							///< compute color change to get to next key
+	Bool isInvisibleWithShader( ParticleSystemInfo::ParticleShaderType shaderType );	///< return true if this particle is invisible with the given shader type
+
+public:
+	Particle *				m_systemNext;
+	Particle *				m_systemPrev;
+	Particle *				m_overallNext;
+	Particle *				m_overallPrev;
+
+protected:
+	ParticleSystem *	m_system;										///< the particle system this particle belongs to
+	UnsignedInt				m_personality;							    ///< each new particle assigned a number one higher than the previous
+	ParticleStore *		m_store;										///< the store that holds the motion state of this particle, null if not in one
+	Int								m_storeIndex;								///< index of the entry of this particle in m_store
+
+	// most of the particle data is derived from ParticleInfo
+
+	Coord3D						m_accel;														///< current acceleration
+	Coord3D						m_lastPos;													///< previous position
+	UnsignedInt				m_lifetimeLeft;									///< lifetime remaining, if zero -> destroy
+	UnsignedInt				m_createTimestamp;							///< frame this particle was created
+
+	Real							m_alpha;																///< current alpha of this particle
+	Real							m_alphaRate;														///< current rate of alpha change
+	Int								m_alphaTargetKey;												///< next index into key array
+
+	RGBColor					m_color;														///< current color of this particle
+	RGBColor					m_colorRate;												///< current rate of color change
+	Int								m_colorTargetKey;												///< next index into key array
+
+
+	Bool							m_isCulled;														///< status of particle relative to screen bounds
+public:
+	Bool							m_inSystemList;
+	Bool							m_inOverallList;
+
+	union
+	{
+		ParticleSystem *	m_systemUnderControl;			///< the particle system attached to this particle (not the system that created us)
+		ParticleSystemID	m_systemUnderControlID;	///< id of system attached to this particle (not the system that created us);
+	};
+
+};
+
 /**
  * A ParticleSystemTemplate, used by the ParticleSystemManager to instantiate ParticleSystems.
  */
@@ -683,10 +760,12 @@ protected:
 	const Coord3D *computeParticlePosition( void );		///< compute a position based on emission properties
 	const Coord3D *computeParticleVelocity( const Coord3D *pos );	///< compute a velocity vector based on emission properties
 	const Coord3D *computePointOnUnitSphere( void );	///< compute a random point on a unit sphere
+	void computeParticleUpdateContext( ParticleUpdateContext *context );	///< get the state that the particles read during update
 
 protected:
 	Particle *				m_systemParticlesHead;
 	Particle *				m_systemParticlesTail;
+	ParticleStore			m_particleStore;								///< motion state of the particles of this system
 
 	UnsignedInt				m_particleCount;								///< current count of particles for this system
 	ParticleSystemID	m_systemID;											///< unique id given to this system from the particle system manager
@@ -0,0 +1,78 @@
+/*
+**	Command & Conquer Generals Zero Hour(tm)
+**	Copyright 2026 TheSuperHackers
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// FILE: TerrainHeightField.h /////////////////////////////////////////////////////////////////////
+// Desc:   The terrain heights of the logic, so that height, normal and line of sight queries do not
+//         need the terrain render object.
+//
+// Every sample keeps its height next to the slopes that the smoothed normals are made of, so a
+// query reads four neighbouring samples in two rows instead of twelve heights in four rows. The
+// results are the same as those of BaseHeightMapRenderObjClass::getHeightMapHeight and
+// BaseHeightMapRenderObjClass::isClearLineOfSight, bit for bit, because the logic depends on them.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "Lib/BaseType.h"
+
+//-------------------------------------------------------------------------------------------------
+class TerrainHeightField
+{
+public:
+
+	TerrainHeightField();
+	~TerrainHeightField();
+
+	void init( const UnsignedShort *heights, Int xExtent, Int yExtent, Int borderSize );	///< heights of the whole map including the border
+	void reset();
+
+	Bool isLoaded() const { return m_samples != nullptr; }
+	Int getXExtent() const { return m_xExtent; }
+	Int getYExtent() const { return m_yExtent; }
+	Int getBorderSize() const { return m_borderSize; }
+
+	/// The raw heights take grid positions without the border, like TerrainVisual::getRawMapHeight
+	Int getRawMapHeight( const ICoord2D *gridPos ) const;
+	void setRawMapHeight( const ICoord2D *gridPos, Int height );	///< only lowers, like TerrainVisual::setRawMapHeight
+
+	void getRawHeights( UnsignedShort *heights ) const;			///< copy out all heights including the border
+	void setRawHeights( const UnsignedShort *heights );			///< replace all heights including the border
+
+	Real getHeight( Real x, Real y, Coord3D *normal = nullptr ) const;
+	void getHeights( const Coord2D *points, Real *heights, Int count ) const;	///< getHeight for many points, without normals
+	Bool isClearLineOfSight( const Coord3D &pos, const Coord3D &posOther ) const;	///< walks the grid cells between pos and posOther
+
+private:
+
+	struct Sample
+	{
+		UnsignedShort height;
+		Short slopeX;						///< difference of the low bytes of the heights left and right of this sample
+		Short slopeY;						///< difference of the low bytes of the heights below and above this sample
+	};
+
+	void updateSlopes( Int index );
+	void updateAllSlopes();
+	Real sampleHeight( Real x, Real y, Coord3D *normal ) const;
+
+	Sample *m_samples;
+	Int m_xExtent;
+	Int m_yExtent;
+	Int m_borderSize;
+	Real m_maxHeight;								///< no sample is higher, in world units
+};
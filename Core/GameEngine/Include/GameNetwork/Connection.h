@@ -78,6 +78,7 @@ public:
 
 #if defined(RTS_DEBUG)
 	void debugPrintCommands();
+	Int getTotalRetries() const { return m_totalRetries; }
 #endif
 
 protected:
@@ -98,4 +99,7 @@ protected:
 	time_t m_lastTimeSent;				///< The time of the last packet send.
 	Int m_numRetries;							///< The number of retries for the last second.
 	time_t m_retryMetricsTime;		///< The start time of the current retry metrics thing.
+#if defined(RTS_DEBUG)
+	Int m_totalRetries;						///< The number of retries since the connection was initialized.
+#endif
 };
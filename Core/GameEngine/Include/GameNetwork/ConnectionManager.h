@@ -139,6 +139,7 @@ public:
 
 #if defined(RTS_DEBUG)
 	void debugPrintConnectionCommands();
+	Int getTotalRetries();												///< resent commands of all connections
 #endif
 
 	// For disconnect blame assignment
@@ -119,16 +119,6 @@ struct TransportMessage
 };
 #pragma pack(pop)
 
-#if defined(RTS_DEBUG)
-#pragma pack(push, 1)
-struct DelayedTransportMessage
-{
-	UnsignedInt deliveryTime;
-	TransportMessage message;
-};
-#pragma pack(pop)
-#endif
-
 /**
  * Message types
  */
@@ -0,0 +1,96 @@
+/*
+**	Command & Conquer Generals Zero Hour(tm)
+**	Copyright 2026 TheSuperHackers
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// FILE: NetworkSimulator.h ///////////////////////////////////////////////////////////////////////
+// Desc:   Delays, reorders and drops the incoming packets of the Transport, to test the lockstep
+//         and run ahead logic against bad connections on a single machine.
+//
+// All decisions come from a random generator with a fixed seed and are drawn in packet order,
+// so the same packets meet the same fate in every run. It does not use the game client random
+// values, so enabling it does not change anything else.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "GameNetwork/NetworkDefs.h"
+
+//-------------------------------------------------------------------------------------------------
+class NetworkSimulator
+{
+public:
+
+	struct Settings
+	{
+		Int latencyAverage;					///< milliseconds
+		Int latencyAmplitude;				///< milliseconds of the sinusoidal modulation
+		Int latencyPeriod;					///< rate of the sinusoidal modulation
+		Int latencyNoise;						///< maximum milliseconds of uniform jitter either way
+		Int latencySpikeChance;			///< percent of the packets that get a spike
+		Int latencySpike;						///< mean milliseconds of a spike, spikes are exponentially distributed
+		Int packetReorder;					///< percent of the packets that arrive after the packet that follows them
+		Int packetLoss;							///< percent of the packets that are dropped
+		UnsignedInt seed;
+	};
+
+	NetworkSimulator();
+
+	void init( const Settings& settings );
+	void reset();
+
+	Bool dropPacket();																				///< Decide whether the next packet is lost
+	void addPacket( const TransportMessage& message, UnsignedInt now );	///< Delay a packet that was not lost
+	Bool getDeliveredPacket( TransportMessage& message, UnsignedInt now );	///< The next packet that arrives by now, if any
+
+	void logStatistics() const;
+
+private:
+
+	enum
+	{
+		MAX_REORDER_HOLD = 250,	///< milliseconds a reordered packet waits for the next one at most
+	};
+
+	struct DelayedPacket
+	{
+		UnsignedInt deliveryTime;
+		UnsignedInt sequence;
+		Bool waitForNext;					///< reordered, arrives after a packet with a later sequence
+		TransportMessage message;
+	};
+
+	UnsignedInt randomValue();
+	Int randomRange( Int lo, Int hi );
+	Int getLatency( UnsignedInt now );
+
+	Settings m_settings;
+	UnsignedInt m_randomState;
+	UnsignedInt m_nextSequence;
+	UnsignedInt m_deliveredSequenceEnd;			///< one past the highest sequence that was delivered
+
+	DelayedPacket m_packets[MAX_MESSAGES];
+	Int m_packetCount;
+
+	// Statistics
+	Int m_numReceived;
+	Int m_numDropped;
+	Int m_numReordered;
+	Int m_numSpikes;
+	Int m_numOverflows;
+	Int m_totalDelay;
+	Int m_maxDelay;
+};
@@ -30,6 +30,7 @@
 
 #include "GameNetwork/udp.h"
 #include "GameNetwork/NetworkDefs.h"
+#include "GameNetwork/NetworkSimulator.h"
 
 /**
  * The transport layer handles the UDP socket for the game, and will packetize and
@@ -74,7 +75,8 @@ public:
 	TransportMessage m_inBuffer[MAX_MESSAGES];
 
 #if defined(RTS_DEBUG)
-	DelayedTransportMessage m_delayedInBuffer[MAX_MESSAGES];
+	// TheSuperHackers @feature Seeded latency, spikes, reordering and packet loss for the incoming packets
+	NetworkSimulator m_simulator;
 #endif
 
 	UnsignedShort m_port;
@@ -96,5 +98,10 @@ private:
 	Int m_statisticsSlot;
 	UnsignedInt m_lastSecond;
 
+	// TheSuperHackers @performance Datagrams move to and from the socket in batches
+	UDP::Datagram m_batch[MAX_MESSAGES];
+	Int m_batchSlot[MAX_MESSAGES];						///< m_outBuffer index of each datagram in m_batch
+	TransportMessage m_recvMessages[UDP::MAX_BATCH];
+
 	Bool isGeneralsPacket( TransportMessage *msg );
 };
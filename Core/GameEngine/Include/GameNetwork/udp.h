@@ -92,6 +92,17 @@ class UDP
     TIMEDOUT     =-15      // Timeout
   };
 
+  // TheSuperHackers @performance One datagram of ReadBatch and WriteBatch
+  struct Datagram
+  {
+    unsigned char *buf;
+    UnsignedInt   len;     // size of buf, or bytes to send. Bytes read or sent afterwards.
+    UnsignedInt   IP;      // host byte order
+    UnsignedShort port;    // host byte order
+  };
+
+  enum { MAX_BATCH = 64 }; // datagrams per system call
+
 // CODE
  private:
   Int           SetBlocking(Int block);
@@ -105,6 +116,8 @@ class UDP
   Int           Bind(const char *Host,UnsignedShort port);
   Int           Write(const unsigned char *msg,UnsignedInt len,UnsignedInt IP,UnsignedShort port);
   Int           Read(unsigned char *msg,UnsignedInt len,sockaddr_in *from);
+  Int           ReadBatch(Datagram *msgs,Int count);
+  Int           WriteBatch(Datagram *msgs,Int count);
   sockStat         GetStatus(void);
   void             ClearStatus(void);
   //int              Wait(Int sec,Int usec,fd_set &returnSet);
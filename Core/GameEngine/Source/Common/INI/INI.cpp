@@ -205,6 +205,7 @@ INI::INI( void )
 	m_blockEndToken			= "END";
 	m_endOfFile					= FALSE;
 	m_buffer[0]					= 0;
+	m_line							= m_buffer;
 #ifdef DEBUG_CRASHING
 	m_curBlockStart[0]	= 0;
 #endif
@@ -360,6 +361,8 @@ void INI::unPrepFile()
 	m_loadType = INI_LOAD_INVALID;
 	m_lineNum = 0;
 	m_endOfFile = FALSE;
+	m_buffer[0] = 0;
+	m_line = m_buffer;
 	s_xfer = nullptr;
 }
 
@@ -428,10 +431,10 @@ UnsignedInt INI::load( AsciiString filename, INILoadType loadType, Xfer *pXfer,
 			// read this line
 			readLine();
 
-			AsciiString currentLine = m_buffer;
+			AsciiString currentLine = m_line;
 
 			// the first word is the type of data we're processing
-			const char *token = strtok( m_buffer, m_seps );
+			const char *token = strtok( m_line, m_seps );
 
 			// skip non MapData blocks if loading
 			bool skip = (loadType == INI_LOAD_MAPDATA_ONLY) && (strcmp(token, "MapData") != 0);
@@ -443,7 +446,7 @@ UnsignedInt INI::load( AsciiString filename, INILoadType loadType, Xfer *pXfer,
 				{
 					#ifdef DEBUG_CRASHING
 					static_assert(ARRAY_SIZE(m_curBlockStart) >= ARRAY_SIZE(m_buffer), "Incorrect array size");
-					strcpy(m_curBlockStart, m_buffer);
+					strcpy(m_curBlockStart, m_line);
 					#endif
 					try {
 						(*parse)( this );
@@ -488,6 +491,10 @@ UnsignedInt INI::load( AsciiString filename, INILoadType loadType, Xfer *pXfer,
 	* 
 	* TheSuperHackers @performance xezon 18/01/2026 The file contents are now read directly from a
 	* full File Ram buffer into the INI Line Buffer without a third buffer in between.
+	*
+	* TheSuperHackers @performance Lines that end with a new line within the line length limit are now
+	* terminated and tokenized in place in the File Ram buffer, without copying them. Only the last line
+	* without a new line and overlong lines still go through the INI Line Buffer.
 	*/
 //-------------------------------------------------------------------------------------------------
 void INI::readLine( void )
@@ -495,12 +502,47 @@ void INI::readLine( void )
 	// sanity
 	DEBUG_ASSERTCRASH( m_readBuffer, ("readLine(), read buffer is null") );
 
-	if (m_endOfFile)
+	const unsigned available = m_readBufferUsed - m_readBufferNext;
+	char *line = m_readBuffer + m_readBufferNext;
+	char *newLine = m_endOfFile ? nullptr
+		: static_cast<char *>(memchr(line, '\n', min<unsigned>(available, INI_MAX_CHARS_PER_LINE)));
+
+	if (newLine != nullptr)
 	{
+		m_line = line;
+		m_readBufferNext += (unsigned)(newLine - line) + 1;
+		*newLine = 0;
+
+		for (char *p = line; p != newLine; ++p)
+		{
+			DEBUG_ASSERTCRASH(*p != '\t', ("tab characters are not allowed in INI files (%s). please check your editor settings. Line Number %d", m_filename.str(), getLineNum()));
+
+			// if this is a semicolon, that represents the start of a comment
+			if (*p == ';')
+			{
+				*p = 0;
+				break;
+			}
+
+			// make whitespace characters actual spaces
+			else if (*p > 0 && *p < 32)
+			{
+				*p = ' ';
+			}
+		}
+
+		// increase our line count
+		m_lineNum++;
+	}
+	else if (m_endOfFile)
+	{
+		m_line = m_buffer;
 		*m_buffer = 0;
 	}
 	else
 	{
+		m_line = m_buffer;
+
 		// read up till the newline or semicolon character, or until out of space
 		char *p = m_buffer;
 		while (p != m_buffer+INI_MAX_CHARS_PER_LINE)
@@ -554,7 +596,7 @@ void INI::readLine( void )
 
 	if (s_xfer)
 	{
-		s_xfer->xferUser( m_buffer, sizeof( char ) * strlen( m_buffer ) );
+		s_xfer->xferUser( m_line, sizeof( char ) * strlen( m_line ) );
 		//DEBUG_LOG(("Xfer val is now 0x%8.8X in %s, line %s", ((XferCRC *)s_xfer)->getCRC(), m_filename.str(), m_buffer));
 	}
 }
@@ -1835,7 +1877,7 @@ void INI::initFromINIMulti( void *what, const MultiIniFieldParse& parseTableList
 		readLine();
 
 		// check for end token
-		const char* field = strtok( m_buffer, INI::getSeps() );
+		const char* field = strtok( m_line, INI::getSeps() );
 		if( field )
 		{
 
@@ -2361,23 +2403,18 @@ void INI::parseDeathTypeFlagsCustom(INI* ini, void* /*instance*/, void* store, c
 //-------------------------------------------------------------------------------------------------
 void INI::parseCustomTypes(INI* ini, void* /*instance*/, void* store, const void* /*userData*/)
 {
-	AsciiStringIntPair type;
 	CustomFlags* s = (CustomFlags*)store;
 	
 	for (const char *token = ini->getNextToken(); token != nullptr; token = ini->getNextTokenOrNull())
 	{
 		if (token[0] == '+')
 		{
-			type.first.format(token+1);
-			type.second = 1; //Required
-			s->push_back(type);
+			s->addRequired(TheNameKeyGenerator->nameToKey(token+1));
 			continue;
 		}
 		if (token[0] == '-')
 		{	
-			type.first.format(token+1);
-			type.second = 2; //Forbidden
-			s->push_back(type);
+			s->addForbidden(TheNameKeyGenerator->nameToKey(token+1));
 			continue;
 		}
 		throw INI_UNKNOWN_TOKEN;
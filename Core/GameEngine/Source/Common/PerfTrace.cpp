@@ -0,0 +1,273 @@
+/*
+**	Command & Conquer Generals Zero Hour(tm)
+**	Copyright 2026 TheSuperHackers
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// FILE: PerfTrace.cpp ////////////////////////////////////////////////////////////////////////////
+// Desc:   Records USE_PERF_TIMER scopes and logic frames, and writes them as Chrome trace events
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "PreRTS.h"	// This must go first in EVERY cpp file in the GameEngine
+
+#include "Common/PerfTrace.h"
+
+#include "Common/CriticalSection.h"
+
+#ifndef _WIN32
+#include <time.h>
+#endif
+
+#ifdef _MSC_VER
+#define PERF_TRACE_THREAD_LOCAL __declspec(thread)
+#else
+#define PERF_TRACE_THREAD_LOCAL __thread
+#endif
+
+// PRIVATE TYPES //////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+
+enum { FRAME_MARKER = -1 };
+
+struct TraceEvent
+{
+	const char *name;
+	Int64 startTicks;
+	Int64 durationTicks;	///< FRAME_MARKER for frame markers
+	UnsignedInt frame;
+};
+
+//-------------------------------------------------------------------------------------------------
+/** The events of one thread. Only the owning thread adds events, so that needs no lock. */
+//-------------------------------------------------------------------------------------------------
+struct ThreadBuffer
+{
+	enum { MAX_EVENTS = 8192 };
+
+	TraceEvent events[MAX_EVENTS];
+	Int count;
+	Int threadIndex;
+	ThreadBuffer *next;
+};
+
+} // namespace
+
+// PRIVATE DATA ///////////////////////////////////////////////////////////////////////////////////
+
+Bool PerfTrace::s_recording = FALSE;
+
+static CriticalSection s_fileCriticalSection;	///< guards the file and the buffer list
+static FILE *s_file = nullptr;
+static ThreadBuffer *s_buffers = nullptr;
+static Int s_threadCount = 0;
+static UnsignedInt s_recordingIndex = 0;			///< tells the buffers of earlier recordings apart
+static UnsignedInt s_frame = 0;
+static Int64 s_startTicks = 0;
+static Int64 s_minDurationTicks = 0;
+static double s_microsecondsPerTick = 1.0;
+static Bool s_firstEvent = TRUE;
+
+static PERF_TRACE_THREAD_LOCAL ThreadBuffer *t_buffer = nullptr;
+static PERF_TRACE_THREAD_LOCAL UnsignedInt t_recordingIndex = 0;
+
+// PRIVATE FUNCTIONS //////////////////////////////////////////////////////////////////////////////
+
+//-------------------------------------------------------------------------------------------------
+static void writeEvent( const TraceEvent &event, Int threadIndex )
+{
+	const double ts = (double)(event.startTicks - s_startTicks) * s_microsecondsPerTick;
+
+	fputs(s_firstEvent ? "\n" : ",\n", s_file);
+	s_firstEvent = FALSE;
+
+	if (event.durationTicks == FRAME_MARKER)
+	{
+		fprintf(s_file, "{\"name\":\"Frame %u\",\"ph\":\"i\",\"s\":\"g\",\"ts\":%.3f,\"pid\":1,\"tid\":%d}",
+			event.frame, ts, threadIndex);
+	}
+	else
+	{
+		fprintf(s_file, "{\"name\":\"%s\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":1,\"tid\":%d,\"args\":{\"frame\":%u}}",
+			event.name, ts, (double)event.durationTicks * s_microsecondsPerTick, threadIndex, event.frame);
+	}
+}
+
+//-------------------------------------------------------------------------------------------------
+/** Writes the events of the buffer and empties it. The file lock must be held. */
+//-------------------------------------------------------------------------------------------------
+static void flushBuffer( ThreadBuffer *buffer )
+{
+	if (s_file != nullptr)
+	{
+		for (Int i = 0; i < buffer->count; ++i)
+			writeEvent(buffer->events[i], buffer->threadIndex);
+	}
+	buffer->count = 0;
+}
+
+//-------------------------------------------------------------------------------------------------
+static ThreadBuffer *getThreadBuffer()
+{
+	if (t_recordingIndex == s_recordingIndex && t_buffer != nullptr)
+		return t_buffer;
+
+	ScopedCriticalSection lock(&s_fileCriticalSection);
+
+	ThreadBuffer *buffer = new ThreadBuffer;
+	buffer->count = 0;
+	buffer->threadIndex = ++s_threadCount;
+	buffer->next = s_buffers;
+	s_buffers = buffer;
+
+	if (s_file != nullptr)
+	{
+		fputs(s_firstEvent ? "\n" : ",\n", s_file);
+		s_firstEvent = FALSE;
+
+		if (buffer->threadIndex == 1)
+			fprintf(s_file, "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":1,\"args\":{\"name\":\"Main\"}}");
+		else
+			fprintf(s_file, "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":\"Worker %d\"}}",
+				buffer->threadIndex, buffer->threadIndex - 1);
+	}
+
+	t_buffer = buffer;
+	t_recordingIndex = s_recordingIndex;
+	return buffer;
+}
+
+//-------------------------------------------------------------------------------------------------
+static void addEvent( const char *name, Int64 startTicks, Int64 durationTicks )
+{
+	ThreadBuffer *buffer = getThreadBuffer();
+
+	if (buffer->count == ThreadBuffer::MAX_EVENTS)
+	{
+		ScopedCriticalSection lock(&s_fileCriticalSection);
+		flushBuffer(buffer);
+	}
+
+	TraceEvent &event = buffer->events[buffer->count++];
+	event.name = name;
+	event.startTicks = startTicks;
+	event.durationTicks = durationTicks;
+	event.frame = s_frame;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// PUBLIC METHODS /////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+//-------------------------------------------------------------------------------------------------
+Bool PerfTrace::open( const char *filename, Int minMicroseconds )
+{
+	close();
+
+	{
+		ScopedCriticalSection lock(&s_fileCriticalSection);
+
+		s_file = fopen(filename, "w");
+		if (s_file == nullptr)
+		{
+			DEBUG_LOG(("PerfTrace::open - Unable to open '%s'", filename));
+			return FALSE;
+		}
+
+	#ifdef _WIN32
+		LARGE_INTEGER freq;
+		QueryPerformanceFrequency(&freq);
+		s_microsecondsPerTick = 1000000.0 / (double)freq.QuadPart;
+	#else
+		s_microsecondsPerTick = 0.001;
+	#endif
+
+		s_minDurationTicks = (Int64)(minMicroseconds / s_microsecondsPerTick);
+
+		fputs("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[", s_file);
+
+		++s_recordingIndex;
+		s_threadCount = 0;
+		s_frame = 0;
+		s_firstEvent = TRUE;
+		s_startTicks = getTicks();
+		s_recording = TRUE;
+	}
+
+	// the calling thread comes first and is named the main thread
+	getThreadBuffer();
+
+	return TRUE;
+}
+
+//-------------------------------------------------------------------------------------------------
+void PerfTrace::close()
+{
+	ScopedCriticalSection lock(&s_fileCriticalSection);
+
+	s_recording = FALSE;
+
+	while (s_buffers != nullptr)
+	{
+		ThreadBuffer *buffer = s_buffers;
+		s_buffers = buffer->next;
+		flushBuffer(buffer);
+		delete buffer;
+	}
+
+	// the threads get a new buffer on the next recording
+	++s_recordingIndex;
+
+	if (s_file != nullptr)
+	{
+		fputs("\n]}\n", s_file);
+		fclose(s_file);
+		s_file = nullptr;
+	}
+}
+
+//-------------------------------------------------------------------------------------------------
+Int64 PerfTrace::getTicks()
+{
+#ifdef _WIN32
+	LARGE_INTEGER ticks;
+	QueryPerformanceCounter(&ticks);
+	return ticks.QuadPart;
+#else
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (Int64)ts.tv_sec * 1000000000 + ts.tv_nsec;
+#endif
+}
+
+//-------------------------------------------------------------------------------------------------
+void PerfTrace::addScope( const char *name, Int64 startTicks, Int64 endTicks )
+{
+	if (endTicks - startTicks < s_minDurationTicks)
+		return;
+
+	addEvent(name, startTicks, endTicks - startTicks);
+}
+
+//-------------------------------------------------------------------------------------------------
+void PerfTrace::markFrame( UnsignedInt frame )
+{
+	if (!s_recording)
+		return;
+
+	s_frame = frame;
+	addEvent(nullptr, getTicks(), FRAME_MARKER);
+}
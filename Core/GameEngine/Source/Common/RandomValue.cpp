@@ -148,6 +148,19 @@ UnsignedInt GetGameLogicRandomSeedCRC( void )
 	return c.get();
 }
 
+void GetGameLogicRandomState( GameLogicRandomState *state )
+{
+	static_assert(sizeof(state->seed) == sizeof(theGameLogicSeed), "Incorrect array size");
+	memcpy(state->seed, theGameLogicSeed, sizeof(theGameLogicSeed));
+	state->baseSeed = theGameLogicBaseSeed;
+}
+
+void SetGameLogicRandomState( const GameLogicRandomState *state )
+{
+	memcpy(theGameLogicSeed, state->seed, sizeof(theGameLogicSeed));
+	theGameLogicBaseSeed = state->baseSeed;
+}
+
 void InitRandom( void )
 {
 #ifdef DETERMINISTIC
@@ -27,6 +27,10 @@
 #include "GameLogic/GameLogic.h"
 #include "GameClient/GameClient.h"
 
+#ifndef _WIN32
+#include <unistd.h>
+#endif
+
 
 Bool ReplaySimulation::s_isRunning = false;
 UnsignedInt ReplaySimulation::s_replayIndex = 0;
@@ -34,16 +38,69 @@ UnsignedInt ReplaySimulation::s_replayCount = 0;
 
 namespace
 {
-int countProcessesRunning(const std::vector<WorkerProcess>& processes)
+struct ReplayResult
+{
+	AsciiString filename;
+	size_t index;									///< position in the list of replays
+	UnsignedInt frameCount;				///< frame count from the replay header, 0 if it could not be read
+	UnsignedInt startTimeMillis;
+	UnsignedInt timeMillis;
+	int exitcode;
+};
+
+UnsignedInt readReplayFrameCount(const AsciiString& filename)
+{
+	RecorderClass::ReplayHeader header;
+	header.forPlayback = FALSE;
+	header.filename = filename;
+	if (!TheRecorder->readReplayHeader(header))
+		return 0;
+	return header.frameCount;
+}
+
+// Longest replays go first, so that the last replays to start are the short ones and
+// the wall time is not bounded by a long replay that started late. Ties keep the list order.
+bool isLongerReplay(const ReplayResult* a, const ReplayResult* b)
+{
+	if (a->frameCount != b->frameCount)
+		return a->frameCount > b->frameCount;
+	return a->index < b->index;
+}
+
+// Write one line per replay as CSV, in the order the replays were passed in
+void writeReplaySummary(const std::vector<ReplayResult>& results, UnsignedInt totalTimeMillis)
 {
-	int numProcessesRunning = 0;
-	size_t i = 0;
-	for (; i < processes.size(); ++i)
+	const AsciiString& summaryFile = TheGlobalData->m_simulateReplaySummaryFile;
+	if (summaryFile.isEmpty())
+		return;
+
+	FILE *fp = fopen(summaryFile.str(), "w");
+	if (fp == nullptr)
 	{
-		if (processes[i].isRunning())
-			++numProcessesRunning;
+		printf("Cannot write replay summary \"%s\"\n", summaryFile.str());
+		return;
 	}
-	return numProcessesRunning;
+
+	fprintf(fp, "replay,frames,seconds,fps,exitcode\n");
+	for (size_t i = 0; i < results.size(); ++i)
+	{
+		const ReplayResult& result = results[i];
+		const double seconds = result.timeMillis / 1000.0;
+		const double fps = result.timeMillis != 0 ? result.frameCount / seconds : 0.0;
+
+		// Quote the filename and double any quotes in it
+		fputc('"', fp);
+		for (const char *c = result.filename.str(); *c; ++c)
+		{
+			if (*c == '"')
+				fputc('"', fp);
+			fputc(*c, fp);
+		}
+		fprintf(fp, "\",%u,%.3f,%.1f,%d\n", result.frameCount, seconds, fps, result.exitcode);
+	}
+	fprintf(fp, "\"total\",,%.3f,,\n", totalTimeMillis / 1000.0);
+
+	fclose(fp);
 }
 } // namespace
 
@@ -75,14 +132,22 @@ int ReplaySimulation::simulateReplaysInThisProcess(const std::vector<AsciiString
 	}
 	// Note that we use printf here because this is run from cmd.
 	DWORD totalStartTimeMillis = GetTickCount();
+	std::vector<ReplayResult> results(filenames.size());
 	for (size_t i = 0; i < filenames.size(); i++)
 	{
 		AsciiString filename = filenames[i];
 		printf("Simulating Replay \"%s\"\n", filename.str());
 		fflush(stdout);
 		DWORD startTimeMillis = GetTickCount();
+		const int numErrorsBefore = numErrors;
+		ReplayResult& result = results[i];
+		result.filename = filename;
+		result.index = i;
+		result.frameCount = 0;
+		result.startTimeMillis = startTimeMillis;
 		if (TheRecorder->simulateReplay(filename))
 		{
+			result.frameCount = TheRecorder->getPlaybackFrameCount();
 			UnsignedInt totalTimeSec = TheRecorder->getPlaybackFrameCount() / LOGICFRAMES_PER_SECOND;
 			while (TheRecorder->isPlaybackInProgress())
 			{
@@ -98,6 +163,7 @@ int ReplaySimulation::simulateReplaysInThisProcess(const std::vector<AsciiString
 							realTimeSec/60, realTimeSec%60, gameTimeSec/60, gameTimeSec%60, totalTimeSec/60, totalTimeSec%60);
 					fflush(stdout);
 				}
+				TheRecorder->updateSnapshots();
 				TheGameLogic->UPDATE();
 				if (TheRecorder->sawCRCMismatch())
 				{
@@ -116,6 +182,8 @@ int ReplaySimulation::simulateReplaysInThisProcess(const std::vector<AsciiString
 			printf("Cannot open replay\n");
 			numErrors++;
 		}
+		result.timeMillis = GetTickCount() - startTimeMillis;
+		result.exitcode = numErrors != numErrorsBefore ? 1 : 0;
 	}
 	if (filenames.size() > 1)
 	{
@@ -126,6 +194,8 @@ int ReplaySimulation::simulateReplaysInThisProcess(const std::vector<AsciiString
 		fflush(stdout);
 	}
 
+	writeReplaySummary(results, GetTickCount() - totalStartTimeMillis);
+
 	return numErrors != 0 ? 1 : 0;
 }
 
@@ -133,66 +203,123 @@ int ReplaySimulation::simulateReplaysInWorkerProcesses(const std::vector<AsciiSt
 {
 	DWORD totalStartTimeMillis = GetTickCount();
 
+#ifdef _WIN32
 	WideChar exePath[1024];
 	GetModuleFileNameW(nullptr, exePath, ARRAY_SIZE(exePath));
+#else
+	char exePath[1024];
+	const ssize_t exePathLength = readlink("/proc/self/exe", exePath, ARRAY_SIZE(exePath)-1);
+	exePath[exePathLength > 0 ? exePathLength : 0] = 0;
+#endif
 
-	std::vector<WorkerProcess> processes;
-	int filenamePositionStarted = 0;
-	int filenamePositionDone = 0;
+	// TheSuperHackers @performance Hand out the replays longest first to whichever worker is free.
+	// The replay header gives us the frame count without simulating anything.
+	std::vector<ReplayResult> results(filenames.size());
+	std::vector<ReplayResult*> queue(filenames.size());
+	size_t i;
+	for (i = 0; i < filenames.size(); i++)
+	{
+		ReplayResult& result = results[i];
+		result.filename = filenames[i];
+		result.index = i;
+		result.frameCount = readReplayFrameCount(filenames[i]);
+		result.startTimeMillis = 0;
+		result.timeMillis = 0;
+		result.exitcode = 0;
+		queue[i] = &result;
+	}
+	std::sort(queue.begin(), queue.end(), isLongerReplay);
+
+	std::vector<WorkerProcess> processes(maxProcesses);
+	std::vector<ReplayResult*> processResults(maxProcesses, (ReplayResult*)nullptr);
+	size_t queuePosition = 0;
+	int numDone = 0;
 	int numErrors = 0;
 
 	while (true)
 	{
-		int i;
+		int numProcessesRunning = 0;
+
 		for (i = 0; i < processes.size(); i++)
+		{
+			ReplayResult* result = processResults[i];
+			if (result == nullptr)
+				continue;
+
 			processes[i].update();
+			if (!processes[i].isDone())
+			{
+				++numProcessesRunning;
+				continue;
+			}
 
-		// Get result of finished processes and print output in order
-		while (!processes.empty())
-		{
-			if (!processes[0].isDone())
-				break;
-			AsciiString stdOutput = processes[0].getStdOutput();
-			printf("%d/%d %s", filenamePositionDone+1, (int)filenames.size(), stdOutput.str());
-			DWORD exitcode = processes[0].getExitCode();
-			if (exitcode != 0)
+			// Print the output of finished processes as soon as they are done
+			result->timeMillis = GetTickCount() - result->startTimeMillis;
+			result->exitcode = processes[i].getExitCode();
+			AsciiString stdOutput = processes[i].getStdOutput();
+			printf("%d/%d %s", numDone+1, (int)filenames.size(), stdOutput.str());
+			if (result->exitcode != 0)
 				printf("Error!\n");
 			fflush(stdout);
-			numErrors += exitcode == 0 ? 0 : 1;
-			processes.erase(processes.begin());
-			filenamePositionDone++;
+			numErrors += result->exitcode == 0 ? 0 : 1;
+			numDone++;
+			processResults[i] = nullptr;
 		}
 
-		int numProcessesRunning = countProcessesRunning(processes);
-
-		// Add new processes when we are below the limit and there are replays left
-		while (numProcessesRunning < maxProcesses && filenamePositionStarted < filenames.size())
+		// Give idle workers the next replay while there are replays left
+		for (i = 0; i < processes.size() && queuePosition < queue.size(); i++)
 		{
+			if (processResults[i] != nullptr)
+				continue;
+
+			ReplayResult* result = queue[queuePosition++];
+			result->startTimeMillis = GetTickCount();
+
+#ifdef _WIN32
 			UnicodeString filenameWide;
-			filenameWide.translate(filenames[filenamePositionStarted]);
+			filenameWide.translate(result->filename);
 			UnicodeString command;
 			command.format(L"\"%s\"%s%s -replay \"%s\"",
 				exePath,
 				TheGlobalData->m_windowed ? L" -win" : L"",
 				TheGlobalData->m_headless ? L" -headless" : L"",
 				filenameWide.str());
+			const bool started = processes[i].startProcess(command);
+#else
+			std::vector<AsciiString> args;
+			args.push_back(exePath);
+			if (TheGlobalData->m_windowed)
+				args.push_back("-win");
+			if (TheGlobalData->m_headless)
+				args.push_back("-headless");
+			args.push_back("-replay");
+			args.push_back(result->filename);
+			const bool started = processes[i].startProcess(args);
+#endif
 
-			processes.push_back(WorkerProcess());
-			processes.back().startProcess(command);
+			if (!started)
+			{
+				printf("%d/%d Cannot start worker process for replay \"%s\"\nError!\n", numDone+1, (int)filenames.size(), result->filename.str());
+				fflush(stdout);
+				result->exitcode = 1;
+				numErrors++;
+				numDone++;
+				continue;
+			}
 
-			filenamePositionStarted++;
-			numProcessesRunning++;
+			processResults[i] = result;
+			++numProcessesRunning;
 		}
 
-		if (processes.empty())
+		if (numProcessesRunning == 0 && queuePosition == queue.size())
 			break;
 
 		// Don't waste CPU here, our workers need every bit of CPU time they can get
 		Sleep(100);
 	}
 
-	DEBUG_ASSERTCRASH(filenamePositionStarted == filenames.size(), ("inconsistent file position 1"));
-	DEBUG_ASSERTCRASH(filenamePositionDone == filenames.size(), ("inconsistent file position 2"));
+	DEBUG_ASSERTCRASH(queuePosition == filenames.size(), ("inconsistent file position 1"));
+	DEBUG_ASSERTCRASH(numDone == filenames.size(), ("inconsistent file position 2"));
 
 	printf("Simulation of all replays completed. Errors occurred: %d\n", numErrors);
 
@@ -200,6 +327,8 @@ int ReplaySimulation::simulateReplaysInWorkerProcesses(const std::vector<AsciiSt
 	printf("Total Wall Time: %d:%02d:%02d\n", realTime/60/60, realTime/60%60, realTime%60);
 	fflush(stdout);
 
+	writeReplaySummary(results, GetTickCount() - totalStartTimeMillis);
+
 	return numErrors != 0 ? 1 : 0;
 }
 
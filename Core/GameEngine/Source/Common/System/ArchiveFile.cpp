@@ -83,6 +83,8 @@ static Bool SearchStringMatches(AsciiString str, AsciiString searchString)
 
 ArchiveFile::~ArchiveFile()
 {
+	m_mapping.close();
+
 	if (m_file != nullptr) {
 		m_file->close();
 		m_file = nullptr;
@@ -190,6 +192,14 @@ void ArchiveFile::attachFile(File *file)
 		m_file = nullptr;
 	}
 	m_file = file;
+
+	m_mapping.close();
+#if USE_MAPPED_ARCHIVE_FILES
+	if (m_file != nullptr) {
+		// TheSuperHackers @performance Files opened from a mapped archive refer to the mapped data instead of copying it.
+		m_mapping.open(m_file->getName());
+	}
+#endif
 }
 
 const ArchivedFileInfo * ArchiveFile::getArchivedFileInfo(const AsciiString& filename) const
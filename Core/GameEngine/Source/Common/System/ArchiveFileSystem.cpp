@@ -92,7 +92,114 @@ ArchiveFileSystem *TheArchiveFileSystem = nullptr;
 //         Private Functions
 //----------------------------------------------------------------------------
 
+//------------------------------------------------------
+// FNV-1a
+//------------------------------------------------------
+UnsignedInt ArchiveFileSystem::hashArchivedPath(const Char *path, Int length)
+{
+	UnsignedInt hash = 2166136261u;
+	for (Int i = 0; i < length; ++i)
+	{
+		hash ^= (unsigned char)path[i];
+		hash *= 16777619u;
+	}
+	return hash;
+}
+
+//------------------------------------------------------
+/** Writes the path the way loadIntoDirectoryTree builds it: lower case, joined with backslashes,
+	* and ending with the last token that contains a dot, because getArchivedDirectoryInfo takes
+	* that token as the file name and ignores the tokens after it. */
+//------------------------------------------------------
+Int ArchiveFileSystem::normalizeArchivedPath(const Char *filename, Char *buffer, Int bufferSize)
+{
+	Int length = 0;
+	Int fileNameEnd = -1;
+	const Char *c = filename;
+
+	for (;;)
+	{
+		while (*c == '\\' || *c == '/')
+			++c;
+
+		if (*c == '\0')
+			break;
+
+		if (length > 0)
+		{
+			if (length >= bufferSize)
+				return -1;
+			buffer[length++] = '\\';
+		}
+
+		Bool hasDot = FALSE;
+		while (*c != '\0' && *c != '\\' && *c != '/')
+		{
+			if (length >= bufferSize)
+				return -1;
+			hasDot |= (*c == '.');
+			buffer[length++] = tolower(*c);
+			++c;
+		}
+
+		if (hasDot)
+			fileNameEnd = length;
+	}
+
+	if (fileNameEnd < 0 || fileNameEnd >= bufferSize)
+		return -1;
+
+	buffer[fileNameEnd] = '\0';
+	return fileNameEnd;
+}
+
+//------------------------------------------------------
+/** The file must not be in the index yet. */
+//------------------------------------------------------
+void ArchiveFileSystem::addToFileIndex(ArchivedDirectoryInfo *dirInfo, const AsciiString& fileName)
+{
+	// Keep the load factor at most one half, so that the probe sequences stay short
+	if ((m_fileIndexCount + 1) * 2 > (Int)m_fileIndex.size())
+		growFileIndex();
+
+	ArchivedFileIndexEntry entry;
+	entry.path = dirInfo->m_path;
+	entry.path.concat(fileName);
+	entry.hash = hashArchivedPath(entry.path.str(), entry.path.getLength());
+	entry.dirInfo = dirInfo;
+	entry.fileName = fileName;
+
+	const UnsignedInt mask = m_fileIndex.size() - 1;
+	UnsignedInt slot = entry.hash & mask;
+	while (m_fileIndex[slot].dirInfo != nullptr)
+		slot = (slot + 1) & mask;
+
+	m_fileIndex[slot] = entry;
+	++m_fileIndexCount;
+}
 
+//------------------------------------------------------
+void ArchiveFileSystem::growFileIndex()
+{
+	ArchivedFileIndex oldIndex;
+	oldIndex.swap(m_fileIndex);
+
+	// The size must stay a power of two for the mask
+	m_fileIndex.resize(oldIndex.empty() ? 1024 : oldIndex.size() * 2);
+
+	const UnsignedInt mask = m_fileIndex.size() - 1;
+	for (ArchivedFileIndex::const_iterator it = oldIndex.begin(); it != oldIndex.end(); ++it)
+	{
+		if (it->dirInfo == nullptr)
+			continue;
+
+		UnsignedInt slot = it->hash & mask;
+		while (m_fileIndex[slot].dirInfo != nullptr)
+			slot = (slot + 1) & mask;
+
+		m_fileIndex[slot] = *it;
+	}
+}
 
 //----------------------------------------------------------------------------
 //         Public Functions
@@ -102,6 +209,7 @@ ArchiveFileSystem *TheArchiveFileSystem = nullptr;
 // ArchivedFileInfo
 //------------------------------------------------------
 ArchiveFileSystem::ArchiveFileSystem()
+	: m_fileIndexCount(0)
 {
 }
 
@@ -154,6 +262,11 @@ void ArchiveFileSystem::loadIntoDirectoryTree(ArchiveFile *archiveFile, Bool ove
 			infoInPath = tokenizer.nextToken(&token, "\\/");
 		}
 
+		if (!token.isEmpty() && dirInfo->m_files.find(token) == dirInfo->m_files.end())
+		{
+			addToFileIndex(dirInfo, token);
+		}
+
 		ArchivedFileLocationMap::iterator fileIt;
 		if (overwrite)
 		{
@@ -240,7 +353,7 @@ void ArchiveFileSystem::loadMods()
 
 Bool ArchiveFileSystem::doesFileExist(const Char *filename, FileInstance instance) const
 {
-	ArchivedDirectoryInfoResult result = const_cast<ArchiveFileSystem*>(this)->getArchivedDirectoryInfo(filename);
+	ArchivedDirectoryInfoResult result = getArchivedFileDirectoryInfo(filename);
 
 	if (!result.valid())
 		return false;
@@ -289,6 +402,39 @@ ArchiveFileSystem::ArchivedDirectoryInfoResult ArchiveFileSystem::getArchivedDir
 	return result;
 }
 
+ArchiveFileSystem::ArchivedDirectoryInfoResult ArchiveFileSystem::getArchivedFileDirectoryInfo(const Char* filename) const
+{
+	Char path[_MAX_PATH];
+	const Int length = normalizeArchivedPath(filename, path, ARRAY_SIZE(path));
+
+	if (length < 0)
+	{
+		// Not a file path the index knows, so walk the tree as before
+		return const_cast<ArchiveFileSystem*>(this)->getArchivedDirectoryInfo(filename);
+	}
+
+	ArchivedDirectoryInfoResult result;
+
+	if (m_fileIndexCount == 0)
+		return result;
+
+	const UnsignedInt hash = hashArchivedPath(path, length);
+	const UnsignedInt mask = m_fileIndex.size() - 1;
+
+	for (UnsignedInt slot = hash & mask; m_fileIndex[slot].dirInfo != nullptr; slot = (slot + 1) & mask)
+	{
+		const ArchivedFileIndexEntry &entry = m_fileIndex[slot];
+		if (entry.hash == hash && entry.path.getLength() == length && memcmp(entry.path.str(), path, length) == 0)
+		{
+			result.dirInfo = entry.dirInfo;
+			result.lastToken = entry.fileName;
+			break;
+		}
+	}
+
+	return result;
+}
+
 File * ArchiveFileSystem::openFile(const Char *filename, Int access, FileInstance instance)
 {
 	ArchiveFile* archive = getArchiveFile(filename, instance);
@@ -319,7 +465,7 @@ Bool ArchiveFileSystem::getFileInfo(const AsciiString& filename, FileInfo *fileI
 
 ArchiveFile* ArchiveFileSystem::getArchiveFile(const AsciiString& filename, FileInstance instance) const
 {
-	ArchivedDirectoryInfoResult result = const_cast<ArchiveFileSystem*>(this)->getArchivedDirectoryInfo(filename.str());
+	ArchivedDirectoryInfoResult result = getArchivedFileDirectoryInfo(filename.str());
 
 	if (!result.valid())
 		return nullptr;
@@ -0,0 +1,182 @@
+/*
+**	Command & Conquer Generals Zero Hour(tm)
+**	Copyright 2026 TheSuperHackers
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// FILE: FileMapping.cpp //////////////////////////////////////////////////////////////////////////
+// Desc:   Read only memory mapping of a file on disk
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "PreRTS.h"	// This must go first in EVERY cpp file in the GameEngine
+
+#include "Common/FileMapping.h"
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+//-------------------------------------------------------------------------------------------------
+FileMapping::FileMapping()
+#ifdef _WIN32
+	: m_mappingHandle(nullptr)
+#else
+	: m_fileDescriptor(-1)
+#endif
+	, m_fileSize(0)
+{
+}
+
+//-------------------------------------------------------------------------------------------------
+FileMapping::~FileMapping()
+{
+	close();
+}
+
+//-------------------------------------------------------------------------------------------------
+Bool FileMapping::open( const Char *filename )
+{
+	close();
+
+#ifdef _WIN32
+	HANDLE fileHandle = CreateFileA(filename, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (fileHandle == INVALID_HANDLE_VALUE)
+		return FALSE;
+
+	DWORD sizeHigh = 0;
+	const DWORD sizeLow = GetFileSize(fileHandle, &sizeHigh);
+
+	// The mapping keeps the file open on its own
+	HANDLE mappingHandle = nullptr;
+	if (sizeLow != INVALID_FILE_SIZE && sizeHigh == 0 && sizeLow != 0)
+		mappingHandle = CreateFileMappingA(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+
+	CloseHandle(fileHandle);
+
+	if (mappingHandle == nullptr)
+		return FALSE;
+
+	m_mappingHandle = mappingHandle;
+	m_fileSize = sizeLow;
+#else
+	const int fileDescriptor = ::open(filename, O_RDONLY);
+	if (fileDescriptor < 0)
+		return FALSE;
+
+	struct stat fileStat;
+	if (fstat(fileDescriptor, &fileStat) != 0 || fileStat.st_size <= 0 || (UnsignedInt64)fileStat.st_size > 0xFFFFFFFFu)
+	{
+		::close(fileDescriptor);
+		return FALSE;
+	}
+
+	m_fileDescriptor = fileDescriptor;
+	m_fileSize = (UnsignedInt)fileStat.st_size;
+#endif
+
+	return TRUE;
+}
+
+//-------------------------------------------------------------------------------------------------
+void FileMapping::close()
+{
+#ifdef _WIN32
+	if (m_mappingHandle != nullptr)
+	{
+		CloseHandle(m_mappingHandle);
+		m_mappingHandle = nullptr;
+	}
+#else
+	if (m_fileDescriptor >= 0)
+	{
+		::close(m_fileDescriptor);
+		m_fileDescriptor = -1;
+	}
+#endif
+	m_fileSize = 0;
+}
+
+//-------------------------------------------------------------------------------------------------
+Bool FileMapping::isOpen() const
+{
+#ifdef _WIN32
+	return m_mappingHandle != nullptr;
+#else
+	return m_fileDescriptor >= 0;
+#endif
+}
+
+//-------------------------------------------------------------------------------------------------
+Bool FileMapping::mapView( View &view, UnsignedInt offset, UnsignedInt size ) const
+{
+	if (!isOpen() || size == 0 || offset > m_fileSize || size > m_fileSize - offset)
+		return FALSE;
+
+	// Views must start on the allocation granularity
+	const UnsignedInt viewOffset = offset - (offset % getGranularity());
+	const size_t viewLength = (size_t)(offset - viewOffset) + size;
+
+#ifdef _WIN32
+	void *base = MapViewOfFile(m_mappingHandle, FILE_MAP_READ, 0, viewOffset, viewLength);
+	if (base == nullptr)
+		return FALSE;
+#else
+	void *base = mmap(nullptr, viewLength, PROT_READ, MAP_PRIVATE, m_fileDescriptor, viewOffset);
+	if (base == MAP_FAILED)
+		return FALSE;
+#endif
+
+	view.base = base;
+	view.length = viewLength;
+	view.data = static_cast<const Char *>(base) + (offset - viewOffset);
+	return TRUE;
+}
+
+//-------------------------------------------------------------------------------------------------
+void FileMapping::unmapView( View &view )
+{
+	if (view.base == nullptr)
+		return;
+
+#ifdef _WIN32
+	UnmapViewOfFile(view.base);
+#else
+	munmap(view.base, view.length);
+#endif
+
+	view = View();
+}
+
+//-------------------------------------------------------------------------------------------------
+UnsignedInt FileMapping::getGranularity()
+{
+	static UnsignedInt granularity = 0;
+
+	if (granularity == 0)
+	{
+#ifdef _WIN32
+		SYSTEM_INFO systemInfo;
+		GetSystemInfo(&systemInfo);
+		granularity = systemInfo.dwAllocationGranularity;
+#else
+		granularity = (UnsignedInt)sysconf(_SC_PAGESIZE);
+#endif
+	}
+
+	return granularity;
+}
@@ -329,6 +329,68 @@ static void doStackDump(void **stacktrace, int size)
 // PRIVATE TYPES
 // ----------------------------------------------------------------------------
 
+#ifdef MEMORYPOOL_MAGAZINES
+
+#ifdef _MSC_VER
+#define MEMORYPOOL_THREAD_LOCAL __declspec(thread)
+#else
+#define MEMORYPOOL_THREAD_LOCAL __thread
+#endif
+
+// ----------------------------------------------------------------------------
+/**
+	A stack of free blocks of one pool that only one thread uses, so that it needs no lock.
+	When it runs empty, it takes BATCH_SIZE blocks from the pool, and when it runs full, it
+	gives BATCH_SIZE blocks back, both under the lock. The blocks in a magazine still count
+	as used for the pool.
+*/
+struct MemoryPoolMagazine
+{
+	enum
+	{
+		MAX_BLOCKS = 32,
+		BATCH_SIZE = MAX_BLOCKS / 2
+	};
+
+	Int count;
+	void *blocks[MAX_BLOCKS];
+};
+
+// ----------------------------------------------------------------------------
+/**
+	The magazines of one thread, indexed by MemoryPool::m_magazineIndex. All of them are linked
+	into theFirstThreadCache, so that a pool can discard its blocks in other threads when it is
+	reset or destroyed. Only threads that called initMemoryManagerThreadCache() have one, so
+	that threads which never release it do not keep blocks in magazines after they end.
+*/
+struct MemoryPoolThreadCache
+{
+	enum
+	{
+		MAX_POOLS = 1024	///< pools created after this many do not get magazines
+	};
+
+	MemoryPoolThreadCache *next;
+	MemoryPoolMagazine *magazines[MAX_POOLS];
+};
+
+static MEMORYPOOL_THREAD_LOCAL MemoryPoolThreadCache *theThreadCache = nullptr;
+static MemoryPoolThreadCache *theFirstThreadCache = nullptr;						///< guarded by TheMemoryPoolCriticalSection
+static MemoryPool *theMagazinePools[MemoryPoolThreadCache::MAX_POOLS];		///< guarded by TheMemoryPoolCriticalSection
+static Int theNextMagazineIndex = 0;
+
+//-----------------------------------------------------------------------------
+static inline void interlockedAdd(Int *value, Int delta)
+{
+#ifdef _WIN32
+	InterlockedExchangeAdd((volatile LONG *)value, delta);
+#else
+	__sync_fetch_and_add(value, delta);
+#endif
+}
+
+#endif // MEMORYPOOL_MAGAZINES
+
 // ----------------------------------------------------------------------------
 #ifdef MEMORYPOOL_CHECKPOINTING
 /**
@@ -1508,6 +1570,9 @@ MemoryPool::MemoryPool() :
 	m_firstBlob(nullptr),
 	m_lastBlob(nullptr),
 	m_firstBlobWithFreeBlocks(nullptr)
+#ifdef MEMORYPOOL_MAGAZINES
+	, m_magazineIndex(-1)
+#endif
 {
 }
 
@@ -1530,6 +1595,19 @@ void MemoryPool::init(MemoryPoolFactory *factory, const char *poolName, Int allo
 	m_lastBlob = nullptr;
 	m_firstBlobWithFreeBlocks = nullptr;
 
+#ifdef MEMORYPOOL_MAGAZINES
+	// pools that cannot grow get no magazines, so that no thread runs out while others hold spare blocks.
+	if (m_magazineIndex < 0 && m_overflowAllocationCount > 0)
+	{
+		ScopedCriticalSection scopedCriticalSection(TheMemoryPoolCriticalSection);
+		if (theNextMagazineIndex < MemoryPoolThreadCache::MAX_POOLS)
+		{
+			m_magazineIndex = theNextMagazineIndex++;
+			theMagazinePools[m_magazineIndex] = this;
+		}
+	}
+#endif
+
 	// go ahead and init the initial block here (will throw on failure)
 	createBlob(m_initialAllocationCount);
 }
@@ -1540,6 +1618,15 @@ void MemoryPool::init(MemoryPoolFactory *factory, const char *poolName, Int allo
 */
 MemoryPool::~MemoryPool()
 {
+#ifdef MEMORYPOOL_MAGAZINES
+	if (m_magazineIndex >= 0)
+	{
+		ScopedCriticalSection scopedCriticalSection(TheMemoryPoolCriticalSection);
+		discardMagazines();
+		theMagazinePools[m_magazineIndex] = nullptr;	// the index is never handed out again
+	}
+#endif
+
 	// toss everything. we could do this slightly more efficiently,
 	// but not really worth the extra code to do so.
 	while (m_firstBlob)
@@ -1628,8 +1715,28 @@ Int MemoryPool::freeBlob(MemoryPoolBlob* blob)
 */
 void* MemoryPool::allocateBlockDoNotZeroImplementation(DECLARE_LITERALSTRING_ARG1)
 {
+#ifdef MEMORYPOOL_MAGAZINES
+	MemoryPoolMagazine *magazine = getMagazine();
+	if (magazine != nullptr)
+	{
+		if (magazine->count == 0)
+			refillMagazine(magazine PASS_LITERALSTRING_ARG2);	// throws on failure
+		return magazine->blocks[--magazine->count];
+	}
+#endif
+
 	ScopedCriticalSection scopedCriticalSection(TheMemoryPoolCriticalSection);
 
+	return allocateBlockFromBlobs(PASS_LITERALSTRING_ARG1);
+}
+
+//-----------------------------------------------------------------------------
+/**
+	allocate a block from the blobs of this pool, creating a new blob if needed.
+	throws ERROR_OUT_OF_MEMORY on failure. the caller must hold TheMemoryPoolCriticalSection.
+*/
+void* MemoryPool::allocateBlockFromBlobs(DECLARE_LITERALSTRING_ARG1)
+{
 	if (m_firstBlobWithFreeBlocks != nullptr && !m_firstBlobWithFreeBlocks->hasAnyFreeBlocks())
 	{
 		// hmm... the current 'free' blob has nothing available. look and see if there
@@ -1713,8 +1820,28 @@ void MemoryPool::freeBlock(void* pBlockPtr)
 	if (!pBlockPtr)
 		return;	// my, that was easy
 
+#ifdef MEMORYPOOL_MAGAZINES
+	MemoryPoolMagazine *magazine = getMagazine();
+	if (magazine != nullptr)
+	{
+		if (magazine->count == MemoryPoolMagazine::MAX_BLOCKS)
+			flushMagazine(magazine, MemoryPoolMagazine::BATCH_SIZE);
+		magazine->blocks[magazine->count++] = pBlockPtr;
+		return;
+	}
+#endif
+
 	ScopedCriticalSection scopedCriticalSection(TheMemoryPoolCriticalSection);
 
+	freeBlockToBlob(pBlockPtr);
+}
+
+//-----------------------------------------------------------------------------
+/**
+	return a block to the blob it came from. the caller must hold TheMemoryPoolCriticalSection.
+*/
+void MemoryPool::freeBlockToBlob(void* pBlockPtr)
+{
 	MemoryPoolSingleBlock *block = MemoryPoolSingleBlock::recoverBlockFromUserData(pBlockPtr);
 	MemoryPoolBlob *blob = block->getOwningBlob();
 #ifdef MEMORYPOOL_DEBUG
@@ -1795,6 +1922,10 @@ void MemoryPool::reset()
 {
 	ScopedCriticalSection scopedCriticalSection(TheMemoryPoolCriticalSection);
 
+#ifdef MEMORYPOOL_MAGAZINES
+	discardMagazines();
+#endif
+
 	// toss everything. we could do this slightly more efficiently,
 	// but not really worth the extra code to do so.
 	while (m_firstBlob)
@@ -1809,6 +1940,140 @@ void MemoryPool::reset()
 
 }
 
+#ifdef MEMORYPOOL_MAGAZINES
+//-----------------------------------------------------------------------------
+/**
+	return the magazine of the calling thread for this pool, and create it on first use.
+	returns null if this pool has no magazines, or the calling thread has no thread cache.
+*/
+MemoryPoolMagazine *MemoryPool::getMagazine()
+{
+	if (m_magazineIndex < 0)
+		return nullptr;
+
+	MemoryPoolThreadCache *cache = theThreadCache;
+	if (cache == nullptr)
+		return nullptr;
+
+	if (cache->magazines[m_magazineIndex] != nullptr)
+		return cache->magazines[m_magazineIndex];
+
+	ScopedCriticalSection scopedCriticalSection(TheMemoryPoolCriticalSection);
+
+	MemoryPoolMagazine *magazine = (MemoryPoolMagazine *)::sysAllocateDoNotZero(sizeof(MemoryPoolMagazine));	// will throw on failure
+	magazine->count = 0;
+	cache->magazines[m_magazineIndex] = magazine;
+	return magazine;
+}
+
+//-----------------------------------------------------------------------------
+/**
+	fill an empty magazine with BATCH_SIZE blocks from the blobs, leaving room for
+	as many frees before it must flush. throws ERROR_OUT_OF_MEMORY on failure.
+*/
+void MemoryPool::refillMagazine(MemoryPoolMagazine *magazine DECLARE_LITERALSTRING_ARG2)
+{
+	ScopedCriticalSection scopedCriticalSection(TheMemoryPoolCriticalSection);
+
+	while (magazine->count < MemoryPoolMagazine::BATCH_SIZE)
+	{
+		magazine->blocks[magazine->count] = allocateBlockFromBlobs(PASS_LITERALSTRING_ARG1);	// throws on failure
+		++magazine->count;
+	}
+}
+
+//-----------------------------------------------------------------------------
+/**
+	return the given number of blocks from the bottom of the magazine to their blobs. these
+	were freed the longest time ago, so they are the least likely to still be in the cache.
+*/
+void MemoryPool::flushMagazine(MemoryPoolMagazine *magazine, Int count)
+{
+	DEBUG_ASSERTCRASH(count <= magazine->count, ("flushing more blocks than the magazine holds"));
+
+	ScopedCriticalSection scopedCriticalSection(TheMemoryPoolCriticalSection);
+
+	for (Int i = 0; i < count; ++i)
+		freeBlockToBlob(magazine->blocks[i]);
+
+	magazine->count -= count;
+	memmove(magazine->blocks, magazine->blocks + count, magazine->count * sizeof(magazine->blocks[0]));
+}
+
+//-----------------------------------------------------------------------------
+/**
+	forget the blocks in the magazines of all threads without returning them to the blobs.
+	only for when the blobs are about to be thrown away. must not race with other threads
+	that still use this pool.
+*/
+void MemoryPool::discardMagazines()
+{
+	if (m_magazineIndex < 0)
+		return;
+
+	ScopedCriticalSection scopedCriticalSection(TheMemoryPoolCriticalSection);
+
+	for (MemoryPoolThreadCache *cache = theFirstThreadCache; cache != nullptr; cache = cache->next)
+	{
+		MemoryPoolMagazine *magazine = cache->magazines[m_magazineIndex];
+		if (magazine != nullptr)
+			magazine->count = 0;
+	}
+}
+
+//-----------------------------------------------------------------------------
+/**
+	give the calling thread a thread cache, so that it allocates from magazines.
+*/
+/*static*/ void MemoryPool::createThreadMagazines()
+{
+	if (theThreadCache != nullptr)
+		return;
+
+	ScopedCriticalSection scopedCriticalSection(TheMemoryPoolCriticalSection);
+
+	MemoryPoolThreadCache *cache = (MemoryPoolThreadCache *)::sysAllocateDoNotZero(sizeof(MemoryPoolThreadCache));	// will throw on failure
+	memset(cache, 0, sizeof(MemoryPoolThreadCache));
+	cache->next = theFirstThreadCache;
+	theFirstThreadCache = cache;
+	theThreadCache = cache;
+}
+
+//-----------------------------------------------------------------------------
+/**
+	return the blocks in the magazines of the calling thread to their pools,
+	and free the magazines themselves.
+*/
+/*static*/ void MemoryPool::releaseThreadMagazines()
+{
+	MemoryPoolThreadCache *cache = theThreadCache;
+	if (cache == nullptr)
+		return;
+
+	ScopedCriticalSection scopedCriticalSection(TheMemoryPoolCriticalSection);
+
+	for (Int i = 0; i < theNextMagazineIndex; ++i)
+	{
+		MemoryPoolMagazine *magazine = cache->magazines[i];
+		if (magazine == nullptr)
+			continue;
+
+		if (theMagazinePools[i] != nullptr)
+			theMagazinePools[i]->flushMagazine(magazine, magazine->count);
+
+		::sysFree((void *)magazine);
+	}
+
+	MemoryPoolThreadCache **link = &theFirstThreadCache;
+	while (*link != cache)
+		link = &(*link)->next;
+	*link = cache->next;
+
+	::sysFree((void *)cache);
+	theThreadCache = nullptr;
+}
+#endif // MEMORYPOOL_MAGAZINES
+
 //-----------------------------------------------------------------------------
 /**
 	add this pool to the factory's list-of-pools.
@@ -2161,6 +2426,20 @@ void DynamicMemoryAllocator::debugIgnoreLeaksForThisBlock(void* pBlockPtr)
 */
 void *DynamicMemoryAllocator::allocateBytesDoNotZeroImplementation(Int numBytes DECLARE_LITERALSTRING_ARG2)
 {
+#ifdef MEMORYPOOL_MAGAZINES
+	// TheSuperHackers @performance The subpools are thread safe on their own and mostly served from
+	// the magazines of the calling thread, so only the raw blocks need the lock of the dma.
+	{
+		MemoryPool *pool = findPoolForSize(numBytes);
+		if (pool != nullptr)
+		{
+			void *result = pool->allocateBlockDoNotZeroImplementation(PASS_LITERALSTRING_ARG1);	// throws on failure
+			interlockedAdd(&m_usedBlocksInDma, 1);
+			return result;
+		}
+	}
+#endif
+
 	ScopedCriticalSection scopedCriticalSection(TheDmaCriticalSection);
 
 	void *result = nullptr;
@@ -2235,7 +2514,11 @@ void *DynamicMemoryAllocator::allocateBytesDoNotZeroImplementation(Int numBytes
 }
 #endif // MEMORYPOOL_DEBUG
 
+#ifdef MEMORYPOOL_MAGAZINES
+	interlockedAdd(&m_usedBlocksInDma, 1);
+#else
 	++m_usedBlocksInDma;
+#endif
 	DEBUG_ASSERTCRASH(m_usedBlocksInDma >= 0, ("negative count for m_usedBlocksInDma"));
 #ifdef MEMORYPOOL_DEBUG
 	#ifdef USE_FILLER_VALUE
@@ -2277,6 +2560,18 @@ void DynamicMemoryAllocator::freeBytes(void* pBlockPtr)
 	if (!pBlockPtr)
 		return;
 
+#ifdef MEMORYPOOL_MAGAZINES
+	{
+		MemoryPoolBlob *blob = MemoryPoolSingleBlock::recoverBlockFromUserData(pBlockPtr)->getOwningBlob();
+		if (blob != nullptr)
+		{
+			blob->getOwningPool()->freeBlock(pBlockPtr);
+			interlockedAdd(&m_usedBlocksInDma, -1);
+			return;
+		}
+	}
+#endif
+
 	ScopedCriticalSection scopedCriticalSection(TheDmaCriticalSection);
 
 #ifdef MEMORYPOOL_CHECK_BLOCK_OWNERSHIP
@@ -2344,7 +2639,11 @@ void DynamicMemoryAllocator::freeBytes(void* pBlockPtr)
 		::sysFree((void *)block);
 
 	}
+#ifdef MEMORYPOOL_MAGAZINES
+	interlockedAdd(&m_usedBlocksInDma, -1);
+#else
 	--m_usedBlocksInDma;
+#endif
 	DEBUG_ASSERTCRASH(m_usedBlocksInDma >= 0, ("negative count for m_usedBlocksInDma"));
 
 #ifdef INTENSE_DMA_BOOKKEEPING
@@ -3466,6 +3765,9 @@ void initMemoryManager()
 
 	theMainInitFlag = true;
 
+	// the thread that initializes the memory manager is the main thread
+	initMemoryManagerThreadCache();
+
 }
 
 //-----------------------------------------------------------------------------
@@ -3533,6 +3835,23 @@ void shutdownMemoryManager()
 			TheMemoryPoolFactory = nullptr;
 		}
 
+	#ifdef MEMORYPOOL_MAGAZINES
+		// the pools are gone, so this only frees the magazines. other threads must have
+		// called releaseMemoryManagerThreadCache() already, or must not allocate anymore.
+		while (theFirstThreadCache != nullptr)
+		{
+			MemoryPoolThreadCache *cache = theFirstThreadCache;
+			theFirstThreadCache = cache->next;
+			for (Int i = 0; i < theNextMagazineIndex; ++i)
+			{
+				if (cache->magazines[i] != nullptr)
+					::sysFree((void *)cache->magazines[i]);
+			}
+			::sysFree((void *)cache);
+		}
+		theThreadCache = nullptr;
+	#endif
+
 	#ifdef MEMORYPOOL_DEBUG
 		DEBUG_LOG(("Peak system allocation was %d bytes",thePeakSystemAllocationInBytes));
 		DEBUG_LOG(("Wasted DMA space (peak) was %d bytes",thePeakWastedDMA));
@@ -3545,6 +3864,22 @@ void shutdownMemoryManager()
 	DEBUG_SHUTDOWN();
 }
 
+//-----------------------------------------------------------------------------
+void initMemoryManagerThreadCache()
+{
+#ifdef MEMORYPOOL_MAGAZINES
+	MemoryPool::createThreadMagazines();
+#endif
+}
+
+//-----------------------------------------------------------------------------
+void releaseMemoryManagerThreadCache()
+{
+#ifdef MEMORYPOOL_MAGAZINES
+	MemoryPool::releaseThreadMagazines();
+#endif
+}
+
 //-----------------------------------------------------------------------------
 void* createW3DMemPool(const char *poolName, int allocationSize)
 {
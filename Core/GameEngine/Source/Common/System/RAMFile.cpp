@@ -226,6 +226,31 @@ Bool RAMFile::openFromArchive(File *archiveFile, const AsciiString& filename, In
 	return TRUE;
 }
 
+//============================================================================
+// RAMFile::openFromMapping
+//============================================================================
+Bool RAMFile::openFromMapping(const FileMapping& mapping, const AsciiString& filename, Int offset, Int size)
+{
+	FileMapping::View view;
+	if (!mapping.mapView(view, offset, size)) {
+		return FALSE;
+	}
+
+	if (File::open(filename.str(), File::READ | File::BINARY) == FALSE) {
+		FileMapping::unmapView(view);
+		return FALSE;
+	}
+
+	closeFile();
+	m_view = view;
+	m_data = const_cast<Char *>(view.data);	// never written to, RAMFile::write fails
+	m_size = size;
+	m_pos = 0;
+	m_nameStr = filename;
+
+	return TRUE;
+}
+
 //=================================================================
 // RAMFile::close
 //=================================================================
@@ -245,7 +270,11 @@ void RAMFile::close( void )
 
 void RAMFile::closeFile()
 {
-	delete [] m_data;
+	if (m_view.base != nullptr)
+		FileMapping::unmapView(m_view);
+	else
+		delete [] m_data;
+
 	m_data = nullptr;
 }
 
@@ -556,7 +585,17 @@ char* RAMFile::readEntireAndClose()
 	}
 
 	char* tmp = m_data;
-	m_data = nullptr;	// will belong to our caller!
+
+	if (m_view.base != nullptr)
+	{
+		// the mapped data is not ours to give away
+		tmp = NEW char[m_size];
+		memcpy(tmp, m_data, m_size);
+	}
+	else
+	{
+		m_data = nullptr;	// will belong to our caller!
+	}
 
 	close();
 
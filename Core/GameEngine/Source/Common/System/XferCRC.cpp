@@ -118,18 +118,20 @@ void XferCRC::xferSnapshot( Snapshot *snapshot )
 }
 
 //-------------------------------------------------------------------------------------------------
-/** Perform a single CRC operation on the data passed in */
+/** CRC a block of data. Whole 4-byte words are folded in byte swapped, the remaining 1 to 3 bytes
+	* are folded in as a single little endian value. The CRC is kept in a local while folding, so
+	* that the compiler does not have to store it back for every word in case the data aliases it. */
 //-------------------------------------------------------------------------------------------------
-void XferCRC::xferImplementation( void *data, Int dataSize )
+inline void XferCRC::crcBytes( const void *data, Int dataSize )
 {
 	const UnsignedInt *uintPtr = (const UnsignedInt *) (data);
-	dataSize *= (data != nullptr);
+	UnsignedInt crc = m_crc;
 
 	int dataBytes = (dataSize / 4);
 
 	for (Int i=0 ; i<dataBytes; ++i)
 	{
-		addCRC (*uintPtr++);
+		crc = (crc << 1) + htobe(*uintPtr++) + ((crc >> 31) & 0x01);
 	}
 
 	UnsignedInt val = 0;
@@ -145,12 +147,25 @@ void XferCRC::xferImplementation( void *data, Int dataSize )
 		FALLTHROUGH;
 	case 1:
 		val += c[0];
-		m_crc = (m_crc << 1) + val + ((m_crc >> 31) & 0x01);
+		crc = (crc << 1) + val + ((crc >> 31) & 0x01);
 		FALLTHROUGH;
 	default:
 		break;
 	}
 
+	m_crc = crc;
+
+}
+
+//-------------------------------------------------------------------------------------------------
+/** Perform a single CRC operation on the data passed in */
+//-------------------------------------------------------------------------------------------------
+void XferCRC::xferImplementation( void *data, Int dataSize )
+{
+	dataSize *= (data != nullptr);
+
+	crcBytes( data, dataSize );
+
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -170,6 +185,170 @@ UnsignedInt XferCRC::getCRC( void )
 }
 
 
+// ------------------------------------------------------------------------------------------------
+// ------------------------------------------------------------------------------------------------
+void XferFastCRC::xferVersion( XferVersion *versionData, XferVersion currentVersion )
+{
+
+	crcBytes( versionData, sizeof( XferVersion ) );
+
+	// sanity, after the xfer, version data is never allowed to be higher than the current version
+	if( *versionData > currentVersion )
+	{
+
+		DEBUG_CRASH(( "XferVersion - Unknown version '%d' should be no higher than '%d'",
+									*versionData, currentVersion ));
+		throw XFER_INVALID_VERSION;
+
+	}
+
+}
+
+// ------------------------------------------------------------------------------------------------
+// ------------------------------------------------------------------------------------------------
+void XferFastCRC::xferByte( Byte *byteData )
+{
+	crcBytes( byteData, sizeof( Byte ) );
+}
+
+// ------------------------------------------------------------------------------------------------
+// ------------------------------------------------------------------------------------------------
+void XferFastCRC::xferUnsignedByte( UnsignedByte *unsignedByteData )
+{
+	crcBytes( unsignedByteData, sizeof( UnsignedByte ) );
+}
+
+// ------------------------------------------------------------------------------------------------
+// ------------------------------------------------------------------------------------------------
+void XferFastCRC::xferBool( Bool *boolData )
+{
+	crcBytes( boolData, sizeof( Bool ) );
+}
+
+// ------------------------------------------------------------------------------------------------
+// ------------------------------------------------------------------------------------------------
+void XferFastCRC::xferInt( Int *intData )
+{
+	crcBytes( intData, sizeof( Int ) );
+}
+
+// ------------------------------------------------------------------------------------------------
+// ------------------------------------------------------------------------------------------------
+void XferFastCRC::xferInt64( Int64 *int64Data )
+{
+	crcBytes( int64Data, sizeof( Int64 ) );
+}
+
+// ------------------------------------------------------------------------------------------------
+// ------------------------------------------------------------------------------------------------
+void XferFastCRC::xferUnsignedInt( UnsignedInt *unsignedIntData )
+{
+	crcBytes( unsignedIntData, sizeof( UnsignedInt ) );
+}
+
+// ------------------------------------------------------------------------------------------------
+// ------------------------------------------------------------------------------------------------
+void XferFastCRC::xferShort( Short *shortData )
+{
+	crcBytes( shortData, sizeof( Short ) );
+}
+
+// ------------------------------------------------------------------------------------------------
+// ------------------------------------------------------------------------------------------------
+void XferFastCRC::xferUnsignedShort( UnsignedShort *unsignedShortData )
+{
+	crcBytes( unsignedShortData, sizeof( UnsignedShort ) );
+}
+
+// ------------------------------------------------------------------------------------------------
+// ------------------------------------------------------------------------------------------------
+void XferFastCRC::xferReal( Real *realData )
+{
+	crcBytes( realData, sizeof( Real ) );
+}
+
+// ------------------------------------------------------------------------------------------------
+/** Same as Xfer::xferAsciiString, the length is not part of the CRC */
+// ------------------------------------------------------------------------------------------------
+void XferFastCRC::xferAsciiString( AsciiString *asciiStringData )
+{
+	const Int len = asciiStringData->getLength();
+	if( len > 0 )
+		crcBytes( asciiStringData->str(), sizeof( Byte ) * len );
+}
+
+// ------------------------------------------------------------------------------------------------
+/** The members are whole words, so folding them as one block gives the same CRC as one
+	* xferReal per member */
+// ------------------------------------------------------------------------------------------------
+void XferFastCRC::xferCoord3D( Coord3D *coord3D )
+{
+	crcBytes( coord3D, sizeof( Coord3D ) );
+}
+
+// ------------------------------------------------------------------------------------------------
+// ------------------------------------------------------------------------------------------------
+void XferFastCRC::xferICoord3D( ICoord3D *iCoord3D )
+{
+	crcBytes( iCoord3D, sizeof( ICoord3D ) );
+}
+
+// ------------------------------------------------------------------------------------------------
+// ------------------------------------------------------------------------------------------------
+void XferFastCRC::xferCoord2D( Coord2D *coord2D )
+{
+	crcBytes( coord2D, sizeof( Coord2D ) );
+}
+
+// ------------------------------------------------------------------------------------------------
+// ------------------------------------------------------------------------------------------------
+void XferFastCRC::xferICoord2D( ICoord2D *iCoord2D )
+{
+	crcBytes( iCoord2D, sizeof( ICoord2D ) );
+}
+
+// ------------------------------------------------------------------------------------------------
+// ------------------------------------------------------------------------------------------------
+void XferFastCRC::xferColor( Color *color )
+{
+	crcBytes( color, sizeof( Color ) );
+}
+
+// ------------------------------------------------------------------------------------------------
+// ------------------------------------------------------------------------------------------------
+void XferFastCRC::xferObjectID( ObjectID *objectID )
+{
+	crcBytes( objectID, sizeof( ObjectID ) );
+}
+
+// ------------------------------------------------------------------------------------------------
+// ------------------------------------------------------------------------------------------------
+void XferFastCRC::xferDrawableID( DrawableID *drawableID )
+{
+	crcBytes( drawableID, sizeof( DrawableID ) );
+}
+
+// ------------------------------------------------------------------------------------------------
+// ------------------------------------------------------------------------------------------------
+void XferFastCRC::xferUser( void *data, Int dataSize )
+{
+	dataSize *= (data != nullptr);
+
+	crcBytes( data, dataSize );
+}
+
+// ------------------------------------------------------------------------------------------------
+/** Same layout as Xfer::xferMatrix3D: the version, then the three rows of four reals */
+// ------------------------------------------------------------------------------------------------
+void XferFastCRC::xferMatrix3D( Matrix3D* mtx )
+{
+	XferVersion version = 1;
+	crcBytes( &version, sizeof( XferVersion ) );
+
+	for( Int row = 0; row < 3; ++row )
+		crcBytes( &(*mtx)[row], sizeof( Vector4 ) );
+}
+
 //-------------------------------------------------------------------------------------------------
 //-------------------------------------------------------------------------------------------------
 XferDeepCRC::XferDeepCRC( void )
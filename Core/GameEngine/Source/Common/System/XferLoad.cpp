@@ -258,3 +258,135 @@ void XferLoad::xferImplementation( void *data, Int dataSize )
 
 }
 
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// XferLoadBuffer /////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+//-------------------------------------------------------------------------------------------------
+//-------------------------------------------------------------------------------------------------
+XferLoadBuffer::XferLoadBuffer( const void *data, Int dataSize )
+{
+
+	m_data = static_cast<const UnsignedByte *>( data );
+	m_dataSize = dataSize;
+	m_pos = 0;
+	m_isOpen = FALSE;
+
+}
+
+//-------------------------------------------------------------------------------------------------
+//-------------------------------------------------------------------------------------------------
+XferLoadBuffer::~XferLoadBuffer( void )
+{
+
+	if( m_isOpen )
+		close();
+
+}
+
+//-------------------------------------------------------------------------------------------------
+/** Start reading the buffer, 'identifier' is only used for error messages */
+//-------------------------------------------------------------------------------------------------
+void XferLoadBuffer::open( AsciiString identifier )
+{
+
+	// sanity, check to see if we're already open
+	if( m_isOpen )
+	{
+
+		DEBUG_CRASH(( "Cannot open buffer '%s' cause we've already got '%s' open",
+									identifier.str(), m_identifier.str() ));
+		throw XFER_FILE_ALREADY_OPEN;
+
+	}
+
+	// call base class
+	Xfer::open( identifier );
+
+	m_pos = 0;
+	m_isOpen = TRUE;
+
+}
+
+//-------------------------------------------------------------------------------------------------
+/** Stop reading the buffer */
+//-------------------------------------------------------------------------------------------------
+void XferLoadBuffer::close( void )
+{
+
+	if( m_isOpen == FALSE )
+	{
+
+		DEBUG_CRASH(( "Xfer close called, but no buffer was open" ));
+		throw XFER_FILE_NOT_OPEN;
+
+	}
+
+	m_isOpen = FALSE;
+
+	// erase the identifier
+	m_identifier.clear();
+
+}
+
+//-------------------------------------------------------------------------------------------------
+/** Read block size */
+//-------------------------------------------------------------------------------------------------
+Int XferLoadBuffer::beginBlock( void )
+{
+
+	if( m_pos + (Int)sizeof( XferBlockSize ) > m_dataSize )
+	{
+
+		DEBUG_CRASH(( "Xfer - Error reading block size for '%s'", m_identifier.str() ));
+		return 0;
+
+	}
+
+	XferBlockSize blockSize;
+	memcpy( &blockSize, m_data + m_pos, sizeof( XferBlockSize ) );
+	m_pos += sizeof( XferBlockSize );
+
+	return blockSize;
+
+}
+
+//-------------------------------------------------------------------------------------------------
+/** Skip forward 'dataSize' bytes in the buffer */
+//-------------------------------------------------------------------------------------------------
+void XferLoadBuffer::skip( Int dataSize )
+{
+
+	// sanity
+	DEBUG_ASSERTCRASH( dataSize >=0, ("XferLoadBuffer::skip - dataSize '%d' must be greater than 0",
+										 dataSize) );
+
+	if( dataSize < 0 || m_pos + dataSize > m_dataSize )
+		throw XFER_SKIP_ERROR;
+
+	m_pos += dataSize;
+
+}
+
+//-------------------------------------------------------------------------------------------------
+/** Copy the data out of the buffer */
+//-------------------------------------------------------------------------------------------------
+void XferLoadBuffer::xferImplementation( void *data, Int dataSize )
+{
+
+	// sanity
+	DEBUG_ASSERTCRASH( m_isOpen, ("XferLoadBuffer - buffer '%s' is not open", m_identifier.str()) );
+
+	if( m_pos + dataSize > m_dataSize )
+	{
+
+		DEBUG_CRASH(( "XferLoadBuffer - Error reading from buffer '%s'", m_identifier.str() ));
+		throw XFER_READ_ERROR;
+
+	}
+
+	memcpy( data, m_data + m_pos, dataSize );
+	m_pos += dataSize;
+
+}
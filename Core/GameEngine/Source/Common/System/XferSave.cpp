@@ -356,3 +356,146 @@ void XferSave::xferImplementation( void *data, Int dataSize )
 	}
 
 }
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// XferSaveBuffer /////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+//-------------------------------------------------------------------------------------------------
+//-------------------------------------------------------------------------------------------------
+XferSaveBuffer::XferSaveBuffer( void )
+{
+
+	m_isOpen = FALSE;
+
+}
+
+//-------------------------------------------------------------------------------------------------
+//-------------------------------------------------------------------------------------------------
+XferSaveBuffer::~XferSaveBuffer( void )
+{
+
+	if( m_isOpen )
+		close();
+
+}
+
+//-------------------------------------------------------------------------------------------------
+/** Start writing a new buffer, 'identifier' is only used for error messages */
+//-------------------------------------------------------------------------------------------------
+void XferSaveBuffer::open( AsciiString identifier )
+{
+
+	// sanity, check to see if we're already open
+	if( m_isOpen )
+	{
+
+		DEBUG_CRASH(( "Cannot open buffer '%s' cause we've already got '%s' open",
+									identifier.str(), m_identifier.str() ));
+		throw XFER_FILE_ALREADY_OPEN;
+
+	}
+
+	// call base class
+	Xfer::open( identifier );
+
+	m_buffer.clear();
+	m_isOpen = TRUE;
+
+}
+
+//-------------------------------------------------------------------------------------------------
+/** Stop writing. The written data stays available through getBuffer() */
+//-------------------------------------------------------------------------------------------------
+void XferSaveBuffer::close( void )
+{
+
+	if( m_isOpen == FALSE )
+	{
+
+		DEBUG_CRASH(( "Xfer close called, but no buffer was open" ));
+		throw XFER_FILE_NOT_OPEN;
+
+	}
+
+	m_isOpen = FALSE;
+
+	// erase the identifier
+	m_identifier.clear();
+
+}
+
+//-------------------------------------------------------------------------------------------------
+/** Same as XferSave::beginBlock, but the placeholder position is an offset into the buffer */
+//-------------------------------------------------------------------------------------------------
+Int XferSaveBuffer::beginBlock( void )
+{
+
+	// remember where the placeholder goes so we can write the size there at the next end block
+	XferFilePos filePos = (XferFilePos)m_buffer.size();
+
+	// write a placeholder
+	XferBlockSize blockSize = 0;
+	xferImplementation( &blockSize, sizeof( XferBlockSize ) );
+
+	// save this block position on the top of the "stack"
+	XferBlockData *top = newInstance(XferBlockData);
+	top->filePos = filePos;
+	top->next = m_blockStack;
+	m_blockStack = top;
+
+	return XFER_OK;
+
+}
+
+//-------------------------------------------------------------------------------------------------
+/** Write the size of the data since the last begin block into its placeholder */
+//-------------------------------------------------------------------------------------------------
+void XferSaveBuffer::endBlock( void )
+{
+
+	// sanity, make sure we have a block started
+	if( m_blockStack == nullptr )
+	{
+
+		DEBUG_CRASH(( "Xfer end block called, but no matching begin block was found" ));
+		throw XFER_BEGIN_END_MISMATCH;
+
+	}
+
+	// pop the block descriptor off the top of the block stack
+	XferBlockData *top = m_blockStack;
+	m_blockStack = m_blockStack->next;
+
+	// write the size in bytes between the block position and the end of the buffer
+	XferBlockSize blockSize = (XferBlockSize)m_buffer.size() - top->filePos - sizeof( XferBlockSize );
+	memcpy( &m_buffer[ top->filePos ], &blockSize, sizeof( XferBlockSize ) );
+
+	// delete the block data as it's all used up now
+	deleteInstance(top);
+
+}
+
+//-------------------------------------------------------------------------------------------------
+/** Skip forward 'dataSize' bytes, the skipped bytes are zero */
+//-------------------------------------------------------------------------------------------------
+void XferSaveBuffer::skip( Int dataSize )
+{
+
+	m_buffer.resize( m_buffer.size() + dataSize, 0 );
+
+}
+
+//-------------------------------------------------------------------------------------------------
+/** Append the data to the buffer */
+//-------------------------------------------------------------------------------------------------
+void XferSaveBuffer::xferImplementation( void *data, Int dataSize )
+{
+
+	// sanity
+	DEBUG_ASSERTCRASH( m_isOpen, ("XferSaveBuffer - buffer '%s' is not open", m_identifier.str()) );
+
+	const UnsignedByte *bytes = static_cast<const UnsignedByte *>( data );
+	m_buffer.insert( m_buffer.end(), bytes, bytes + dataSize );
+
+}
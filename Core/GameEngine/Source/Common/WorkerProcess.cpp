@@ -19,6 +19,19 @@
 #include "PreRTS.h"	// This must go first in EVERY cpp file in the GameEngine
 #include "Common/WorkerProcess.h"
 
+#ifndef _WIN32
+#include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#if defined(__linux__)
+#include <sys/prctl.h>
+#endif
+#endif
+
+#ifdef _WIN32
+
 // We need Job-related functions, but these aren't defined in the Windows-headers that VC6 uses.
 // So we define them here and load them dynamically.
 #if defined(_MSC_VER) && _MSC_VER < 1300
@@ -128,21 +141,6 @@ bool WorkerProcess::isRunning() const
 	return m_processHandle != nullptr;
 }
 
-bool WorkerProcess::isDone() const
-{
-	return m_isDone;
-}
-
-DWORD WorkerProcess::getExitCode() const
-{
-	return m_exitcode;
-}
-
-AsciiString WorkerProcess::getStdOutput() const
-{
-	return m_stdOutput;
-}
-
 bool WorkerProcess::fetchStdOutput()
 {
 	while (true)
@@ -166,12 +164,7 @@ bool WorkerProcess::fetchStdOutput()
 			return true;
 		DEBUG_ASSERTCRASH(readBytes != 0, ("expected readBytes to be non null"));
 
-		// Remove \r, otherwise each new line is doubled when we output it again
-		for (int i = 0; i < readBytes; i++)
-			if (buffer[i] == '\r')
-				buffer[i] = ' ';
-		buffer[readBytes] = 0;
-		m_stdOutput.concat(buffer);
+		appendStdOutput(buffer, readBytes);
 	}
 }
 
@@ -188,7 +181,9 @@ void WorkerProcess::update()
 
 	// Pipe broke, that means the process already exited. But we call this just to make sure
 	WaitForSingleObject(m_processHandle, INFINITE);
-	GetExitCodeProcess(m_processHandle, &m_exitcode);
+	DWORD exitcode = 0;
+	GetExitCodeProcess(m_processHandle, &exitcode);
+	m_exitcode = (int)exitcode;
 	CloseHandle(m_processHandle);
 	m_processHandle = nullptr;
 
@@ -229,3 +224,172 @@ void WorkerProcess::kill()
 	m_isDone = false;
 }
 
+#else // _WIN32
+
+// TheSuperHackers @feature The POSIX backend forks and execs the worker with its stdout and stderr
+// redirected into a non blocking pipe. On Linux the worker is killed when we exit, like the job
+// object does on Windows.
+
+WorkerProcess::WorkerProcess()
+{
+	m_processId = -1;
+	m_readFd = -1;
+	m_exitcode = 0;
+	m_isDone = false;
+}
+
+bool WorkerProcess::startProcess(const std::vector<AsciiString>& args)
+{
+	m_stdOutput.clear();
+	m_isDone = false;
+
+	if (args.empty())
+		return false;
+
+	// Build argv before forking, the child may only make async-signal-safe calls
+	std::vector<char*> argv;
+	argv.reserve(args.size() + 1);
+	for (size_t i = 0; i < args.size(); ++i)
+		argv.push_back(const_cast<char*>(args[i].str()));
+	argv.push_back(nullptr);
+
+	// Create pipe for reading console output
+	int fds[2];
+	if (pipe(fds) != 0)
+		return false;
+	fcntl(fds[0], F_SETFD, FD_CLOEXEC);
+	fcntl(fds[0], F_SETFL, fcntl(fds[0], F_GETFL) | O_NONBLOCK);
+
+	const pid_t parentId = getpid();
+	const pid_t processId = fork();
+	if (processId < 0)
+	{
+		close(fds[0]);
+		close(fds[1]);
+		return false;
+	}
+
+	if (processId == 0)
+	{
+#if defined(__linux__)
+		// We want to make sure that when our process is killed, our workers automatically terminate as well.
+		prctl(PR_SET_PDEATHSIG, SIGKILL);
+		if (getppid() != parentId)
+			_exit(1);
+#endif
+		dup2(fds[1], STDOUT_FILENO);
+		dup2(fds[1], STDERR_FILENO);
+		close(fds[0]);
+		close(fds[1]);
+		execv(argv[0], &argv[0]);
+		_exit(127);
+	}
+
+	close(fds[1]);
+	m_processId = processId;
+	m_readFd = fds[0];
+
+	return true;
+}
+
+bool WorkerProcess::isRunning() const
+{
+	return m_processId > 0;
+}
+
+bool WorkerProcess::fetchStdOutput()
+{
+	while (true)
+	{
+		char buffer[1024];
+		const ssize_t readBytes = read(m_readFd, buffer, ARRAY_SIZE(buffer)-1);
+		if (readBytes > 0)
+		{
+			appendStdOutput(buffer, (int)readBytes);
+			continue;
+		}
+		if (readBytes < 0 && errno == EINTR)
+			continue;
+		if (readBytes < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+		{
+			// Child process is still running and we have all output so far
+			return false;
+		}
+
+		// End of file or a broken pipe
+		return true;
+	}
+}
+
+void WorkerProcess::update()
+{
+	if (!isRunning())
+		return;
+
+	if (!fetchStdOutput())
+	{
+		// There is still potential output pending
+		return;
+	}
+
+	// Pipe closed, that means the process already exited. But we wait to make sure
+	int status = 0;
+	while (waitpid(m_processId, &status, 0) < 0 && errno == EINTR)
+	{
+	}
+	m_exitcode = WIFEXITED(status) ? WEXITSTATUS(status) : 1;
+	m_processId = -1;
+
+	close(m_readFd);
+	m_readFd = -1;
+
+	m_isDone = true;
+}
+
+void WorkerProcess::kill()
+{
+	if (!isRunning())
+		return;
+
+	::kill(m_processId, SIGKILL);
+	while (waitpid(m_processId, nullptr, 0) < 0 && errno == EINTR)
+	{
+	}
+	m_processId = -1;
+
+	if (m_readFd >= 0)
+	{
+		close(m_readFd);
+		m_readFd = -1;
+	}
+
+	m_stdOutput.clear();
+	m_isDone = false;
+}
+
+#endif // _WIN32
+
+bool WorkerProcess::isDone() const
+{
+	return m_isDone;
+}
+
+int WorkerProcess::getExitCode() const
+{
+	return m_exitcode;
+}
+
+AsciiString WorkerProcess::getStdOutput() const
+{
+	return m_stdOutput;
+}
+
+void WorkerProcess::appendStdOutput(char *buffer, int readBytes)
+{
+	// Remove \r, otherwise each new line is doubled when we output it again
+	for (int i = 0; i < readBytes; i++)
+		if (buffer[i] == '\r')
+			buffer[i] = ' ';
+	buffer[readBytes] = 0;
+	m_stdOutput.concat(buffer);
+}
@@ -0,0 +1,271 @@
+/*
+**	Command & Conquer Generals Zero Hour(tm)
+**	Copyright 2026 TheSuperHackers
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// FILE: WorkerThreadPool.cpp /////////////////////////////////////////////////////////////////////
+// Desc:   A small pool of threads that runs a function for every index of a range
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "PreRTS.h"	// This must go first in EVERY cpp file in the GameEngine
+
+#include "Common/WorkerThreadPool.h"
+
+#ifndef _WIN32
+#include <unistd.h>
+#endif
+
+// PUBLIC DATA ////////////////////////////////////////////////////////////////////////////////////
+
+WorkerThreadPool *TheWorkerThreadPool = nullptr;
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// PUBLIC METHODS /////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+//-------------------------------------------------------------------------------------------------
+WorkerThreadPool::WorkerThreadPool() :
+	m_function(nullptr),
+	m_userData(nullptr),
+	m_count(0),
+	m_nextIndex(0),
+	m_busyThreads(0),
+	m_quit(FALSE),
+	m_threadCount(0)
+{
+#ifdef _WIN32
+	m_wakeSemaphore = CreateSemaphore(nullptr, 0, MAX_THREADS, nullptr);
+	m_doneEvent = CreateEvent(nullptr, FALSE, FALSE, nullptr);
+#else
+	pthread_mutex_init(&m_mutex, nullptr);
+	pthread_cond_init(&m_wakeCondition, nullptr);
+	pthread_cond_init(&m_doneCondition, nullptr);
+	m_wakeCount = 0;
+#endif
+}
+
+//-------------------------------------------------------------------------------------------------
+WorkerThreadPool::~WorkerThreadPool()
+{
+	shutdown();
+
+#ifdef _WIN32
+	CloseHandle(m_wakeSemaphore);
+	CloseHandle(m_doneEvent);
+#else
+	pthread_cond_destroy(&m_doneCondition);
+	pthread_cond_destroy(&m_wakeCondition);
+	pthread_mutex_destroy(&m_mutex);
+#endif
+}
+
+//-------------------------------------------------------------------------------------------------
+void WorkerThreadPool::init( Int numThreads )
+{
+	shutdown();
+
+	if (numThreads < 0)
+		numThreads = getProcessorCount() - 1;
+
+	numThreads = min(numThreads, (Int)MAX_THREADS);
+
+	m_quit = FALSE;
+
+	while (m_threadCount < numThreads)
+	{
+#ifdef _WIN32
+		m_threads[m_threadCount] = CreateThread(nullptr, 0, threadProc, this, 0, nullptr);
+		if (m_threads[m_threadCount] == nullptr)
+			break;
+#else
+		if (pthread_create(&m_threads[m_threadCount], nullptr, threadProc, this) != 0)
+			break;
+#endif
+		++m_threadCount;
+	}
+
+	DEBUG_LOG(("WorkerThreadPool::init - Started %d worker threads", m_threadCount));
+}
+
+//-------------------------------------------------------------------------------------------------
+void WorkerThreadPool::shutdown()
+{
+	if (m_threadCount == 0)
+		return;
+
+#ifdef _WIN32
+	m_quit = TRUE;
+	ReleaseSemaphore(m_wakeSemaphore, m_threadCount, nullptr);
+	WaitForMultipleObjects(m_threadCount, m_threads, TRUE, INFINITE);
+
+	for (Int i = 0; i < m_threadCount; ++i)
+		CloseHandle(m_threads[i]);
+#else
+	pthread_mutex_lock(&m_mutex);
+	m_quit = TRUE;
+	pthread_cond_broadcast(&m_wakeCondition);
+	pthread_mutex_unlock(&m_mutex);
+
+	for (Int i = 0; i < m_threadCount; ++i)
+		pthread_join(m_threads[i], nullptr);
+#endif
+
+	m_threadCount = 0;
+}
+
+//-------------------------------------------------------------------------------------------------
+/** Wakes no more threads than there are indices for the others, and waits until every woken
+	* thread is done, so that no thread can still be looking at the range of this run when the
+	* next run starts. */
+//-------------------------------------------------------------------------------------------------
+void WorkerThreadPool::run( JobFunction function, void *userData, Int count )
+{
+	const Int wakeCount = min(m_threadCount, count - 1);
+
+	if (wakeCount <= 0)
+	{
+		for (Int i = 0; i < count; ++i)
+			function(userData, i);
+		return;
+	}
+
+	m_function = function;
+	m_userData = userData;
+	m_count = count;
+	m_nextIndex = 0;
+	m_busyThreads = wakeCount + 1;
+
+#ifdef _WIN32
+	ReleaseSemaphore(m_wakeSemaphore, wakeCount, nullptr);
+
+	work();
+
+	if (InterlockedDecrement(&m_busyThreads) != 0)
+		WaitForSingleObject(m_doneEvent, INFINITE);
+#else
+	pthread_mutex_lock(&m_mutex);
+	m_wakeCount = wakeCount;
+	pthread_cond_broadcast(&m_wakeCondition);
+	pthread_mutex_unlock(&m_mutex);
+
+	work();
+
+	pthread_mutex_lock(&m_mutex);
+	--m_busyThreads;
+	while (m_busyThreads > 0)
+		pthread_cond_wait(&m_doneCondition, &m_mutex);
+	pthread_mutex_unlock(&m_mutex);
+#endif
+}
+
+//-------------------------------------------------------------------------------------------------
+void WorkerThreadPool::parallelFor( JobFunction function, void *userData, Int count )
+{
+	if (TheWorkerThreadPool != nullptr)
+	{
+		TheWorkerThreadPool->run(function, userData, count);
+		return;
+	}
+
+	for (Int i = 0; i < count; ++i)
+		function(userData, i);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// PRIVATE METHODS ////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+//-------------------------------------------------------------------------------------------------
+Int WorkerThreadPool::getProcessorCount()
+{
+#ifdef _WIN32
+	SYSTEM_INFO systemInfo;
+	GetSystemInfo(&systemInfo);
+	return (Int)systemInfo.dwNumberOfProcessors;
+#else
+	return (Int)sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+}
+
+//-------------------------------------------------------------------------------------------------
+void WorkerThreadPool::work()
+{
+	for (;;)
+	{
+#ifdef _WIN32
+		const Int index = InterlockedIncrement(&m_nextIndex) - 1;
+#else
+		const Int index = __sync_fetch_and_add(&m_nextIndex, 1);
+#endif
+		if (index >= m_count)
+			break;
+
+		m_function(m_userData, index);
+	}
+}
+
+//-------------------------------------------------------------------------------------------------
+void WorkerThreadPool::workerLoop()
+{
+	initMemoryManagerThreadCache();
+
+#ifdef _WIN32
+	for (;;)
+	{
+		WaitForSingleObject(m_wakeSemaphore, INFINITE);
+		if (m_quit)
+			break;
+
+		work();
+
+		if (InterlockedDecrement(&m_busyThreads) == 0)
+			SetEvent(m_doneEvent);
+	}
+#else
+	pthread_mutex_lock(&m_mutex);
+	for (;;)
+	{
+		while (!m_quit && m_wakeCount == 0)
+			pthread_cond_wait(&m_wakeCondition, &m_mutex);
+
+		if (m_quit)
+			break;
+
+		--m_wakeCount;
+		pthread_mutex_unlock(&m_mutex);
+
+		work();
+
+		pthread_mutex_lock(&m_mutex);
+		if (--m_busyThreads == 0)
+			pthread_cond_signal(&m_doneCondition);
+	}
+	pthread_mutex_unlock(&m_mutex);
+#endif
+
+	releaseMemoryManagerThreadCache();
+}
+
+//-------------------------------------------------------------------------------------------------
+#ifdef _WIN32
+unsigned long __stdcall WorkerThreadPool::threadProc( void *param )
+#else
+void *WorkerThreadPool::threadProc( void *param )
+#endif
+{
+	static_cast<WorkerThreadPool *>(param)->workerLoop();
+	return 0;
+}
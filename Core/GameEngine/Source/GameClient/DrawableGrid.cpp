@@ -0,0 +1,174 @@
+/*
+**	Command & Conquer Generals Zero Hour(tm)
+**	Copyright 2026 TheSuperHackers
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// FILE: DrawableGrid.cpp /////////////////////////////////////////////////////////////////////////
+// Desc:   Uniform grid of all client Drawables by position
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "PreRTS.h"	// This must go first in EVERY cpp file in the GameEngine
+
+#include "GameClient/DrawableGrid.h"
+
+#include "GameClient/Drawable.h"
+
+static_assert((DrawableGrid::DRAWABLE_GRID_CELLS & (DrawableGrid::DRAWABLE_GRID_CELLS - 1)) == 0, "DRAWABLE_GRID_CELLS must be a power of two");
+
+//-------------------------------------------------------------------------------------------------
+DrawableGrid::Query::Query( DrawableGrid *grid, const Region3D *region )
+{
+	m_grid = grid;
+
+	if (grid->m_queryDepth == (Int)grid->m_results.size())
+		grid->m_results.push_back(DrawableList());
+
+	m_depth = grid->m_queryDepth++;
+
+	DrawableList &result = grid->m_results[m_depth];
+	result.clear();
+
+	Int loX = getCell(region->lo.x);
+	Int loY = getCell(region->lo.y);
+	Int hiX = getCell(region->hi.x);
+	Int hiY = getCell(region->hi.y);
+
+	// a region that is wider than the grid visits every bucket once
+	if (hiX - loX >= DRAWABLE_GRID_CELLS - 1)
+	{
+		loX = 0;
+		hiX = DRAWABLE_GRID_CELLS - 1;
+	}
+	if (hiY - loY >= DRAWABLE_GRID_CELLS - 1)
+	{
+		loY = 0;
+		hiY = DRAWABLE_GRID_CELLS - 1;
+	}
+
+	for (Int y = loY; y <= hiY; ++y)
+	{
+		const Int row = (y & (DRAWABLE_GRID_CELLS - 1)) * DRAWABLE_GRID_CELLS;
+
+		for (Int x = loX; x <= hiX; ++x)
+		{
+			const DrawableList &bucket = grid->m_buckets[row + (x & (DRAWABLE_GRID_CELLS - 1))];
+
+			for (DrawableList::const_iterator it = bucket.begin(); it != bucket.end(); ++it)
+			{
+				const Coord3D *pos = (*it)->getPosition();
+				if (pos->x >= region->lo.x && pos->x <= region->hi.x &&
+						pos->y >= region->lo.y && pos->y <= region->hi.y &&
+						pos->z >= region->lo.z && pos->z <= region->hi.z)
+				{
+					result.push_back(*it);
+				}
+			}
+		}
+	}
+}
+
+//-------------------------------------------------------------------------------------------------
+DrawableGrid::Query::~Query()
+{
+	DEBUG_ASSERTCRASH(m_depth == m_grid->m_queryDepth - 1, ("DrawableGrid queries must end in reverse order"));
+	--m_grid->m_queryDepth;
+}
+
+//-------------------------------------------------------------------------------------------------
+DrawableGrid::DrawableGrid()
+{
+	m_queryDepth = 0;
+}
+
+//-------------------------------------------------------------------------------------------------
+Int DrawableGrid::getCell( Real coord )
+{
+	return REAL_TO_INT_FLOOR(coord * (1.0f / DRAWABLE_GRID_CELL_SIZE));
+}
+
+//-------------------------------------------------------------------------------------------------
+Int DrawableGrid::getBucket( const Coord3D *pos )
+{
+	const Int x = getCell(pos->x) & (DRAWABLE_GRID_CELLS - 1);
+	const Int y = getCell(pos->y) & (DRAWABLE_GRID_CELLS - 1);
+	return y * DRAWABLE_GRID_CELLS + x;
+}
+
+//-------------------------------------------------------------------------------------------------
+void DrawableGrid::add( Drawable *draw )
+{
+	DEBUG_ASSERTCRASH(draw->m_gridBucket < 0, ("Drawable is already in the DrawableGrid"));
+
+	const Int bucket = getBucket(draw->getPosition());
+	DrawableList &list = m_buckets[bucket];
+	draw->m_gridBucket = bucket;
+	draw->m_gridIndex = (Int)list.size();
+	list.push_back(draw);
+}
+
+//-------------------------------------------------------------------------------------------------
+void DrawableGrid::remove( Drawable *draw )
+{
+	if (draw->m_gridBucket < 0)
+		return;
+
+	removeFromBucket(draw);
+
+	// the Drawable is going away, so the running queries must not hand it out anymore
+	for (Int depth = 0; depth < m_queryDepth; ++depth)
+	{
+		DrawableList &result = m_results[depth];
+		for (DrawableList::iterator it = result.begin(); it != result.end(); ++it)
+		{
+			if (*it == draw)
+				*it = nullptr;
+		}
+	}
+}
+
+//-------------------------------------------------------------------------------------------------
+void DrawableGrid::update( Drawable *draw )
+{
+	if (draw->m_gridBucket < 0)
+		return;
+
+	const Int bucket = getBucket(draw->getPosition());
+	if (bucket == draw->m_gridBucket)
+		return;
+
+	removeFromBucket(draw);
+
+	DrawableList &list = m_buckets[bucket];
+	draw->m_gridBucket = bucket;
+	draw->m_gridIndex = (Int)list.size();
+	list.push_back(draw);
+}
+
+//-------------------------------------------------------------------------------------------------
+void DrawableGrid::removeFromBucket( Drawable *draw )
+{
+	DrawableList &bucket = m_buckets[draw->m_gridBucket];
+	DEBUG_ASSERTCRASH(bucket[draw->m_gridIndex] == draw, ("DrawableGrid is out of sync"));
+
+	// move the last Drawable of the bucket into the free slot
+	Drawable *last = bucket.back();
+	bucket[draw->m_gridIndex] = last;
+	last->m_gridIndex = draw->m_gridIndex;
+	bucket.pop_back();
+
+	draw->m_gridBucket = -1;
+	draw->m_gridIndex = -1;
+}
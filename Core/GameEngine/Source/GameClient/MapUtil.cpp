@@ -41,6 +41,7 @@
 #include "Common/DataChunk.h"
 #include "Common/MapReaderWriterInfo.h"
 #include "Common/MessageStream.h"
+#include "Common/WorkerThreadPool.h"
 #include "Common/WellKnownKeys.h"
 #include "Common/INI.h"
 #include "Common/QuotedPrintable.h"
@@ -48,6 +49,8 @@
 #include "Common/ThingFactory.h"
 #include "Common/ThingTemplate.h"
 #include "Common/MapObject.h"
+#include "Common/XferLoad.h"
+#include "Common/XferSave.h"
 #include "GameClient/GameText.h"
 #include "GameClient/WindowLayout.h"
 #include "GameClient/Gadget.h"
@@ -81,29 +84,115 @@ static Coord3DList	m_techPositions;
 static Int m_mapDX = 0;
 static Int m_mapDY = 0;
 
-static UnsignedInt calcCRC( AsciiString fname )
+// TheSuperHackers @performance The maps that need a new CRC or a new parse are read on the main thread in
+// batches of about this many bytes. The worker threads then compute the CRCs and decompress the maps.
+static const Int MAP_CACHE_BATCH_BYTES = 16 * 1024 * 1024;
+
+//-------------------------------------------------------------------------------------------------
+struct MapFileWork
 {
-	CRC theCRC;
-	theCRC.clear();
+	MapFileWork() : buffer(nullptr), size(0), crc(0) {}
+
+	char *buffer;										///< file contents, handed over to the job
+	Int size;
+	UnsignedInt crc;
+	CachedFileInputStream stream;
+};
+
+//-------------------------------------------------------------------------------------------------
+/** Reads the file like the CRC always did, without File::BINARY, because the CRC of a user map
+	* is compared with the CRC that other players computed for the same map. */
+//-------------------------------------------------------------------------------------------------
+static char *readFileForCRC( const AsciiString &fname, Int &size )
+{
+	size = 0;
 
 	File *fp = TheFileSystem->openFile(fname.str(), File::READ);
 	if( !fp )
 	{
 		DEBUG_CRASH(("Couldn't open '%s'", fname.str()));
-		return 0;
+		return nullptr;
 	}
 
-	UnsignedByte buf[4096];
+	const Int capacity = fp->size();
+	char *buffer = NEW char[max(capacity, 1)];
+
 	Int num;
-	while ( (num=fp->read(buf, 4096)) > 0 )
+	while ( size < capacity && (num=fp->read(buffer + size, capacity - size)) > 0 )
 	{
-		theCRC.computeCRC(buf, num);
+		size += num;
 	}
 
 	fp->close();
 	fp = nullptr;
 
-	return theCRC.get();
+	return buffer;
+}
+
+//-------------------------------------------------------------------------------------------------
+static char *readFileForParse( const AsciiString &fname, Int &size )
+{
+	size = 0;
+
+	File *fp = TheFileSystem->openFile(fname.str(), File::READ | File::BINARY);
+	if( !fp )
+	{
+		return nullptr;
+	}
+
+	size = fp->size();
+	if( size == 0 )
+	{
+		fp->close();
+		return nullptr;
+	}
+
+	return fp->readEntireAndClose();
+}
+
+//-------------------------------------------------------------------------------------------------
+static void calcCRCJob( void *userData, Int index )
+{
+	MapFileWork &work = static_cast<MapFileWork *>(userData)[index];
+
+	CRC theCRC;
+	theCRC.clear();
+	theCRC.computeCRC(work.buffer, work.size);
+	work.crc = theCRC.get();
+
+	delete[] work.buffer;
+	work.buffer = nullptr;
+}
+
+//-------------------------------------------------------------------------------------------------
+static void openStreamJob( void *userData, Int index )
+{
+	MapFileWork &work = static_cast<MapFileWork *>(userData)[index];
+
+	work.stream.openBuffer(work.buffer, work.size);
+	work.buffer = nullptr;
+}
+
+//-------------------------------------------------------------------------------------------------
+/** Reads the files from first on until about MAP_CACHE_BATCH_BYTES are read, and returns the
+	* index after the last file that was read. */
+//-------------------------------------------------------------------------------------------------
+typedef char *(*ReadFileFunction)( const AsciiString &fname, Int &size );
+
+static Int readFileBatch( ReadFileFunction readFile, const std::vector<const AsciiString *> &fnames, std::vector<MapFileWork> &work, Int first )
+{
+	const Int count = (Int)fnames.size();
+	Int batchBytes = 0;
+	Int last = first;
+
+	while( last < count && (last == first || batchBytes < MAP_CACHE_BATCH_BYTES) )
+	{
+		work[last].buffer = readFile(*fnames[last], work[last].size);
+		batchBytes += work[last].size;
+		++last;
+	}
+
+	return last;
 }
 
 static Bool ParseObjectDataChunk(DataChunkInput &file, DataChunkInfo *info, void *userData)
@@ -215,11 +304,9 @@ static Bool ParseSizeOnlyInChunk(DataChunkInput &file, DataChunkInfo *info, void
 	return ParseSizeOnly(file, info, userData);
 }
 
-static Bool loadMap( AsciiString filename )
+static Bool loadMap( CachedFileInputStream &fileStrm )
 {
-	CachedFileInputStream fileStrm;
-
-	if( !fileStrm.open(filename) )
+	if( fileStrm.eof() )
 	{
 		return FALSE;
 	}
@@ -311,6 +398,15 @@ void WaypointMap::update( void )
 }
 
 const char *const MapCache::m_mapCacheName = "MapCache.ini";
+const char *const MapCache::m_mapCacheBinaryName = "MapCache.bin";
+
+//-------------------------------------------------------------------------------------------------
+struct MapCache::MapFileCandidate
+{
+	AsciiString fname;
+	AsciiString lowerFname;
+	FileInfo fileInfo;
+};
 
 AsciiString MapCache::getMapDir() const
 {
@@ -404,6 +500,282 @@ void MapCache::writeCacheINI( const AsciiString &mapDir )
 	fclose(fp);
 }
 
+//-------------------------------------------------------------------------------------------------
+static void xferCoord3DList( Xfer *xfer, Coord3DList *positions )
+{
+	UnsignedShort count = (UnsignedShort)positions->size();
+	xfer->xferUnsignedShort( &count );
+
+	if( xfer->getXferMode() == XFER_SAVE )
+	{
+		for( Coord3DList::iterator it = positions->begin(); it != positions->end(); ++it )
+		{
+			xfer->xferCoord3D( &(*it) );
+		}
+	}
+	else
+	{
+		positions->clear();
+		for( UnsignedShort i = 0; i < count; ++i )
+		{
+			Coord3D pos;
+			xfer->xferCoord3D( &pos );
+			positions->push_back( pos );
+		}
+	}
+}
+
+//-------------------------------------------------------------------------------------------------
+/** Like Xfer::xferAsciiString, but with a 16 bit length, so that long map names fit */
+//-------------------------------------------------------------------------------------------------
+static void xferLongAsciiString( Xfer *xfer, AsciiString *str )
+{
+	UnsignedShort len = (UnsignedShort)str->getLength();
+	xfer->xferUnsignedShort( &len );
+
+	if( xfer->getXferMode() == XFER_SAVE )
+	{
+		if( len > 0 )
+			xfer->xferUser( (void *)str->str(), sizeof( Char ) * len );
+	}
+	else if( len > 0 )
+	{
+		Char *buffer = str->getBufferForRead( len );
+		xfer->xferUser( buffer, sizeof( Char ) * len );
+		buffer[ len ] = 0;
+	}
+	else
+	{
+		str->clear();
+	}
+}
+
+//-------------------------------------------------------------------------------------------------
+/** Like Xfer::xferUnicodeString, but with a 16 bit length, so that long map names fit */
+//-------------------------------------------------------------------------------------------------
+static void xferLongUnicodeString( Xfer *xfer, UnicodeString *str )
+{
+	UnsignedShort len = (UnsignedShort)str->getLength();
+	xfer->xferUnsignedShort( &len );
+
+	if( xfer->getXferMode() == XFER_SAVE )
+	{
+		if( len > 0 )
+			xfer->xferUser( (void *)str->str(), sizeof( WideChar ) * len );
+	}
+	else if( len > 0 )
+	{
+		WideChar *buffer = str->getBufferForRead( len );
+		xfer->xferUser( buffer, sizeof( WideChar ) * len );
+		buffer[ len ] = 0;
+	}
+	else
+	{
+		str->clear();
+	}
+}
+
+//-------------------------------------------------------------------------------------------------
+static void xferMapMetaData( Xfer *xfer, MapMetaData *md )
+{
+	xferLongUnicodeString( xfer, &md->m_displayName );
+	xferLongAsciiString( xfer, &md->m_nameLookupTag );
+	xfer->xferRegion3D( &md->m_extent );
+	xfer->xferInt( &md->m_numPlayers );
+	xfer->xferBool( &md->m_isMultiplayer );
+	xfer->xferBool( &md->m_isOfficial );
+	xfer->xferUnsignedInt( &md->m_filesize );
+	xfer->xferUnsignedInt( &md->m_CRC );
+	xfer->xferUnsignedInt( &md->m_timestamp.m_lowTimeStamp );
+	xfer->xferUnsignedInt( &md->m_timestamp.m_highTimeStamp );
+
+	UnsignedShort waypointCount = (UnsignedShort)md->m_waypoints.size();
+	xfer->xferUnsignedShort( &waypointCount );
+	if( xfer->getXferMode() == XFER_SAVE )
+	{
+		for( WaypointMap::iterator it = md->m_waypoints.begin(); it != md->m_waypoints.end(); ++it )
+		{
+			AsciiString name = it->first;
+			xferLongAsciiString( xfer, &name );
+			xfer->xferCoord3D( &it->second );
+		}
+	}
+	else
+	{
+		md->m_waypoints.clear();
+		for( UnsignedShort i = 0; i < waypointCount; ++i )
+		{
+			AsciiString name;
+			Coord3D pos;
+			xferLongAsciiString( xfer, &name );
+			xfer->xferCoord3D( &pos );
+			md->m_waypoints[name] = pos;
+		}
+	}
+
+	xferCoord3DList( xfer, &md->m_supplyPositions );
+	xferCoord3DList( xfer, &md->m_techPositions );
+}
+
+// Version 2 stores the strings with 16 bit lengths, version 1 files are rebuilt from the INI.
+static const XferVersion MAP_CACHE_BINARY_VERSION = 2;
+
+//-------------------------------------------------------------------------------------------------
+/** Entries are stored with their names relative to the map folder, so that a moved user data
+	* folder keeps its cache. */
+//-------------------------------------------------------------------------------------------------
+void MapCache::writeCacheBinary( const AsciiString &mapDir )
+{
+	AsciiString filepath;
+	filepath.format("%s\\%s", mapDir.str(), m_mapCacheBinaryName);
+
+	TheFileSystem->createDirectory(mapDir);
+
+	// The binary file replaces the INI when it loads, so it must hold every entry. If one does not
+	// fit, there is no binary file and the INI is loaded instead.
+	std::vector<MapCache::iterator> entries;
+	for (MapCache::iterator it = begin(); it != end(); ++it)
+	{
+		if (!it->first.startsWithNoCase(mapDir.str()))
+			continue;
+
+		const MapMetaData &md = it->second;
+		Bool fits = it->first.getLength() - mapDir.getLength() <= 0xFFFF
+			&& md.m_displayName.getLength() <= 0xFFFF
+			&& md.m_nameLookupTag.getLength() <= 0xFFFF
+			&& md.m_waypoints.size() <= 0xFFFF
+			&& md.m_supplyPositions.size() <= 0xFFFF
+			&& md.m_techPositions.size() <= 0xFFFF;
+
+		for (WaypointMap::const_iterator itw = md.m_waypoints.begin(); fits && itw != md.m_waypoints.end(); ++itw)
+		{
+			fits = itw->first.getLength() <= 0xFFFF;
+		}
+
+		if (!fits)
+		{
+			DEBUG_LOG(("MapCache::writeCacheBinary - %s does not fit, leaving the map cache to the INI", it->first.str()));
+			remove(filepath.str());
+			return;
+		}
+
+		entries.push_back(it);
+	}
+
+	XferSave xfer;
+	Bool isOpen = FALSE;
+	try
+	{
+		xfer.open(filepath);
+		isOpen = TRUE;
+
+		XferVersion version = MAP_CACHE_BINARY_VERSION;
+		xfer.xferVersion(&version, MAP_CACHE_BINARY_VERSION);
+
+		Int count = (Int)entries.size();
+		xfer.xferInt(&count);
+
+		for (Int i = 0; i < count; ++i)
+		{
+			AsciiString relativeName = entries[i]->first.str() + mapDir.getLength();
+			xferLongAsciiString(&xfer, &relativeName);
+			xferMapMetaData(&xfer, &entries[i]->second);
+		}
+
+		isOpen = FALSE;
+		xfer.close();
+	}
+	catch (...)
+	{
+		DEBUG_CRASH(("Failed to write %s", filepath.str()));
+		if (isOpen)
+		{
+			xfer.close();
+		}
+		remove(filepath.str());
+	}
+}
+
+Bool MapCache::loadMapsFromMapCacheBinary( const AsciiString &mapDir )
+{
+	AsciiString filepath;
+	filepath.format("%s\\%s", mapDir.str(), m_mapCacheBinaryName);
+
+	if (!TheFileSystem->doesFileExist(filepath.str()))
+	{
+		return FALSE;
+	}
+
+	AsciiString lowerMapDir = mapDir;
+	lowerMapDir.toLower();
+
+	std::vector<std::pair<AsciiString, MapMetaData> > entries;
+
+	XferLoad xfer;
+	Bool isOpen = FALSE;
+	try
+	{
+		xfer.open(filepath);
+		isOpen = TRUE;
+
+		// Any other version is treated like a missing file, so that the INI is loaded instead.
+		UnsignedByte version;
+		xfer.xferUnsignedByte(&version);
+		if (version != MAP_CACHE_BINARY_VERSION)
+		{
+			DEBUG_LOG(("MapCache::loadMapsFromMapCacheBinary - %s has version %d instead of %d", filepath.str(), version, MAP_CACHE_BINARY_VERSION));
+			isOpen = FALSE;
+			xfer.close();
+			return FALSE;
+		}
+
+		Int count;
+		xfer.xferInt(&count);
+		if (count < 0)
+		{
+			throw XFER_READ_ERROR;
+		}
+
+		entries.resize(count);
+		for (Int i = 0; i < count; ++i)
+		{
+			AsciiString relativeName;
+			xferLongAsciiString(&xfer, &relativeName);
+
+			entries[i].first = lowerMapDir;
+			entries[i].first.concat(relativeName);
+			xferMapMetaData(&xfer, &entries[i].second);
+		}
+
+		isOpen = FALSE;
+		xfer.close();
+	}
+	catch (...)
+	{
+		DEBUG_LOG(("MapCache::loadMapsFromMapCacheBinary - %s is unusable", filepath.str()));
+		if (isOpen)
+		{
+			xfer.close();
+		}
+		return FALSE;
+	}
+
+	for (size_t i = 0; i < entries.size(); ++i)
+	{
+		MapMetaData &md = entries[i].second;
+
+		// Same as the INI, see INI::parseMapCacheDefinition.
+		if (md.m_displayName.isEmpty())
+			continue;
+
+		md.m_fileName = entries[i].first;
+		md.m_doesExist = TRUE;
+		(*this)[entries[i].first] = md;
+	}
+
+	return TRUE;
+}
+
 void MapCache::updateCache( void )
 {
 	setFPMode();
@@ -435,19 +807,30 @@ void MapCache::updateCache( void )
 	}
 
 	// Load user map cache first.
-	if (m_doLoadUserMapCacheINI)
+	if (m_doLoadUserMapCache)
 	{
-		loadMapsFromMapCacheINI(userMapDir);
-		m_doLoadUserMapCacheINI = FALSE;
+		if (!loadMapsFromMapCacheBinary(userMapDir))
+		{
+			loadMapsFromMapCacheINI(userMapDir);
+			m_doWriteUserMapCacheBinary = TRUE;
+		}
+		m_doLoadUserMapCache = FALSE;
 	}
 
 	// Load user maps from disk and update any discrepancies from the map cache.
 	if (loadMapsFromDisk(userMapDir, FALSE))
 	{
 		writeCacheINI(userMapDir);
+		m_doWriteUserMapCacheBinary = TRUE;
 		m_doLoadStandardMapCacheINI = TRUE;
 	}
 
+	if (m_doWriteUserMapCacheBinary)
+	{
+		writeCacheBinary(userMapDir);
+		m_doWriteUserMapCacheBinary = FALSE;
+	}
+
 	// Load standard maps from map cache last.
 	// This overwrites matching user maps to prevent munkees getting rowdy :)
 	if (m_doLoadStandardMapCacheINI)
@@ -510,6 +893,10 @@ void MapCache::loadMapsFromMapCacheINI( const AsciiString &mapDir )
 
 Bool MapCache::loadMapsFromDisk( const AsciiString &mapDir, Bool isOfficial, Bool filterByAllowedMaps )
 {
+#ifdef DEBUG_LOGGING
+	const UnsignedInt startTime = timeGetTime();
+#endif
+
 	prepareUnseenMaps(mapDir);
 
 	FilenameList filepathList;
@@ -522,6 +909,8 @@ Bool MapCache::loadMapsFromDisk( const AsciiString &mapDir, Bool isOfficial, Boo
 
 	TheFileSystem->getFileListInDirectory(toplevelPattern, filenamepattern, filepathList, TRUE);
 
+	std::vector<MapFileCandidate> candidates;
+
 	filepathIt = filepathList.begin();
 
 	for (; filepathIt != filepathList.end(); ++filepathIt)
@@ -561,7 +950,18 @@ Bool MapCache::loadMapsFromDisk( const AsciiString &mapDir, Bool isOfficial, Boo
 			continue;
 		}
 
-		mapListChanged |= addMap(mapDir, *filepathIt, filepathLower, fileInfo, isOfficial);
+		if (!addCachedMap(*filepathIt, filepathLower, fileInfo))
+		{
+			candidates.push_back(MapFileCandidate());
+			candidates.back().fname = *filepathIt;
+			candidates.back().lowerFname = filepathLower;
+			candidates.back().fileInfo = fileInfo;
+		}
+	}
+
+	if (!candidates.empty())
+	{
+		mapListChanged |= addMaps(mapDir, candidates, isOfficial);
 	}
 
 	if (clearUnseenMaps(mapDir))
@@ -569,69 +969,174 @@ Bool MapCache::loadMapsFromDisk( const AsciiString &mapDir, Bool isOfficial, Boo
 		mapListChanged = TRUE;
 	}
 
+	DEBUG_LOG(("MapCache::loadMapsFromDisk - Checked %d maps in '%s' in %u ms, %d were not cached with the same size and timestamp",
+		(Int)filepathList.size(), mapDir.str(), timeGetTime() - startTime, (Int)candidates.size()));
+
 	return mapListChanged;
 }
 
-Bool MapCache::addMap(
-	const AsciiString &mapDir,
+void MapCache::updateDisplayName( const AsciiString &fname, MapMetaData &md )
+{
+	// Force a lookup so that we don't display the English localization in all builds.
+	if (md.m_nameLookupTag.isEmpty())
+	{
+		// unofficial maps or maps without names
+		AsciiString tempdisplayname;
+		tempdisplayname = fname.reverseFind('\\') + 1;
+		md.m_displayName.translate(tempdisplayname);
+		if (md.m_numPlayers >= 2)
+		{
+			UnicodeString extension;
+			extension.format(L" (%d)", md.m_numPlayers);
+			md.m_displayName.concat(extension);
+		}
+	}
+	else
+	{
+		// official maps with name tags
+		md.m_displayName = TheGameText->fetch(md.m_nameLookupTag);
+		if (md.m_numPlayers >= 2)
+		{
+			UnicodeString extension;
+			extension.format(L" (%d)", md.m_numPlayers);
+			md.m_displayName.concat(extension);
+		}
+	}
+}
+
+Bool MapCache::addCachedMap(
 	const AsciiString &fname,
 	const AsciiString &lowerFname,
-	FileInfo &fileInfo,
-	Bool isOfficial)
+	const FileInfo &fileInfo)
 {
 	MapCache::iterator it = find(lowerFname);
-	if (it != end())
+	if (it == end())
+	{
+		return FALSE;
+	}
+
+	// Found the map in our cache. Check to see if it has changed.
+	MapMetaData& md = it->second;
+
+	// TheSuperHackers @performance The timestamp is compared as well now. A map with a new timestamp gets a new CRC,
+	// and keeps its cached data if the CRC did not change, see MapCache::addMaps.
+	if (md.m_filesize == (UnsignedInt)fileInfo.sizeLow
+		&& md.m_timestamp.m_lowTimeStamp == (UnsignedInt)fileInfo.timestampLow
+		&& md.m_timestamp.m_highTimeStamp == (UnsignedInt)fileInfo.timestampHigh
+		&& md.m_CRC != 0)
 	{
-		// Found the map in our cache. Check to see if it has changed.
-		const MapMetaData& md = it->second;
+		updateDisplayName(fname, md);
+
+		md.m_doesExist = TRUE;
+
+//		DEBUG_LOG(("MapCache::addCachedMap - found match for map %s", lowerFname.str()));
+		return TRUE;	// OK, it checks out.
+	}
+	DEBUG_LOG(("%s didn't match file in MapCache", fname.str()));
+	DEBUG_LOG(("size: %d / %d", fileInfo.sizeLow, md.m_filesize));
+	DEBUG_LOG(("time1: %d / %d", fileInfo.timestampHigh, md.m_timestamp.m_highTimeStamp));
+	DEBUG_LOG(("time2: %d / %d", fileInfo.timestampLow, md.m_timestamp.m_lowTimeStamp));
+
+	return FALSE;
+}
+
+//-------------------------------------------------------------------------------------------------
+/** Computes the CRCs and decompresses the maps on the worker threads. Parsing the maps stays on the
+	* main thread, because the parsers use the name keys, the thing factory and the game text, which
+	* are not thread safe. The results are added in the order of the candidates. */
+//-------------------------------------------------------------------------------------------------
+Bool MapCache::addMaps(
+	const AsciiString &mapDir,
+	const std::vector<MapFileCandidate> &candidates,
+	Bool isOfficial)
+{
+#ifdef DEBUG_LOGGING
+	const UnsignedInt startTime = timeGetTime();
+#endif
+
+	const Int count = (Int)candidates.size();
+
+	std::vector<const AsciiString *> fnames(count);
+	for (Int i = 0; i < count; ++i)
+	{
+		fnames[i] = &candidates[i].fname;
+	}
 
-		if (md.m_filesize == fileInfo.sizeLow && md.m_CRC != 0)
+	std::vector<MapFileWork> crcWork(count);
+	for (Int first = 0; first < count; )
+	{
+		const Int last = readFileBatch(readFileForCRC, fnames, crcWork, first);
+		WorkerThreadPool::parallelFor(calcCRCJob, &crcWork[first], last - first);
+		first = last;
+	}
+
+	// A map that only got a new timestamp keeps its cached data.
+	std::vector<Int> parseIndices;
+	std::vector<const AsciiString *> parseFnames;
+
+	for (Int i = 0; i < count; ++i)
+	{
+		const MapFileCandidate &candidate = candidates[i];
+		const UnsignedInt crc = crcWork[i].crc;
+
+		MapCache::iterator it = find(candidate.lowerFname);
+		if (it != end() && crc != 0 && it->second.m_CRC == crc && it->second.m_filesize == (UnsignedInt)candidate.fileInfo.sizeLow)
 		{
-			// Force a lookup so that we don't display the English localization in all builds.
-			if (md.m_nameLookupTag.isEmpty())
-			{
-				// unofficial maps or maps without names
-				AsciiString tempdisplayname;
-				tempdisplayname = fname.reverseFind('\\') + 1;
-				(*this)[lowerFname].m_displayName.translate(tempdisplayname);
-				if (md.m_numPlayers >= 2)
-				{
-					UnicodeString extension;
-					extension.format(L" (%d)", md.m_numPlayers);
-					(*this)[lowerFname].m_displayName.concat(extension);
-				}
-			}
-			else
-			{
-				// official maps with name tags
-				(*this)[lowerFname].m_displayName = TheGameText->fetch(md.m_nameLookupTag);
-				if (md.m_numPlayers >= 2)
-				{
-					UnicodeString extension;
-					extension.format(L" (%d)", md.m_numPlayers);
-					(*this)[lowerFname].m_displayName.concat(extension);
-				}
-			}
+			DEBUG_LOG(("MapCache::addMaps(): '%s' has a new timestamp, but the same CRC %X", candidate.fname.str(), crc));
+
+			MapMetaData &md = it->second;
+			md.m_timestamp.m_highTimeStamp = candidate.fileInfo.timestampHigh;
+			md.m_timestamp.m_lowTimeStamp = candidate.fileInfo.timestampLow;
+			md.m_doesExist = TRUE;
+			updateDisplayName(candidate.fname, md);
+		}
+		else
+		{
+			parseIndices.push_back(i);
+			parseFnames.push_back(&candidate.fname);
+		}
+	}
+
+	const Int parseCount = (Int)parseIndices.size();
+
+	std::vector<MapFileWork> parseWork(parseCount);
+	for (Int first = 0; first < parseCount; )
+	{
+		const Int last = readFileBatch(readFileForParse, parseFnames, parseWork, first);
+		WorkerThreadPool::parallelFor(openStreamJob, &parseWork[first], last - first);
+
+		for (Int i = first; i < last; ++i)
+		{
+			const Int index = parseIndices[i];
 
-			it->second.m_doesExist = TRUE;
+			DEBUG_LOG(("MapCache::addMaps(): caching '%s' because '%s' was not found", candidates[index].fname.str(), candidates[index].lowerFname.str()));
 
-//			DEBUG_LOG(("MapCache::addMap - found match for map %s", lowerFname.str()));
-			return FALSE;	// OK, it checks out.
+			loadMap(parseWork[i].stream); // Just load for querying the data, since we aren't playing this map.
+			addParsedMap(mapDir, candidates[index], isOfficial, crcWork[index].crc);
+			parseWork[i].stream.close();
 		}
-		DEBUG_LOG(("%s didn't match file in MapCache", fname.str()));
-		DEBUG_LOG(("size: %d / %d", fileInfo.sizeLow, md.m_filesize));
-		DEBUG_LOG(("time1: %d / %d", fileInfo.timestampHigh, md.m_timestamp.m_highTimeStamp));
-		DEBUG_LOG(("time2: %d / %d", fileInfo.timestampLow, md.m_timestamp.m_lowTimeStamp));
-//		DEBUG_LOG(("size: %d / %d", filesize, md.m_filesize));
-//		DEBUG_LOG(("time1: %d / %d", timestamp.m_highTimeStamp, md.m_timestamp.m_highTimeStamp));
-//		DEBUG_LOG(("time2: %d / %d", timestamp.m_lowTimeStamp, md.m_timestamp.m_lowTimeStamp));
+
+		first = last;
 	}
 
-	DEBUG_LOG(("MapCache::addMap(): caching '%s' because '%s' was not found", fname.str(), lowerFname.str()));
+	DEBUG_LOG(("MapCache::addMaps - Computed %d CRCs and parsed %d maps in %u ms on %d worker threads",
+		count, parseCount, timeGetTime() - startTime, TheWorkerThreadPool ? TheWorkerThreadPool->getThreadCount() : 0));
 
-	loadMap(fname); // Just load for querying the data, since we aren't playing this map.
+	// Every candidate either got a new timestamp or new data.
+	return TRUE;
+}
 
+void MapCache::addParsedMap(
+	const AsciiString &mapDir,
+	const MapFileCandidate &candidate,
+	Bool isOfficial,
+	UnsignedInt crc)
+{
 	// The map is now loaded.  Pick out what we need.
+	const AsciiString &fname = candidate.fname;
+	const AsciiString &lowerFname = candidate.lowerFname;
+	const FileInfo &fileInfo = candidate.fileInfo;
+
 	MapMetaData md;
 	md.m_fileName = lowerFname;
 	md.m_filesize = fileInfo.sizeLow;
@@ -644,7 +1149,7 @@ Bool MapCache::addMap(
 	md.m_timestamp.m_lowTimeStamp = fileInfo.timestampLow;
 	md.m_supplyPositions = m_supplyPositions;
 	md.m_techPositions = m_techPositions;
-	md.m_CRC = calcCRC(fname);
+	md.m_CRC = crc;
 
 	Bool exists = false;
 	AsciiString nameLookupTag = worldDict.getAsciiString(TheKey_mapName, &exists);
@@ -708,8 +1213,6 @@ Bool MapCache::addMap(
 	}
 
 	resetMap();
-
-	return TRUE;
 }
 
 MapCache *TheMapCache = nullptr;
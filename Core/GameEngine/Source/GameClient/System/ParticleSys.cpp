@@ -325,6 +325,8 @@ Particle::Particle( ParticleSystem *system, const ParticleInfo *info )
 
 	m_inSystemList = m_inOverallList = FALSE;
 	m_systemPrev = m_systemNext = m_overallPrev = m_overallNext = nullptr;
+	m_store = nullptr;
+	m_storeIndex = -1;
 
 	// add this particle to the global list, retaining particle creation order
 	TheParticleSystemManager->addParticle(this, system->getPriority() );
@@ -362,74 +364,54 @@ Particle::~Particle()
 // ------------------------------------------------------------------------------------------------
 void Particle::applyForce( const Coord3D *force )
 {
+	if (m_store)
+	{
+		m_store->m_accelX[ m_storeIndex ] += force->x;
+		m_store->m_accelY[ m_storeIndex ] += force->y;
+		m_store->m_accelZ[ m_storeIndex ] += force->z;
+		return;
+	}
+
 	m_accel.x += force->x;
 	m_accel.y += force->y;
 	m_accel.z += force->z;
 }
 
 // ------------------------------------------------------------------------------------------------
-/** Update the behavior of an individual particle */
+/** Update the behavior of an individual particle. Its motion, size and lifetime were already
+	* updated by the ParticleStore of its system. */
 // ------------------------------------------------------------------------------------------------
-Bool Particle::update( void )
+Bool Particle::update( const ParticleUpdateContext& context )
 {
-	// integrate acceleration into velocity
-	m_vel.x += m_accel.x;
-	m_vel.y += m_accel.y;
-	m_vel.z += m_accel.z;
-
-	m_vel.x *= m_velDamping;
-	m_vel.y *= m_velDamping;
-	m_vel.z *= m_velDamping;
-
-	// integrate velocity into position
-	const Coord3D *driftVel = m_system->getDriftVelocity();
-	m_pos.x += m_vel.x + driftVel->x;
-	m_pos.y += m_vel.y + driftVel->y;
-	m_pos.z += m_vel.z + driftVel->z;
-
-	// integrate the wind (if specified) into position
-	ParticleSystemInfo::WindMotion windMotion = m_system->getWindMotion();
-
-	// see if we should even do anything
-	if( windMotion != ParticleSystemInfo::WIND_MOTION_NOT_USED )
-		doWindMotion();
-
 	// update orientation
 #if PARTICLE_USE_XY_ROTATION
 	m_angleX += m_angularRateX;
 	m_angleY += m_angularRateY;
-#endif
-	m_angleZ += m_angularRateZ;
-#if PARTICLE_USE_XY_ROTATION
 	m_angularRateX *= m_angularDamping;
 	m_angularRateY *= m_angularDamping;
 #endif
-	m_angularRateZ *= m_angularDamping;
 
 	if (m_particleUpTowardsEmitter) {
 		// adjust the up position back towards the particle
 		static const Coord2D upVec = { 0.0f, 1.0f };
+		const Coord3D *pos = getPosition();
 		Coord2D emitterDir;
-		emitterDir.x = m_pos.x - m_emitterPos.x;
-		emitterDir.y = m_pos.y - m_emitterPos.y;
-		m_angleZ = (angleBetween(&upVec, &emitterDir) + PI);
+		emitterDir.x = pos->x - m_emitterPos.x;
+		emitterDir.y = pos->y - m_emitterPos.y;
+		m_store->m_angleZ[ m_storeIndex ] = (angleBetween(&upVec, &emitterDir) + PI);
 	}
 
-	// update size
-	m_size += m_sizeRate;
-	m_sizeRate *= m_sizeRateDamping;
-
 	//
 	// Update alpha (if used)
 	//
 
-	if (m_system->getShaderType() != ParticleSystemInfo::ADDITIVE)
+	if (context.m_shaderType != ParticleSystemInfo::ADDITIVE)
 	{
 		m_alpha += m_alphaRate;
 
 		if (m_alphaTargetKey < MAX_KEYFRAMES && m_alphaKey[ m_alphaTargetKey ].frame)
 		{
-			if (TheGameClient->getFrame() - m_createTimestamp >= m_alphaKey[ m_alphaTargetKey ].frame)
+			if (context.m_frame - m_createTimestamp >= m_alphaKey[ m_alphaTargetKey ].frame)
 			{
 				m_alpha = m_alphaKey[ m_alphaTargetKey ].value;
 				m_alphaTargetKey++;
@@ -455,7 +437,7 @@ Bool Particle::update( void )
 
 	if (m_colorTargetKey < MAX_KEYFRAMES && m_colorKey[ m_colorTargetKey ].frame)
 	{
-		if (TheGameClient->getFrame() - m_createTimestamp >= m_colorKey[ m_colorTargetKey ].frame)
+		if (context.m_frame - m_createTimestamp >= m_colorKey[ m_colorTargetKey ].frame)
 		{
 			// can't set, because of colorscale
 			// m_color = m_colorKey[ m_colorTargetKey ].color;
@@ -491,119 +473,42 @@ Bool Particle::update( void )
 		m_color.blue = 1.0f;
 
 
-	// reset the acceleration for accumulation next frame
-	m_accel.x = 0.0f;
-	m_accel.y = 0.0f;
-	m_accel.z = 0.0f;
-
-	// monitor lifetime
-	if (m_lifetimeLeft && --m_lifetimeLeft == 0)
-		return false;
-
-	DEBUG_ASSERTCRASH( m_lifetimeLeft, ( "A particle has an infinite lifetime..." ));
-
 	// if we've gone totally invisible, destroy ourselves
-	if (isInvisible())
+	if (isInvisible( context ))
 		return false;
 	return true;
 }
 
 // ------------------------------------------------------------------------------------------------
-/** Do wind motion as specified by the particle system template, if present */
+/** Get priority of a particle ... which is the priority of it's attached system */
 // ------------------------------------------------------------------------------------------------
-void Particle::doWindMotion( void )
+ParticlePriorityType Particle::getPriority( void )
 {
+	return m_system->getPriority();
+}
 
-	// get the angle of the wind
-	Real windAngle = m_system->getWindAngle();
-
-	// get the system position
-	Coord3D systemPos;
-	m_system->getPosition( &systemPos );
-
-	// when we're attached objects and drawables we offset by that position as well
-	if( ObjectID attachedObj = m_system->getAttachedObject() )
-	{
-		Object *obj = TheGameLogic->findObjectByID( attachedObj );
-
-		if( obj )
-		{
-			const Coord3D *objPos = obj->getPosition();
-
-			systemPos.x += objPos->x;
-			systemPos.y += objPos->y;
-			systemPos.z += objPos->z;
-
-		}
-
-	}
-	else if( DrawableID attachedDraw = m_system->getAttachedDrawable() )
-	{
-		Drawable *draw = TheGameClient->findDrawableByID( attachedDraw );
-
-		if( draw )
-		{
-			const Coord3D *drawPos = draw->getPosition();
-
-			systemPos.x += drawPos->x;
-			systemPos.y += drawPos->y;
-			systemPos.z += drawPos->z;
-
-		}
-
-	}
-
-	//
-	// compute a vector from the system position in the world to the particle ... we will use
-	// this to compute how much force we apply
-	//
-	Coord3D v;
-	v.x = m_pos.x - systemPos.x;
-	v.y = m_pos.y - systemPos.y;
-	v.z = m_pos.z - systemPos.z;
-
-	// distance amounts for full force from wind and no force at all
-	Real fullForceDistance = 75.0f;
-	Real noForceDistance = 200.0f;
-
-	//
-	// given the distance from the wind position to the particle ... figure out how much
-	// force we're going to apply to it.  When it's further away (outside of the full force
-	// distance) we will apply only a fraction of the force
-	//
-
-	Real distFromWind = v.length();
-	if( distFromWind < noForceDistance )
-	{
-		Real windForceStrength = 2.0f * m_windRandomness;
-
-		// only apply force if still within the circle of influence
-		if( distFromWind > fullForceDistance )
-			windForceStrength *= (1.0f - ((distFromWind - fullForceDistance) /
-																		(noForceDistance - fullForceDistance)));
-
-		// integrate the wind motion into the position
-		m_pos.x += (Cos( windAngle ) * windForceStrength);
-		m_pos.y += (Sin( windAngle ) * windForceStrength);
-
-	}
-
+// ------------------------------------------------------------------------------------------------
+/** Return true if this particle is invisible */
+// ------------------------------------------------------------------------------------------------
+Bool Particle::isInvisible( void )
+{
+	return isInvisibleWithShader( m_system->getShaderType() );
 }
 
 // ------------------------------------------------------------------------------------------------
-/** Get priority of a particle ... which is the priority of it's attached system */
+/** Return true if this particle is invisible, using the shader type cached in the update context */
 // ------------------------------------------------------------------------------------------------
-ParticlePriorityType Particle::getPriority( void )
+Bool Particle::isInvisible( const ParticleUpdateContext& context )
 {
-	return m_system->getPriority();
+	return isInvisibleWithShader( context.m_shaderType );
 }
 
 // ------------------------------------------------------------------------------------------------
-/** Return true if this particle is invisible */
+/** Return true if this particle is invisible when drawn with the given shader type */
 // ------------------------------------------------------------------------------------------------
-Bool Particle::isInvisible( void )
+Bool Particle::isInvisibleWithShader( ParticleSystemInfo::ParticleShaderType shaderType )
 {
-	switch (m_system->getShaderType())
+	switch (shaderType)
 	{
 		case ParticleSystemInfo::ADDITIVE:
 			// if color is black, this particle is invisible
@@ -636,6 +541,9 @@ Bool Particle::isInvisible( void )
 					return true;
 			}
 			return false;
+
+		default:
+			break;
 	}
 
 	// should never get here - if we do, data is incorrect
@@ -663,6 +571,10 @@ void Particle::xfer( Xfer *xfer )
 	XferVersion version = currentVersion;
 	xfer->xferVersion( &version, currentVersion );
 
+	// the motion state lives in the store of our system
+	if( m_store && xfer->getXferMode() != XFER_LOAD )
+		m_store->copyToParticle( m_storeIndex, this );
+
 	// base class particle info
 	ParticleInfo::xfer( xfer );
 
@@ -707,6 +619,9 @@ void Particle::xfer( Xfer *xfer )
 	ParticleSystemID systemUnderControlID = m_systemUnderControl ? m_systemUnderControl->getSystemID() : INVALID_PARTICLE_SYSTEM_ID;
 	xfer->xferUser( &systemUnderControlID, sizeof( ParticleSystemID ) );
 
+	if( m_store && xfer->getXferMode() == XFER_LOAD )
+		m_store->copyFromParticle( m_storeIndex, this );
+
 }
 
 // ------------------------------------------------------------------------------------------------
@@ -743,6 +658,307 @@ void Particle::loadPostProcess( void )
 
 }
 
+///////////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+// ------------------------------------------------------------------------------------------------
+/** Append an entry for the given particle and take over its motion state */
+// ------------------------------------------------------------------------------------------------
+void ParticleStore::add( Particle *particle )
+{
+	DEBUG_ASSERTCRASH( particle->m_store == nullptr, ("ParticleStore::add - Particle is already in a store") );
+
+	const Int index = getCount();
+	resize( index + 1 );
+	m_particle[ index ] = particle;
+	copyFromParticle( index, particle );
+
+	particle->m_store = this;
+	particle->m_storeIndex = index;
+}
+
+// ------------------------------------------------------------------------------------------------
+/** Remove the entry of the given particle, if it has one. Its motion state is written back into
+	* the particle, and the last entry moves into the free slot. */
+// ------------------------------------------------------------------------------------------------
+void ParticleStore::remove( Particle *particle )
+{
+	if (particle->m_store != this)
+		return;
+
+	const Int index = particle->m_storeIndex;
+	copyToParticle( index, particle );
+	particle->m_store = nullptr;
+	particle->m_storeIndex = -1;
+
+	const Int last = getCount() - 1;
+	if (index != last)
+		moveEntry( last, index );
+	resize( last );
+}
+
+// ------------------------------------------------------------------------------------------------
+/** Integrate the acceleration, velocity, wind, rotation and size of all entries, and count down
+	* their lifetime. Each step is a loop over the arrays of the fields it touches. An entry whose
+	* lifetime runs out is marked dead. */
+// ------------------------------------------------------------------------------------------------
+void ParticleStore::update( const ParticleUpdateContext& context )
+{
+	const Int count = getCount();
+	if (count == 0)
+		return;
+
+	Real *posX = &m_posX[0];
+	Real *posY = &m_posY[0];
+	Real *posZ = &m_posZ[0];
+	Real *velX = &m_velX[0];
+	Real *velY = &m_velY[0];
+	Real *velZ = &m_velZ[0];
+	Real *accelX = &m_accelX[0];
+	Real *accelY = &m_accelY[0];
+	Real *accelZ = &m_accelZ[0];
+	const Real *velDamping = &m_velDamping[0];
+	Int i;
+
+	// apply 'gravity' force and integrate acceleration into velocity
+	const Real gravity = context.m_gravity;
+	for (i = 0; i < count; ++i)
+	{
+		velX[i] = (velX[i] + accelX[i]) * velDamping[i];
+		velY[i] = (velY[i] + accelY[i]) * velDamping[i];
+		velZ[i] = (velZ[i] + (accelZ[i] + gravity)) * velDamping[i];
+	}
+
+	// integrate velocity into position
+	const Real driftX = context.m_driftVelocity.x;
+	const Real driftY = context.m_driftVelocity.y;
+	const Real driftZ = context.m_driftVelocity.z;
+	for (i = 0; i < count; ++i)
+	{
+		posX[i] += velX[i] + driftX;
+		posY[i] += velY[i] + driftY;
+		posZ[i] += velZ[i] + driftZ;
+	}
+
+	// integrate the wind (if specified) into position
+	if (context.m_doWindMotion)
+	{
+		// distance amounts for full force from wind and no force at all
+		const Real fullForceDistance = 75.0f;
+		const Real noForceDistance = 200.0f;
+		const Real *windRandomness = &m_windRandomness[0];
+
+		for (i = 0; i < count; ++i)
+		{
+			Coord3D v;
+			v.x = posX[i] - context.m_windPos.x;
+			v.y = posY[i] - context.m_windPos.y;
+			v.z = posZ[i] - context.m_windPos.z;
+
+			// when the particle is outside of the full force distance, only a fraction of the force is applied
+			Real distFromWind = v.length();
+			if( distFromWind < noForceDistance )
+			{
+				Real windForceStrength = 2.0f * windRandomness[i];
+
+				if( distFromWind > fullForceDistance )
+					windForceStrength *= (1.0f - ((distFromWind - fullForceDistance) /
+																				(noForceDistance - fullForceDistance)));
+
+				posX[i] += (context.m_windDirX * windForceStrength);
+				posY[i] += (context.m_windDirY * windForceStrength);
+			}
+		}
+	}
+
+	// reset the acceleration for accumulation next frame
+	for (i = 0; i < count; ++i)
+	{
+		accelX[i] = 0.0f;
+		accelY[i] = 0.0f;
+		accelZ[i] = 0.0f;
+	}
+
+	// update orientation
+	Real *angleZ = &m_angleZ[0];
+	Real *angularRateZ = &m_angularRateZ[0];
+	const Real *angularDamping = &m_angularDamping[0];
+	for (i = 0; i < count; ++i)
+	{
+		angleZ[i] += angularRateZ[i];
+		angularRateZ[i] *= angularDamping[i];
+	}
+
+	// update size
+	Real *size = &m_size[0];
+	Real *sizeRate = &m_sizeRate[0];
+	const Real *sizeRateDamping = &m_sizeRateDamping[0];
+	for (i = 0; i < count; ++i)
+	{
+		size[i] += sizeRate[i];
+		sizeRate[i] *= sizeRateDamping[i];
+	}
+
+	// monitor lifetime, a lifetime of zero never runs out
+	UnsignedInt *lifetimeLeft = &m_lifetimeLeft[0];
+	UnsignedByte *isDead = &m_isDead[0];
+	for (i = 0; i < count; ++i)
+	{
+		DEBUG_ASSERTCRASH( lifetimeLeft[i], ( "A particle has an infinite lifetime..." ));
+		isDead[i] = (lifetimeLeft[i] == 1);
+		if (lifetimeLeft[i])
+			--lifetimeLeft[i];
+	}
+}
+
+// ------------------------------------------------------------------------------------------------
+/** Remove all dead entries in one pass that keeps the order of the others, then delete their
+	* particles. The particles are out of the store by then, so deleting them does not touch it. */
+// ------------------------------------------------------------------------------------------------
+void ParticleStore::deleteDeadParticles( void )
+{
+	const Int count = getCount();
+	Int kept = 0;
+	Int i;
+
+	for (i = 0; i < count; ++i)
+	{
+		if (m_isDead[i])
+		{
+			Particle *particle = m_particle[i];
+			copyToParticle( i, particle );
+			particle->m_store = nullptr;
+			particle->m_storeIndex = -1;
+			continue;
+		}
+
+		// all entries from kept up to here are dead, so keep their particles in the slot this entry leaves
+		if (kept != i)
+		{
+			Particle *deadParticle = m_particle[ kept ];
+			moveEntry( i, kept );
+			m_particle[i] = deadParticle;
+		}
+		++kept;
+	}
+
+	for (i = kept; i < count; ++i)
+		deleteInstance( m_particle[i] );
+
+	resize( kept );
+}
+
+// ------------------------------------------------------------------------------------------------
+// ------------------------------------------------------------------------------------------------
+void ParticleStore::getPosition( Int index, Coord3D *pos ) const
+{
+	pos->x = m_posX[ index ];
+	pos->y = m_posY[ index ];
+	pos->z = m_posZ[ index ];
+}
+
+// ------------------------------------------------------------------------------------------------
+// ------------------------------------------------------------------------------------------------
+void ParticleStore::copyToParticle( Int index, Particle *particle ) const
+{
+	getPosition( index, &particle->m_pos );
+	particle->m_vel.x = m_velX[ index ];
+	particle->m_vel.y = m_velY[ index ];
+	particle->m_vel.z = m_velZ[ index ];
+	particle->m_accel.x = m_accelX[ index ];
+	particle->m_accel.y = m_accelY[ index ];
+	particle->m_accel.z = m_accelZ[ index ];
+	particle->m_velDamping = m_velDamping[ index ];
+	particle->m_angleZ = m_angleZ[ index ];
+	particle->m_angularRateZ = m_angularRateZ[ index ];
+	particle->m_angularDamping = m_angularDamping[ index ];
+	particle->m_size = m_size[ index ];
+	particle->m_sizeRate = m_sizeRate[ index ];
+	particle->m_sizeRateDamping = m_sizeRateDamping[ index ];
+	particle->m_windRandomness = m_windRandomness[ index ];
+	particle->m_lifetimeLeft = m_lifetimeLeft[ index ];
+}
+
+// ------------------------------------------------------------------------------------------------
+// ------------------------------------------------------------------------------------------------
+void ParticleStore::copyFromParticle( Int index, const Particle *particle )
+{
+	m_posX[ index ] = particle->m_pos.x;
+	m_posY[ index ] = particle->m_pos.y;
+	m_posZ[ index ] = particle->m_pos.z;
+	m_velX[ index ] = particle->m_vel.x;
+	m_velY[ index ] = particle->m_vel.y;
+	m_velZ[ index ] = particle->m_vel.z;
+	m_accelX[ index ] = particle->m_accel.x;
+	m_accelY[ index ] = particle->m_accel.y;
+	m_accelZ[ index ] = particle->m_accel.z;
+	m_velDamping[ index ] = particle->m_velDamping;
+	m_angleZ[ index ] = particle->m_angleZ;
+	m_angularRateZ[ index ] = particle->m_angularRateZ;
+	m_angularDamping[ index ] = particle->m_angularDamping;
+	m_size[ index ] = particle->m_size;
+	m_sizeRate[ index ] = particle->m_sizeRate;
+	m_sizeRateDamping[ index ] = particle->m_sizeRateDamping;
+	m_windRandomness[ index ] = particle->m_windRandomness;
+	m_lifetimeLeft[ index ] = particle->m_lifetimeLeft;
+	m_isDead[ index ] = FALSE;
+}
+
+// ------------------------------------------------------------------------------------------------
+// ------------------------------------------------------------------------------------------------
+void ParticleStore::moveEntry( Int from, Int to )
+{
+	m_particle[ to ] = m_particle[ from ];
+	m_posX[ to ] = m_posX[ from ];
+	m_posY[ to ] = m_posY[ from ];
+	m_posZ[ to ] = m_posZ[ from ];
+	m_velX[ to ] = m_velX[ from ];
+	m_velY[ to ] = m_velY[ from ];
+	m_velZ[ to ] = m_velZ[ from ];
+	m_accelX[ to ] = m_accelX[ from ];
+	m_accelY[ to ] = m_accelY[ from ];
+	m_accelZ[ to ] = m_accelZ[ from ];
+	m_velDamping[ to ] = m_velDamping[ from ];
+	m_angleZ[ to ] = m_angleZ[ from ];
+	m_angularRateZ[ to ] = m_angularRateZ[ from ];
+	m_angularDamping[ to ] = m_angularDamping[ from ];
+	m_size[ to ] = m_size[ from ];
+	m_sizeRate[ to ] = m_sizeRate[ from ];
+	m_sizeRateDamping[ to ] = m_sizeRateDamping[ from ];
+	m_windRandomness[ to ] = m_windRandomness[ from ];
+	m_lifetimeLeft[ to ] = m_lifetimeLeft[ from ];
+	m_isDead[ to ] = m_isDead[ from ];
+
+	m_particle[ to ]->m_storeIndex = to;
+}
+
+// ------------------------------------------------------------------------------------------------
+// ------------------------------------------------------------------------------------------------
+void ParticleStore::resize( Int count )
+{
+	m_particle.resize( count );
+	m_posX.resize( count );
+	m_posY.resize( count );
+	m_posZ.resize( count );
+	m_velX.resize( count );
+	m_velY.resize( count );
+	m_velZ.resize( count );
+	m_accelX.resize( count );
+	m_accelY.resize( count );
+	m_accelZ.resize( count );
+	m_velDamping.resize( count );
+	m_angleZ.resize( count );
+	m_angularRateZ.resize( count );
+	m_angularDamping.resize( count );
+	m_size.resize( count );
+	m_sizeRate.resize( count );
+	m_sizeRateDamping.resize( count );
+	m_windRandomness.resize( count );
+	m_lifetimeLeft.resize( count );
+	m_isDead.resize( count );
+}
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 ///////////////////////////////////////////////////////////////////////////////////////////////////
@@ -2110,31 +2326,23 @@ Bool ParticleSystem::update( Int localPlayerIndex  )
 	//
 	// Update all particles in the system
 	//
-	Particle *p = m_systemParticlesHead;
-	Particle *oldParticle;
-	while (p)
-	{
+	ParticleUpdateContext context;
+	computeParticleUpdateContext( &context );
 
-		// apply 'gravity' force
-		if (m_gravity != 0.0f)
-		{
-			Coord3D force;
-			force.x = 0.0f;
-			force.y = 0.0f;
-			force.z = m_gravity;
-			p->applyForce( &force );
-		}
+	// TheSuperHackers @performance The motion of all particles is integrated in one pass over the
+	// particle store. The particles then update their colors one by one, and the dead ones are
+	// removed from the store together.
+	m_particleStore.update( context );
 
-		if (p->update() == false)
-		{
-			oldParticle = p;
-			p = p->m_systemNext;
-			deleteInstance(oldParticle);
-		} else {
-			p = p->m_systemNext;
-		}
+	const Int storeCount = m_particleStore.getCount();
+	for (Int i = 0; i < storeCount; ++i)
+	{
+		if (!m_particleStore.isDead( i ) && m_particleStore.getParticle( i )->update( context ) == false)
+			m_particleStore.setDead( i );
 	}
 
+	m_particleStore.deleteDeadParticles();
+
 	//
 	// If we have been "destroyed", wait for all of our particles to die off,
 	// then destroy ourselves (return false).
@@ -2162,6 +2370,60 @@ Bool ParticleSystem::update( Int localPlayerIndex  )
 	return true;
 }
 
+// ------------------------------------------------------------------------------------------------
+/** Gather the state of this system that every particle reads during its update */
+// ------------------------------------------------------------------------------------------------
+void ParticleSystem::computeParticleUpdateContext( ParticleUpdateContext *context )
+{
+	context->m_driftVelocity = m_driftVelocity;
+	context->m_gravity = m_gravity;
+	context->m_shaderType = m_shaderType;
+	context->m_frame = TheGameClient->getFrame();
+	context->m_doWindMotion = (m_windMotion != ParticleSystemInfo::WIND_MOTION_NOT_USED);
+
+	if( !context->m_doWindMotion )
+		return;
+
+	context->m_windDirX = Cos( m_windAngle );
+	context->m_windDirY = Sin( m_windAngle );
+
+	// get the system position
+	Coord3D &systemPos = context->m_windPos;
+	getPosition( &systemPos );
+
+	// when we're attached objects and drawables we offset by that position as well
+	if( m_attachedToObjectID )
+	{
+		Object *obj = TheGameLogic->findObjectByID( m_attachedToObjectID );
+
+		if( obj )
+		{
+			const Coord3D *objPos = obj->getPosition();
+
+			systemPos.x += objPos->x;
+			systemPos.y += objPos->y;
+			systemPos.z += objPos->z;
+
+		}
+
+	}
+	else if( m_attachedToDrawableID )
+	{
+		Drawable *draw = TheGameClient->findDrawableByID( m_attachedToDrawableID );
+
+		if( draw )
+		{
+			const Coord3D *drawPos = draw->getPosition();
+
+			systemPos.x += drawPos->x;
+			systemPos.y += drawPos->y;
+			systemPos.z += drawPos->z;
+
+		}
+
+	}
+}
+
 // ------------------------------------------------------------------------------------------------
 /** Update the wind motion */
 // ------------------------------------------------------------------------------------------------
@@ -2322,6 +2584,7 @@ void ParticleSystem::addParticle( Particle *particleToAdd )
 	m_systemParticlesTail = particleToAdd;
 	particleToAdd->m_systemNext = nullptr;
 	particleToAdd->m_inSystemList = TRUE;
+	m_particleStore.add( particleToAdd );
 
 	++m_particleCount;
 
@@ -2351,6 +2614,7 @@ void ParticleSystem::removeParticle( Particle *particleToRemove )
 
 	particleToRemove->m_systemNext = particleToRemove->m_systemPrev = nullptr;
 	particleToRemove->m_inSystemList = FALSE;
+	m_particleStore.remove( particleToRemove );
 	--m_particleCount;
 }
 
@@ -0,0 +1,378 @@
+/*
+**	Command & Conquer Generals Zero Hour(tm)
+**	Copyright 2026 TheSuperHackers
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// FILE: TerrainHeightField.cpp ///////////////////////////////////////////////////////////////////
+// Desc:   The terrain heights of the logic, with the slopes of the smoothed terrain normals
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "PreRTS.h"	// This must go first in EVERY cpp file in the GameEngine
+
+#include "GameLogic/TerrainHeightField.h"
+
+#include "Common/MapObject.h"
+#include "WWMath/vector3.h"
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// PUBLIC METHODS /////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+//-------------------------------------------------------------------------------------------------
+TerrainHeightField::TerrainHeightField() :
+	m_samples(nullptr),
+	m_xExtent(0),
+	m_yExtent(0),
+	m_borderSize(0),
+	m_maxHeight(0.0f)
+{
+}
+
+//-------------------------------------------------------------------------------------------------
+TerrainHeightField::~TerrainHeightField()
+{
+	reset();
+}
+
+//-------------------------------------------------------------------------------------------------
+void TerrainHeightField::init( const UnsignedShort *heights, Int xExtent, Int yExtent, Int borderSize )
+{
+	reset();
+
+	if (heights == nullptr || xExtent <= 0 || yExtent <= 0)
+		return;
+
+	m_xExtent = xExtent;
+	m_yExtent = yExtent;
+	m_borderSize = borderSize;
+	m_samples = NEW Sample[xExtent * yExtent];
+
+	setRawHeights(heights);
+}
+
+//-------------------------------------------------------------------------------------------------
+void TerrainHeightField::reset()
+{
+	delete [] m_samples;
+	m_samples = nullptr;
+	m_xExtent = 0;
+	m_yExtent = 0;
+	m_borderSize = 0;
+	m_maxHeight = 0.0f;
+}
+
+//-------------------------------------------------------------------------------------------------
+/** Out of range positions are checked on the index only, like WorldHeightMap::getHeight does. */
+//-------------------------------------------------------------------------------------------------
+Int TerrainHeightField::getRawMapHeight( const ICoord2D *gridPos ) const
+{
+	const Int index = (gridPos->y + m_borderSize) * m_xExtent + gridPos->x + m_borderSize;
+	if (index < 0 || index >= m_xExtent * m_yExtent)
+		return 0;
+
+	return m_samples[index].height;
+}
+
+//-------------------------------------------------------------------------------------------------
+void TerrainHeightField::setRawMapHeight( const ICoord2D *gridPos, Int height )
+{
+	const Int index = (gridPos->y + m_borderSize) * m_xExtent + gridPos->x + m_borderSize;
+	if (index < 0 || index >= m_xExtent * m_yExtent)
+		return;
+
+	if (m_samples[index].height <= height)
+		return;
+
+	m_samples[index].height = (UnsignedShort)height;
+
+	// the slopes of a sample come from its neighbours only
+	const Int x = index % m_xExtent;
+	const Int y = index / m_xExtent;
+	if (x > 0)
+		updateSlopes(index - 1);
+	if (x < m_xExtent - 1)
+		updateSlopes(index + 1);
+	if (y > 0)
+		updateSlopes(index - m_xExtent);
+	if (y < m_yExtent - 1)
+		updateSlopes(index + m_xExtent);
+}
+
+//-------------------------------------------------------------------------------------------------
+void TerrainHeightField::getRawHeights( UnsignedShort *heights ) const
+{
+	const Int count = m_xExtent * m_yExtent;
+	for (Int i = 0; i < count; ++i)
+		heights[i] = m_samples[i].height;
+}
+
+//-------------------------------------------------------------------------------------------------
+void TerrainHeightField::setRawHeights( const UnsignedShort *heights )
+{
+	const Int count = m_xExtent * m_yExtent;
+	UnsignedShort maxHeight = 0;
+	for (Int i = 0; i < count; ++i)
+	{
+		m_samples[i].height = heights[i];
+		maxHeight = max(maxHeight, heights[i]);
+	}
+
+	// heights are only ever lowered afterwards, so this stays the upper bound
+	m_maxHeight = maxHeight * MAP_HEIGHT_SCALE;
+
+	updateAllSlopes();
+}
+
+//-------------------------------------------------------------------------------------------------
+Real TerrainHeightField::getHeight( Real x, Real y, Coord3D *normal ) const
+{
+	return sampleHeight(x, y, normal);
+}
+
+//-------------------------------------------------------------------------------------------------
+void TerrainHeightField::getHeights( const Coord2D *points, Real *heights, Int count ) const
+{
+	for (Int i = 0; i < count; ++i)
+		heights[i] = sampleHeight(points[i].x, points[i].y, nullptr);
+}
+
+//-------------------------------------------------------------------------------------------------
+/** Same Bresenham walk as BaseHeightMapRenderObjClass::isClearLineOfSight. */
+//-------------------------------------------------------------------------------------------------
+Bool TerrainHeightField::isClearLineOfSight( const Coord3D &pos, const Coord3D &posOther ) const
+{
+	const Real MAP_XY_FACTOR_INV = 1.0f / MAP_XY_FACTOR;
+
+	const Int start_x = REAL_TO_INT_FLOOR(pos.x * MAP_XY_FACTOR_INV) + m_borderSize;
+	const Int start_y = REAL_TO_INT_FLOOR(pos.y * MAP_XY_FACTOR_INV) + m_borderSize;
+	const Int end_x = REAL_TO_INT_FLOOR(posOther.x * MAP_XY_FACTOR_INV) + m_borderSize;
+	const Int end_y = REAL_TO_INT_FLOOR(posOther.y * MAP_XY_FACTOR_INV) + m_borderSize;
+	const Int delta_x = abs(end_x - start_x);
+	const Int delta_y = abs(end_y - start_y);
+	Int x = start_x;
+	Int y = start_y;
+
+	Int xinc1, xinc2;
+	if (end_x >= start_x)
+	{
+		xinc1 = 1;
+		xinc2 = 1;
+	}
+	else
+	{
+		xinc1 = -1;
+		xinc2 = -1;
+	}
+
+	Int yinc1, yinc2;
+	if (end_y >= start_y)
+	{
+		yinc1 = 1;
+		yinc2 = 1;
+	}
+	else
+	{
+		yinc1 = -1;
+		yinc2 = -1;
+	}
+
+	Int den, num, numadd, numpixels;
+	if (delta_x >= delta_y)
+	{
+		xinc1 = 0;
+		yinc2 = 0;
+		den = delta_x;
+		num = delta_x / 2;
+		numadd = delta_y;
+		numpixels = delta_x;
+	}
+	else
+	{
+		xinc2 = 0;
+		yinc1 = 0;
+		den = delta_y;
+		num = delta_y / 2;
+		numadd = delta_x;
+		numpixels = delta_y;
+	}
+
+	Real nsInv = 1.0f / numpixels;
+	Real z = pos.z;
+	Real dz = posOther.z - z;
+	Real zinc = dz * nsInv;
+
+	for (Int curpixel = 0; curpixel < numpixels; curpixel++)
+	{
+		// once we go off the map, we're done
+		if (x < 0 || y < 0 || x >= m_xExtent-1 || y >= m_yExtent-1)
+			break;
+
+		const Sample *sample = m_samples + x + y*m_xExtent;
+		Real height = sample[0].height;
+		height = max(height, (Real)sample[1].height);
+		height = max(height, (Real)sample[m_xExtent].height);
+		height = max(height, (Real)sample[m_xExtent + 1].height);
+		height *= MAP_HEIGHT_SCALE;
+
+		// add a little fudge to account for slop.
+		const Real LOS_FUDGE = 0.5f;
+		if (height > z + LOS_FUDGE)
+			return false;
+
+		// we're above all of the terrain and still looking up, so nothing can block anymore.
+		if (z >= m_maxHeight && zinc > 0.0f)
+			break;
+
+		z += zinc;
+
+		num += numadd;
+		if (num >= den)
+		{
+			num -= den;
+			x += xinc1;
+			y += yinc1;
+		}
+		x += xinc2;
+		y += yinc2;
+	}
+
+	return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// PRIVATE METHODS ////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+//-------------------------------------------------------------------------------------------------
+/** The render object takes the slopes of the low bytes of the heights, so we do too. Samples on
+	* the edge of the map keep no slope across the edge, as no query on the map reads it. */
+//-------------------------------------------------------------------------------------------------
+void TerrainHeightField::updateSlopes( Int index )
+{
+	const Int x = index % m_xExtent;
+	const Int y = index / m_xExtent;
+	Sample &sample = m_samples[index];
+
+	if (x > 0 && x < m_xExtent - 1)
+		sample.slopeX = (Short)((UnsignedByte)m_samples[index + 1].height - (UnsignedByte)m_samples[index - 1].height);
+	else
+		sample.slopeX = 0;
+
+	if (y > 0 && y < m_yExtent - 1)
+		sample.slopeY = (Short)((UnsignedByte)m_samples[index + m_xExtent].height - (UnsignedByte)m_samples[index - m_xExtent].height);
+	else
+		sample.slopeY = 0;
+}
+
+//-------------------------------------------------------------------------------------------------
+void TerrainHeightField::updateAllSlopes()
+{
+	const Int count = m_xExtent * m_yExtent;
+	for (Int i = 0; i < count; ++i)
+		updateSlopes(i);
+}
+
+//-------------------------------------------------------------------------------------------------
+/** Must stay the same as BaseHeightMapRenderObjClass::getHeightMapHeight, down to the order of the
+	* operations, or the logic of games with and without a renderer goes out of sync. */
+//-------------------------------------------------------------------------------------------------
+Real TerrainHeightField::sampleHeight( Real x, Real y, Coord3D *normal ) const
+{
+	//	3-----2
+	//  |    /|
+	//  |  /  |
+	//	|/    |
+	//  0-----1
+
+	const Real MAP_XY_FACTOR_INV = 1.0f / MAP_XY_FACTOR;
+
+	float xdiv = x * MAP_XY_FACTOR_INV;
+	float ydiv = y * MAP_XY_FACTOR_INV;
+
+	float ixf = FAST_REAL_FLOOR(xdiv);
+	float iyf = FAST_REAL_FLOOR(ydiv);
+
+	float fx = xdiv - ixf;
+	float fy = ydiv - iyf;
+
+	Int ix = fast_float2long_round(ixf) + m_borderSize;
+	Int iy = fast_float2long_round(iyf) + m_borderSize;
+
+	// Check for extent-3, not extent-1: the smoothed normals go into the next row and column
+	if (ix > (m_xExtent-3) || iy > (m_yExtent-3) || iy < 1 || ix < 1)
+	{
+		if (normal)
+		{
+			normal->x = 0.0f;
+			normal->y = 0.0f;
+			normal->z = 1.0f;
+		}
+		const Int clipX = clamp(0, ix, m_xExtent-1);
+		const Int clipY = clamp(0, iy, m_yExtent-1);
+		return m_samples[clipX + clipY*m_xExtent].height * MAP_HEIGHT_SCALE;
+	}
+
+	const Sample *s0 = m_samples + ix + iy*m_xExtent;
+	const Sample *s1 = s0 + 1;
+	const Sample *s3 = s0 + m_xExtent;
+	const Sample *s2 = s3 + 1;
+
+	float height;
+	float p0 = s0->height;
+	float p2 = s2->height;
+	if (fy > fx) // test if we are in the upper triangle
+	{
+		float p3 = s3->height;
+		height = (p3 + (1.0f-fy)*(p0-p3) + fx*(p2-p3)) * MAP_HEIGHT_SCALE;
+	}
+	else
+	{
+		float p1 = s1->height;
+		height = (p1 + fy*(p2-p1) + (1.0f-fx)*(p0-p1)) * MAP_HEIGHT_SCALE;
+	}
+
+	if (normal)
+	{
+		// The render object takes the x slope of sample 1 for sample 3 as well
+		Real deltaZ_X0 = s0->slopeX;
+		Real deltaZ_X1 = s1->slopeX;
+		Real deltaZ_X2 = s2->slopeX;
+		Real deltaZ_X3 = s1->slopeX;
+
+		Real deltaZ_Y0 = s0->slopeY;
+		Real deltaZ_Y1 = s1->slopeY;
+		Real deltaZ_Y2 = s2->slopeY;
+		Real deltaZ_Y3 = s3->slopeY;
+
+		Real deltaZ_X_Left = deltaZ_X0*(1.0f-fx) + fx*deltaZ_X3;
+		Real deltaZ_X_Right = deltaZ_X1*(1.0f-fx) + fx*deltaZ_X2;
+		Real deltaZ_X = deltaZ_X_Left*(1.0-fy) + fy*deltaZ_X_Right;
+
+		Real deltaZ_Y_Left = deltaZ_Y0*(1.0f-fx) + fx*deltaZ_Y3;
+		Real deltaZ_Y_Right = deltaZ_Y1*(1.0f-fx) + fx*deltaZ_Y2;
+		Real deltaZ_Y = deltaZ_Y_Left*(1.0-fy) + fy*deltaZ_Y_Right;
+
+		Vector3 l2r, n2f, normalAtTexel;
+		l2r.Set(2*MAP_XY_FACTOR/MAP_HEIGHT_SCALE, 0, deltaZ_X);
+		n2f.Set(0, 2*MAP_XY_FACTOR/MAP_HEIGHT_SCALE, deltaZ_Y);
+		Vector3::Normalized_Cross_Product(l2r, n2f, &normalAtTexel);
+		normal->x = normalAtTexel.X;
+		normal->y = normalAtTexel.Y;
+		normal->z = normalAtTexel.Z;
+	}
+
+	return height;
+}
@@ -44,6 +44,9 @@ Connection::Connection() {
 	m_isQuitting = false;
 	m_quitTime = 0;
 	m_averageLatency = 0.0f;
+#if defined(RTS_DEBUG)
+	m_totalRetries = 0;
+#endif
 	Int i;
 	for(i = 0; i < CONNECTION_LATENCY_HISTORY_LENGTH; i++)
 	{
@@ -81,6 +84,9 @@ void Connection::init() {
 	m_frameGrouping = 1;
 	m_numRetries = 0;
 	m_retryMetricsTime = 0;
+#if defined(RTS_DEBUG)
+	m_totalRetries = 0;
+#endif
 
 	for (Int i = 0; i < CONNECTION_LATENCY_HISTORY_LENGTH; ++i) {
 		m_latencies[i] = 0;
@@ -289,6 +295,9 @@ UnsignedInt Connection::doSend() {
 					if (CommandRequiresAck(msg->getCommand())) {
 						if (timeLastSent != -1) {
 							++m_numRetries;
+#if defined(RTS_DEBUG)
+							++m_totalRetries;
+#endif
 						}
 						doRetryMetrics();
 						msg->setTimeLastSent(curtime);
@@ -2358,6 +2358,16 @@ void ConnectionManager::debugPrintConnectionCommands() {
 	}
 	DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("ConnectionManager::debugPrintConnectionCommands - end commands"));
 }
+
+Int ConnectionManager::getTotalRetries() {
+	Int retries = 0;
+	for (Int i = 0; i < MAX_SLOTS; ++i) {
+		if (m_connections[i] != nullptr) {
+			retries += m_connections[i]->getTotalRetries();
+		}
+	}
+	return retries;
+}
 #endif
 
 void ConnectionManager::notifyOthersOfCurrentFrame(Int frame) {
@@ -218,6 +218,18 @@ protected:
 
 #if defined(RTS_DEBUG)
 	Bool m_networkOn;
+
+	// TheSuperHackers @feature Lockstep statistics, logged when the game ends
+	void resetStatistics();
+	void logStatistics();
+	Int m_numFramesExecuted;
+	Int m_numStalls;
+	__int64 m_stallTime;																	///< performance counter ticks spent stalling
+	__int64 m_lastUpdateTime;
+	Bool m_wasStalling;
+	Int m_minRunAhead;
+	Int m_maxRunAhead;
+	Int m_totalRunAhead;
 #endif
 };
 
@@ -275,6 +287,7 @@ Network::Network()
 
 #if defined(RTS_DEBUG)
 	m_networkOn = TRUE;
+	resetStatistics();
 #endif
 }
 
@@ -293,6 +306,9 @@ Bool Network::deinit( void )
 {
 	if (m_conMgr)
 	{
+#if defined(RTS_DEBUG)
+		logStatistics();
+#endif
 		m_conMgr->destroyGameMessages();
 		delete m_conMgr;
 		m_conMgr = nullptr;
@@ -359,6 +375,7 @@ void Network::init()
 
 #if defined(RTS_DEBUG)
 	m_networkOn = TRUE;
+	resetStatistics();
 #endif
 
 	return;
@@ -728,6 +745,28 @@ void Network::update( void )
 		QueryPerformanceCounter((LARGE_INTEGER *)&curTime);
 		m_isStalling = curTime >= m_nextFrameTime;
 	}
+
+#if defined(RTS_DEBUG)
+	if (m_localStatus == NETLOCALSTATUS_INGAME) {
+		__int64 curTime;
+		QueryPerformanceCounter((LARGE_INTEGER *)&curTime);
+		if (m_isStalling) {
+			if (m_wasStalling) {
+				m_stallTime += curTime - m_lastUpdateTime;
+			} else {
+				++m_numStalls;
+			}
+		}
+		if (m_frameDataReady) {
+			++m_numFramesExecuted;
+			m_minRunAhead = min(m_minRunAhead, m_runAhead);
+			m_maxRunAhead = max(m_maxRunAhead, m_runAhead);
+			m_totalRunAhead += m_runAhead;
+		}
+		m_wasStalling = m_isStalling;
+		m_lastUpdateTime = curTime;
+	}
+#endif
 }
 
 void Network::liteupdate() {
@@ -820,6 +859,36 @@ Bool Network::isStalling()
 	return m_isStalling;
 }
 
+#if defined(RTS_DEBUG)
+void Network::resetStatistics()
+{
+	m_numFramesExecuted = 0;
+	m_numStalls = 0;
+	m_stallTime = 0;
+	m_lastUpdateTime = 0;
+	m_wasStalling = FALSE;
+	m_minRunAhead = MAX_FRAMES_AHEAD;
+	m_maxRunAhead = 0;
+	m_totalRunAhead = 0;
+}
+
+/**
+ * Logs how well the lockstep kept up with the connection, for comparing network settings and the
+ * simulated latency and packet loss of the Transport.
+ */
+void Network::logStatistics()
+{
+	if (m_numFramesExecuted == 0)
+		return;
+
+	const Int stallMilliseconds = m_perfCountFreq > 0 ? (Int)((m_stallTime * 1000) / m_perfCountFreq) : 0;
+	DEBUG_LOG(("Network::logStatistics - %d frames executed, %d stalls, %dms stalled, %d commands resent",
+		m_numFramesExecuted, m_numStalls, stallMilliseconds, m_conMgr->getTotalRetries()));
+	DEBUG_LOG(("Network::logStatistics - run ahead min %d, max %d, average %d",
+		m_minRunAhead, m_maxRunAhead, m_totalRunAhead / m_numFramesExecuted));
+}
+#endif
+
 /**
  * returns the number of incoming bytes per second averaged over the last 30 sec.
  */
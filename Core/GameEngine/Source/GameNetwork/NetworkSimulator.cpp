@@ -0,0 +1,177 @@
+/*
+**	Command & Conquer Generals Zero Hour(tm)
+**	Copyright 2026 TheSuperHackers
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// FILE: NetworkSimulator.cpp /////////////////////////////////////////////////////////////////////
+// Desc:   Delays, reorders and drops the incoming packets of the Transport
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "PreRTS.h"	// This must go first in EVERY cpp file in the GameEngine
+
+#include "GameNetwork/NetworkSimulator.h"
+
+//-------------------------------------------------------------------------------------------------
+NetworkSimulator::NetworkSimulator()
+{
+	memset(&m_settings, 0, sizeof(m_settings));
+	reset();
+}
+
+//-------------------------------------------------------------------------------------------------
+void NetworkSimulator::init( const Settings& settings )
+{
+	m_settings = settings;
+	reset();
+}
+
+//-------------------------------------------------------------------------------------------------
+void NetworkSimulator::reset()
+{
+	// xorshift needs a state that is not zero
+	m_randomState = m_settings.seed != 0 ? m_settings.seed : 0x9E3779B9;
+	m_nextSequence = 0;
+	m_deliveredSequenceEnd = 0;
+	m_packetCount = 0;
+
+	m_numReceived = 0;
+	m_numDropped = 0;
+	m_numReordered = 0;
+	m_numSpikes = 0;
+	m_numOverflows = 0;
+	m_totalDelay = 0;
+	m_maxDelay = 0;
+}
+
+//-------------------------------------------------------------------------------------------------
+Bool NetworkSimulator::dropPacket()
+{
+	++m_numReceived;
+
+	if (m_settings.packetLoss > 0 && randomRange(0, 99) < m_settings.packetLoss)
+	{
+		++m_numDropped;
+		return TRUE;
+	}
+	return FALSE;
+}
+
+//-------------------------------------------------------------------------------------------------
+void NetworkSimulator::addPacket( const TransportMessage& message, UnsignedInt now )
+{
+	if (m_packetCount == MAX_MESSAGES)
+	{
+		// the Transport would have no room for it either
+		++m_numOverflows;
+		return;
+	}
+
+	const Int latency = getLatency(now);
+	m_totalDelay += latency;
+	m_maxDelay = max(m_maxDelay, latency);
+
+	DelayedPacket &packet = m_packets[m_packetCount++];
+	packet.deliveryTime = now + latency;
+	packet.sequence = m_nextSequence++;
+	packet.waitForNext = m_settings.packetReorder > 0 && randomRange(0, 99) < m_settings.packetReorder;
+	packet.message = message;
+
+	if (packet.waitForNext)
+		++m_numReordered;
+}
+
+//-------------------------------------------------------------------------------------------------
+/** Finds the packet with the earliest delivery time that has arrived by now. Packets with equal
+	* delivery times arrive in the order they were added. */
+//-------------------------------------------------------------------------------------------------
+Bool NetworkSimulator::getDeliveredPacket( TransportMessage& message, UnsignedInt now )
+{
+	Int best = -1;
+
+	for (Int i = 0; i < m_packetCount; ++i)
+	{
+		const DelayedPacket &packet = m_packets[i];
+		if ((Int)(now - packet.deliveryTime) < 0)
+			continue;
+
+		if (packet.waitForNext && packet.sequence >= m_deliveredSequenceEnd && (Int)(now - packet.deliveryTime) < MAX_REORDER_HOLD)
+			continue;
+
+		if (best < 0 || (Int)(packet.deliveryTime - m_packets[best].deliveryTime) < 0
+			|| (packet.deliveryTime == m_packets[best].deliveryTime && packet.sequence < m_packets[best].sequence))
+		{
+			best = i;
+		}
+	}
+
+	if (best < 0)
+		return FALSE;
+
+	message = m_packets[best].message;
+	m_deliveredSequenceEnd = max(m_deliveredSequenceEnd, m_packets[best].sequence + 1);
+
+	// the order of the waiting packets does not matter
+	m_packets[best] = m_packets[--m_packetCount];
+	return TRUE;
+}
+
+//-------------------------------------------------------------------------------------------------
+void NetworkSimulator::logStatistics() const
+{
+	DEBUG_LOG(("NetworkSimulator - %d packets received, %d dropped, %d reordered, %d spikes, %d overflows, average delay %dms, max delay %dms",
+		m_numReceived, m_numDropped, m_numReordered, m_numSpikes, m_numOverflows,
+		(m_numReceived - m_numDropped - m_numOverflows) > 0 ? m_totalDelay / (m_numReceived - m_numDropped - m_numOverflows) : 0, m_maxDelay));
+}
+
+//-------------------------------------------------------------------------------------------------
+UnsignedInt NetworkSimulator::randomValue()
+{
+	m_randomState ^= m_randomState << 13;
+	m_randomState ^= m_randomState >> 17;
+	m_randomState ^= m_randomState << 5;
+	return m_randomState;
+}
+
+//-------------------------------------------------------------------------------------------------
+Int NetworkSimulator::randomRange( Int lo, Int hi )
+{
+	if (hi <= lo)
+		return lo;
+
+	return lo + (Int)(randomValue() % (UnsignedInt)(hi - lo + 1));
+}
+
+//-------------------------------------------------------------------------------------------------
+Int NetworkSimulator::getLatency( UnsignedInt now )
+{
+	Int latency = m_settings.latencyAverage;
+
+	if (m_settings.latencyAmplitude != 0)
+		latency += (Int)(m_settings.latencyAmplitude * sin(now * (double)m_settings.latencyPeriod));
+
+	if (m_settings.latencyNoise > 0)
+		latency += randomRange(-m_settings.latencyNoise, m_settings.latencyNoise);
+
+	if (m_settings.latencySpikeChance > 0 && randomRange(0, 99) < m_settings.latencySpikeChance)
+	{
+		// exponential, so that most spikes are short and some are very long
+		const double uniform = ((double)randomValue() + 1.0) / 4294967296.0;
+		latency += (Int)(-m_settings.latencySpike * log(uniform));
+		++m_numSpikes;
+	}
+
+	return max(latency, 0);
+}
@@ -29,6 +29,7 @@
 #include "GameNetwork/Transport.h"
 #include "GameNetwork/NetworkInterface.h"
 
+static_assert(UDP::MAX_BATCH <= MAX_MESSAGES, "The receive batch must fit into Transport::m_batch");
 
 //--------------------------------------------------------------------------
 // Packet-level encryption is an XOR operation, for speed reasons.  To get
@@ -130,9 +131,6 @@ Bool Transport::init( UnsignedInt ip, UnsignedShort port )
 	{
 		m_outBuffer[i].length = 0;
 		m_inBuffer[i].length = 0;
-#if defined(RTS_DEBUG)
-		m_delayedInBuffer[i].message.length = 0;
-#endif
 	}
 	for (i=0; i<MAX_TRANSPORT_STATISTICS_SECONDS; ++i)
 	{
@@ -149,7 +147,20 @@ Bool Transport::init( UnsignedInt ip, UnsignedShort port )
 	m_port = port;
 
 #if defined(RTS_DEBUG)
-	if (TheGlobalData->m_latencyAverage > 0 || TheGlobalData->m_latencyNoise)
+	NetworkSimulator::Settings settings;
+	settings.latencyAverage = TheGlobalData->m_latencyAverage;
+	settings.latencyAmplitude = TheGlobalData->m_latencyAmplitude;
+	settings.latencyPeriod = TheGlobalData->m_latencyPeriod;
+	settings.latencyNoise = TheGlobalData->m_latencyNoise;
+	settings.latencySpikeChance = TheGlobalData->m_latencySpikeChance;
+	settings.latencySpike = TheGlobalData->m_latencySpike;
+	settings.packetReorder = TheGlobalData->m_packetReorder;
+	settings.packetLoss = TheGlobalData->m_packetLoss;
+	settings.seed = TheGlobalData->m_networkSimulatorSeed;
+	m_simulator.init(settings);
+
+	if (TheGlobalData->m_latencyAverage > 0 || TheGlobalData->m_latencyNoise
+		|| TheGlobalData->m_latencySpikeChance > 0 || TheGlobalData->m_packetReorder > 0)
 		m_useLatency = true;
 
 	if (TheGlobalData->m_packetLoss)
@@ -161,6 +172,12 @@ Bool Transport::init( UnsignedInt ip, UnsignedShort port )
 
 void Transport::reset( void )
 {
+#if defined(RTS_DEBUG)
+	if (m_useLatency || m_usePacketLoss)
+		m_simulator.logStatistics();
+	m_simulator.reset();
+#endif
+
 	delete m_udpsock;
 	m_udpsock = nullptr;
 
@@ -210,39 +227,57 @@ Bool Transport::doSend() {
 		m_unknownBytes[m_statisticsSlot] = 0;
 	}
 
-	// Send all messages
+	// TheSuperHackers @performance Send all messages with as few system calls as the socket allows
+	// TheSuperHackers @info The handling of data sizing of the payload within a UDP packet is confusing due to the current networking implementation
+	// The max game packet size needs to be smaller than max udp payload by sizeof(TransportMessageHeader)
+	// But the max network message size needs to include the bytes of the transport message header and equal the max udp payload
+	// Therefore, transmitted data needs to add the extra bytes of the network header to the payloads length
+	Int count = 0;
 	int i;
 	for (i=0; i<MAX_MESSAGES; ++i)
 	{
 		if (m_outBuffer[i].length != 0)
 		{
-			int bytesSent = 0;
-			// TheSuperHackers @info The handling of data sizing of the payload within a UDP packet is confusing due to the current networking implementation
-			// The max game packet size needs to be smaller than max udp payload by sizeof(TransportMessageHeader)
-			// But the max network message size needs to include the bytes of the transport message header and equal the max udp payload
-			// Therefore, transmitted data needs to add the extra bytes of the network header to the payloads length
-			int bytesToSend = m_outBuffer[i].length + sizeof(TransportMessageHeader);
-			// Send this message
-			if ((bytesSent = m_udpsock->Write((unsigned char *)(&m_outBuffer[i]), bytesToSend, m_outBuffer[i].addr, m_outBuffer[i].port)) > 0)
-			{
-				//DEBUG_LOG(("Sending %d bytes to %d.%d.%d.%d:%d", bytesToSend, PRINTF_IP_AS_4_INTS(m_outBuffer[i].addr), m_outBuffer[i].port));
-				m_outgoingPackets[m_statisticsSlot]++;
-				m_outgoingBytes[m_statisticsSlot] += m_outBuffer[i].length + sizeof(TransportMessageHeader);
-				m_outBuffer[i].length = 0;  // Remove from queue
-				if (bytesSent != bytesToSend)
-				{
-					DEBUG_LOG(("Transport::doSend - wanted to send %d bytes, only sent %d bytes to %d.%d.%d.%d:%d",
-						bytesToSend, bytesSent,
-						PRINTF_IP_AS_4_INTS(m_outBuffer[i].addr), m_outBuffer[i].port));
-				}
-			}
-			else
+			m_batch[count].buf = (unsigned char *)(&m_outBuffer[i]);
+			m_batch[count].len = m_outBuffer[i].length + sizeof(TransportMessageHeader);
+			m_batch[count].IP = m_outBuffer[i].addr;
+			m_batch[count].port = m_outBuffer[i].port;
+			m_batchSlot[count] = i;
+			++count;
+		}
+	}
+
+	Int first = 0;
+	while (first < count)
+	{
+		const Int sent = m_udpsock->WriteBatch(&m_batch[first], count - first);
+
+		for (Int j = first; j < first + sent; ++j)
+		{
+			TransportMessage &msg = m_outBuffer[m_batchSlot[j]];
+			const Int bytesToSend = msg.length + sizeof(TransportMessageHeader);
+			const Int bytesSent = m_batch[j].len;
+
+			//DEBUG_LOG(("Sending %d bytes to %d.%d.%d.%d:%d", bytesToSend, PRINTF_IP_AS_4_INTS(msg.addr), msg.port));
+			m_outgoingPackets[m_statisticsSlot]++;
+			m_outgoingBytes[m_statisticsSlot] += bytesToSend;
+			msg.length = 0;  // Remove from queue
+			if (bytesSent != bytesToSend)
 			{
-				//DEBUG_LOG(("Could not write to socket!!!  Not discarding message!"));
-				retval = FALSE;
-				//DEBUG_LOG(("Transport::doSend returning FALSE"));
+				DEBUG_LOG(("Transport::doSend - wanted to send %d bytes, only sent %d bytes to %d.%d.%d.%d:%d",
+					bytesToSend, bytesSent,
+					PRINTF_IP_AS_4_INTS(msg.addr), msg.port));
 			}
 		}
+		first += sent;
+
+		if (first < count)
+		{
+			//DEBUG_LOG(("Could not write to socket!!!  Not discarding message!"));
+			retval = FALSE;
+			//DEBUG_LOG(("Transport::doSend returning FALSE"));
+			++first;
+		}
 	}
 
 #if defined(RTS_DEBUG)
@@ -251,19 +286,9 @@ Bool Transport::doSend() {
 	{
 		for (i=0; i<MAX_MESSAGES; ++i)
 		{
-			if (m_delayedInBuffer[i].message.length != 0 && m_delayedInBuffer[i].deliveryTime <= now)
-			{
-				for (int j=0; j<MAX_MESSAGES; ++j)
-				{
-					if (m_inBuffer[j].length == 0)
-					{
-						// Empty slot; use it
-						memcpy(&m_inBuffer[j], &m_delayedInBuffer[i].message, sizeof(TransportMessage));
-						m_delayedInBuffer[i].message.length = 0;
-						break;
-					}
-				}
-			}
+			// Empty slot; use it
+			if (m_inBuffer[i].length == 0 && !m_simulator.getDeliveredPacket(m_inBuffer[i], now))
+				break;
 		}
 	}
 #endif
@@ -281,7 +306,6 @@ Bool Transport::doRecv()
 	Bool retval = TRUE;
 
 	// Read in anything on our socket
-	sockaddr_in from;
 #if defined(RTS_DEBUG)
 	UnsignedInt now = timeGetTime();
 #endif
@@ -289,87 +313,84 @@ Bool Transport::doRecv()
 	// The max game packet size needs to be smaller than max udp payload by sizeof(TransportMessageHeader)
 	// But the max network message size needs to include the bytes of the transport message header and equal the max udp payload
 	// Therefore, when receiving data we use the max udp payload size to receive the game packet payload and network header
-	TransportMessage incomingMessage;
-	unsigned char *buf = (unsigned char *)&incomingMessage;
-	int len = MAX_NETWORK_MESSAGE_LEN;
-//	DEBUG_LOG(("Transport::doRecv - checking"));
-	while ( (len=m_udpsock->Read(buf, MAX_NETWORK_MESSAGE_LEN, &from)) > 0 )
+	// TheSuperHackers @performance The datagrams are read in batches, with one system call per batch where the socket allows
+	Int count;
+	do
 	{
-#if defined(RTS_DEBUG)
-		// Packet loss simulation
-		if (m_usePacketLoss)
+		for (Int j = 0; j < UDP::MAX_BATCH; ++j)
 		{
-			if ( TheGlobalData->m_packetLoss >= GameClientRandomValue(0, 100) )
+			m_batch[j].buf = (unsigned char *)&m_recvMessages[j];
+			m_batch[j].len = MAX_NETWORK_MESSAGE_LEN;
+		}
+
+//		DEBUG_LOG(("Transport::doRecv - checking"));
+		count = m_udpsock->ReadBatch(m_batch, UDP::MAX_BATCH);
+
+		for (Int j = 0; j < count; ++j)
+		{
+			TransportMessage &incomingMessage = m_recvMessages[j];
+			unsigned char *buf = m_batch[j].buf;
+			const int len = m_batch[j].len;
+
+#if defined(RTS_DEBUG)
+			// Packet loss simulation
+			if (m_usePacketLoss)
 			{
-				continue;
+				if (m_simulator.dropPacket())
+				{
+					continue;
+				}
 			}
-		}
 #endif
 
-//		DEBUG_LOG(("Transport::doRecv - Got something! len = %d", len));
-		// Decrypt the packet
-//		DEBUG_LOG_RAW(("buffer = "));
-//		for (Int munkee = 0; munkee < len; ++munkee) {
-//			DEBUG_LOG_RAW(("%02x", *(buf + munkee)));
-//		}
-//		DEBUG_LOG_RAW(("\n"));
-		decryptBuf(buf, len);
+//			DEBUG_LOG(("Transport::doRecv - Got something! len = %d", len));
+			// Decrypt the packet
+			decryptBuf(buf, len);
 
-		incomingMessage.length = len - sizeof(TransportMessageHeader);
+			incomingMessage.length = len - sizeof(TransportMessageHeader);
 
-		if (len <= sizeof(TransportMessageHeader) || !isGeneralsPacket( &incomingMessage ))
-		{
-			DEBUG_LOG(("Transport::doRecv - unknownPacket! len = %d", len));
-			m_unknownPackets[m_statisticsSlot]++;
-			m_unknownBytes[m_statisticsSlot] += len;
-			continue;
-		}
+			if (len <= sizeof(TransportMessageHeader) || !isGeneralsPacket( &incomingMessage ))
+			{
+				DEBUG_LOG(("Transport::doRecv - unknownPacket! len = %d", len));
+				m_unknownPackets[m_statisticsSlot]++;
+				m_unknownBytes[m_statisticsSlot] += len;
+				continue;
+			}
 
-		// Something there; stick it somewhere
-//		DEBUG_LOG(("Saw %d bytes from %d:%d", len, ntohl(from.sin_addr.S_un.S_addr), ntohs(from.sin_port)));
-		m_incomingPackets[m_statisticsSlot]++;
-		m_incomingBytes[m_statisticsSlot] += len;
+			// Something there; stick it somewhere
+//			DEBUG_LOG(("Saw %d bytes from %d:%d", len, m_batch[j].IP, m_batch[j].port));
+			m_incomingPackets[m_statisticsSlot]++;
+			m_incomingBytes[m_statisticsSlot] += len;
 
-		for (int i=0; i<MAX_MESSAGES; ++i)
-		{
 #if defined(RTS_DEBUG)
 			// Latency simulation
 			if (m_useLatency)
 			{
-				if (m_delayedInBuffer[i].message.length == 0)
-				{
-					// Empty slot; use it
-					m_delayedInBuffer[i].deliveryTime =
-						now + TheGlobalData->m_latencyAverage +
-						(Int)(TheGlobalData->m_latencyAmplitude * sin(now * TheGlobalData->m_latencyPeriod)) +
-						GameClientRandomValue(-TheGlobalData->m_latencyNoise, TheGlobalData->m_latencyNoise);
-					m_delayedInBuffer[i].message.length = incomingMessage.length;
-					m_delayedInBuffer[i].message.addr = ntohl(from.sin_addr.S_un.S_addr);
-					m_delayedInBuffer[i].message.port = ntohs(from.sin_port);
-					memcpy(&m_delayedInBuffer[i].message, buf, len);
-					break;
-				}
+				incomingMessage.addr = m_batch[j].IP;
+				incomingMessage.port = m_batch[j].port;
+				m_simulator.addPacket(incomingMessage, now);
+				continue;
 			}
-			else
-			{
 #endif
+
+			for (int i=0; i<MAX_MESSAGES; ++i)
+			{
 				if (m_inBuffer[i].length == 0)
 				{
 					// Empty slot; use it
 					m_inBuffer[i].length = incomingMessage.length;
-					m_inBuffer[i].addr = ntohl(from.sin_addr.S_un.S_addr);
-					m_inBuffer[i].port = ntohs(from.sin_port);
+					m_inBuffer[i].addr = m_batch[j].IP;
+					m_inBuffer[i].port = m_batch[j].port;
 					memcpy(&m_inBuffer[i], buf, len);
 					break;
 				}
-#if defined(RTS_DEBUG)
 			}
-#endif
+			//DEBUG_ASSERTCRASH(i<MAX_MESSAGES, ("Message lost!"));
 		}
-		//DEBUG_ASSERTCRASH(i<MAX_MESSAGES, ("Message lost!"));
 	}
+	while (count == UDP::MAX_BATCH && m_udpsock->GetStatus() == UDP::OK);
 
-	if (len == -1) {
+	if (m_udpsock->GetStatus() != UDP::OK) {
 		// there was a socket error trying to perform a read.
 		//DEBUG_LOG(("Transport::doRecv returning FALSE"));
 		retval = FALSE;
@@ -35,6 +35,12 @@
 //#include "GameNetwork/NetworkInterface.h"
 #include "GameNetwork/udp.h"
 
+#if defined(__linux__)
+#include <errno.h>
+#include <sys/uio.h>
+#define UDP_USE_MMSG // recvmmsg and sendmmsg move a whole batch with one system call
+#endif
+
 
 //-------------------------------------------------------------------------
 
@@ -310,6 +316,139 @@ Int UDP::Read(unsigned char *msg,UnsignedInt len,sockaddr_in *from)
 }
 
 
+//-------------------------------------------------------------------------
+// Reads up to count datagrams, fewer when no more are waiting. Returns the
+// number read. Stops at the first error, which GetStatus() then reports.
+//-------------------------------------------------------------------------
+Int UDP::ReadBatch(Datagram *msgs,Int count)
+{
+  ClearStatus();
+
+#ifdef UDP_USE_MMSG
+  struct mmsghdr hdrs[MAX_BATCH];
+  struct iovec iovs[MAX_BATCH];
+  struct sockaddr_in from[MAX_BATCH];
+
+  if (count > MAX_BATCH)
+    count = MAX_BATCH;
+
+  memset(hdrs, 0, count * sizeof(hdrs[0]));
+  for (Int i = 0; i < count; ++i)
+  {
+    iovs[i].iov_base = msgs[i].buf;
+    iovs[i].iov_len = msgs[i].len;
+    hdrs[i].msg_hdr.msg_name = &from[i];
+    hdrs[i].msg_hdr.msg_namelen = sizeof(from[i]);
+    hdrs[i].msg_hdr.msg_iov = &iovs[i];
+    hdrs[i].msg_hdr.msg_iovlen = 1;
+  }
+
+  Int retval = recvmmsg(fd, hdrs, count, MSG_DONTWAIT, nullptr);
+  if (retval < 0)
+  {
+    // nothing waiting is not an error
+    if (errno != EAGAIN && errno != EWOULDBLOCK)
+      m_lastError = errno;
+    return 0;
+  }
+
+  for (Int i = 0; i < retval; ++i)
+  {
+    msgs[i].len = hdrs[i].msg_len;
+    msgs[i].IP = ntohl(from[i].sin_addr.s_addr);
+    msgs[i].port = ntohs(from[i].sin_port);
+  }
+  return retval;
+#else
+  sockaddr_in from;
+  Int i = 0;
+  for (; i < count; ++i)
+  {
+    Int len = Read(msgs[i].buf, msgs[i].len, &from);
+    if (len <= 0)
+      break;
+
+    msgs[i].len = len;
+    msgs[i].IP = ntohl(from.sin_addr.s_addr);
+    msgs[i].port = ntohs(from.sin_port);
+  }
+  return i;
+#endif
+}
+
+//-------------------------------------------------------------------------
+// Sends the datagrams in order. Returns the number sent before the first
+// one that failed, which GetStatus() then reports.
+//-------------------------------------------------------------------------
+Int UDP::WriteBatch(Datagram *msgs,Int count)
+{
+#ifdef UDP_USE_MMSG
+  ClearStatus();
+
+  struct mmsghdr hdrs[MAX_BATCH];
+  struct iovec iovs[MAX_BATCH];
+  struct sockaddr_in to[MAX_BATCH];
+
+  Int sent = 0;
+  while (sent < count)
+  {
+    Datagram *batchMsgs = msgs + sent;
+    const Int maxBatch = min(count - sent, (Int)MAX_BATCH);
+
+    // an unknown address ends the batch, like a failed Write()
+    Int batch = 0;
+    for (; batch < maxBatch; ++batch)
+    {
+      if (batchMsgs[batch].IP == 0 || batchMsgs[batch].port == 0)
+        break;
+
+      memset(&to[batch], 0, sizeof(to[batch]));
+      to[batch].sin_family = AF_INET;
+      to[batch].sin_addr.s_addr = htonl(batchMsgs[batch].IP);
+      to[batch].sin_port = htons(batchMsgs[batch].port);
+
+      iovs[batch].iov_base = batchMsgs[batch].buf;
+      iovs[batch].iov_len = batchMsgs[batch].len;
+
+      memset(&hdrs[batch], 0, sizeof(hdrs[batch]));
+      hdrs[batch].msg_hdr.msg_name = &to[batch];
+      hdrs[batch].msg_hdr.msg_namelen = sizeof(to[batch]);
+      hdrs[batch].msg_hdr.msg_iov = &iovs[batch];
+      hdrs[batch].msg_hdr.msg_iovlen = 1;
+    }
+
+    if (batch == 0)
+      return sent;
+
+    Int retval = sendmmsg(fd, hdrs, batch, 0);
+    if (retval <= 0)
+    {
+      m_lastError = (retval < 0) ? errno : EAGAIN;
+      return sent;
+    }
+
+    for (Int i = 0; i < retval; ++i)
+      batchMsgs[i].len = hdrs[i].msg_len;
+
+    sent += retval;
+    if (retval < maxBatch)
+      return sent; // the next call reports why the rest was not sent
+  }
+  return sent;
+#else
+  Int i = 0;
+  for (; i < count; ++i)
+  {
+    Int len = Write(msgs[i].buf, msgs[i].len, msgs[i].IP, msgs[i].port);
+    if (len <= 0)
+      break;
+
+    msgs[i].len = len;
+  }
+  return i;
+#endif
+}
+
 void UDP::ClearStatus(void)
 {
   #ifndef _WIN32
@@ -74,7 +74,19 @@ File* StdBIGFile::openFile( const Char *filename, Int access )
 		ramFile = newInstance( RAMFile );
 
 	ramFile->deleteOnClose();
-	if (ramFile->openFromArchive(m_file, fileInfo->m_filename, fileInfo->m_offset, fileInfo->m_size) == FALSE) {
+
+	Bool opened = FALSE;
+#if USE_MAPPED_ARCHIVE_FILES
+	if (!BitIsSet(access, File::STREAMING | File::WRITE) && fileInfo->m_size >= MIN_MAPPED_FILE_SIZE) {
+		opened = ramFile->openFromMapping(m_mapping, fileInfo->m_filename, fileInfo->m_offset, fileInfo->m_size);
+	}
+#endif
+
+	if (!opened) {
+		opened = ramFile->openFromArchive(m_file, fileInfo->m_filename, fileInfo->m_offset, fileInfo->m_size);
+	}
+
+	if (opened == FALSE) {
 		ramFile->close();
 		ramFile = nullptr;
 		return nullptr;
@@ -209,6 +209,11 @@ void StdBIGFileSystem::closeAllFiles() {
 
 Bool StdBIGFileSystem::loadBigFilesFromDirectory(AsciiString dir, AsciiString fileMask, Bool overwrite) {
 
+#ifdef DEBUG_LOGGING
+	const UnsignedInt startTime = timeGetTime();
+	Int archiveCount = 0;
+#endif
+
 	FilenameList filenameList;
 	TheLocalFileSystem->getFileListInDirectory(dir, "", fileMask, filenameList, TRUE);
 
@@ -233,10 +238,15 @@ Bool StdBIGFileSystem::loadBigFilesFromDirectory(AsciiString dir, AsciiString fi
 			m_archiveFileMap[(*it)] = archiveFile;
 			DEBUG_LOG(("StdBIGFileSystem::loadBigFilesFromDirectory - %s inserted into the archive file map.", (*it).str()));
 			actuallyAdded = TRUE;
+#ifdef DEBUG_LOGGING
+			++archiveCount;
+#endif
 		}
 
 		it++;
 	}
 
+	DEBUG_LOG(("StdBIGFileSystem::loadBigFilesFromDirectory - loaded %d archives from %s in %u ms.", archiveCount, dir.str(), timeGetTime() - startTime));
+
 	return actuallyAdded;
 }
@@ -2183,16 +2183,44 @@ Int W3DView::iterateDrawablesInRegion( IRegion2D *screenRegion,
 	}
 	else
 	{
-		std::list< Drawable* > drawables = ThePartitionManager->getDrawablesInRegion( screenRegion );
-
-		for( std::list< Drawable* >::iterator it = drawables.begin(); it != drawables.end(); ++it )
+		// TheSuperHackers @performance Only look at the drawables near the terrain under the screen region.
+		// The area is grown the same way as the partition manager search that this replaces, so that
+		// drawables above the terrain are still found.
+		ICoord2D loScreen, hiScreen;
+		Coord3D loWorld, hiWorld;
+		loScreen.x = screenRegion->lo.x;
+		loScreen.y = screenRegion->lo.y;
+		hiScreen.x = screenRegion->hi.x;
+		hiScreen.y = screenRegion->hi.y;
+		screenToTerrain( &loScreen, &loWorld );
+		screenToTerrain( &hiScreen, &hiWorld );
+
+		const Real centerX = loWorld.x + (hiWorld.x - loWorld.x) / 2;
+		const Real centerY = loWorld.y + (hiWorld.y - loWorld.y) / 2;
+		const Real extent = max( 200.0f, max( fabs(hiWorld.x - loWorld.x), fabs(hiWorld.y - loWorld.y) ) );
+
+		Region3D worldRegion;
+		worldRegion.lo.x = centerX - extent;
+		worldRegion.lo.y = centerY - extent;
+		worldRegion.lo.z = -HUGE_DIST;
+		worldRegion.hi.x = centerX + extent;
+		worldRegion.hi.y = centerY + extent;
+		worldRegion.hi.z = HUGE_DIST;
+
+		DrawableGrid::Query query( TheGameClient->getDrawableGrid(), &worldRegion );
+
+		for( Int i = 0; i < query.getCount(); ++i )
 		{
+			draw = query.get( i );
+			if( draw == nullptr )
+				continue;
+
 			// not inside
 			inside = FALSE;
 
 			// project the center of the drawable to the screen
 			/// @todo use a real 3D position in the drawable
-			pos = *(*it)->getPosition();
+			pos = *draw->getPosition();
 			world.X = pos.x;
 			world.Y = pos.y;
 			world.Z = pos.z;
@@ -2213,7 +2241,7 @@ Int W3DView::iterateDrawablesInRegion( IRegion2D *screenRegion,
 			if( inside )
 			{
 
-				if( callback( (*it), userData ) )
+				if( callback( draw, userData ) )
 					++count;
 
 			}  // end if
@@ -210,6 +210,11 @@ void Win32BIGFileSystem::closeAllFiles() {
 
 Bool Win32BIGFileSystem::loadBigFilesFromDirectory(AsciiString dir, AsciiString fileMask, Bool overwrite) {
 
+#ifdef DEBUG_LOGGING
+	const UnsignedInt startTime = timeGetTime();
+	Int archiveCount = 0;
+#endif
+
 	FilenameList filenameList;
 	TheLocalFileSystem->getFileListInDirectory(dir, "", fileMask, filenameList, TRUE);
 
@@ -234,10 +239,15 @@ Bool Win32BIGFileSystem::loadBigFilesFromDirectory(AsciiString dir, AsciiString
 			m_archiveFileMap[(*it)] = archiveFile;
 			DEBUG_LOG(("Win32BIGFileSystem::loadBigFilesFromDirectory - %s inserted into the archive file map.", (*it).str()));
 			actuallyAdded = TRUE;
+#ifdef DEBUG_LOGGING
+			++archiveCount;
+#endif
 		}
 
 		it++;
 	}
 
+	DEBUG_LOG(("Win32BIGFileSystem::loadBigFilesFromDirectory - loaded %d archives from %s in %u ms.", archiveCount, dir.str(), timeGetTime() - startTime));
+
 	return actuallyAdded;
 }
@@ -0,0 +1,392 @@
+/*
+**	Command & Conquer Generals Zero Hour(tm)
+**	Copyright 2026 TheSuperHackers
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// FILE: DesyncDiff.cpp ///////////////////////////////////////////////////////////////////////////
+// Desc:   Compares two files written with -desyncBisect and reports the first frame, objects and
+//         modules whose CRCs differ.
+//
+// Usage:  desyncdiff <fileA> <fileB>
+//         Returns 0 if the files match, 1 if they differ and 2 on errors.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <Common/DesyncBisectFormat.h>
+#include <map>
+#include <set>
+#include <stdio.h>
+#include <string>
+#include <vector>
+
+using namespace DesyncBisect;
+
+//=============================================================================
+
+struct ObjectState
+{
+	UnsignedInt templateName;
+	std::vector<Entry> entries;
+};
+
+typedef std::map<UnsignedInt, ObjectState> ObjectStateMap;
+typedef std::set<UnsignedInt> ObjectIDSet;
+
+//=============================================================================
+/** Reads the records of one file in order and keeps the object state of the last frame read */
+//=============================================================================
+class DesyncFile
+{
+public:
+
+	DesyncFile() : m_file(nullptr), m_frame(0), m_logicCRC(0), m_atEnd(false) { }
+	~DesyncFile() { if (m_file) fclose(m_file); }
+
+	bool open(const char *filename);
+	bool readIndex(std::vector<IndexEntry>& index);
+	bool readFrame(ObjectIDSet& touched);	///< apply the next frame record, adds the changed object IDs to touched
+
+	bool atEnd() const { return m_atEnd; }
+	UnsignedInt getFrame() const { return m_frame; }
+	UnsignedInt getLogicCRC() const { return m_logicCRC; }
+	const ObjectStateMap& getObjects() const { return m_objects; }
+	const char *getName() const { return m_name.c_str(); }
+	const char *getString(UnsignedInt index) const { return index < m_strings.size() ? m_strings[index].c_str() : "<unknown>"; }
+
+private:
+
+	bool read(void *data, size_t size);
+
+	std::string m_name;
+	FILE *m_file;
+	std::vector<std::string> m_strings;
+	ObjectStateMap m_objects;
+	UnsignedInt m_frame;
+	UnsignedInt m_logicCRC;
+	bool m_atEnd;
+};
+
+//=============================================================================
+bool DesyncFile::read(void *data, size_t size)
+{
+	return size == 0 || fread(data, size, 1, m_file) == 1;
+}
+
+//=============================================================================
+bool DesyncFile::open(const char *filename)
+{
+	m_name = filename;
+	m_file = fopen(filename, "rb");
+	if (!m_file)
+	{
+		fprintf(stderr, "Cannot open '%s'\n", filename);
+		return false;
+	}
+
+	FileHeader header;
+	if (!read(&header, sizeof(header)) || header.magic != FILE_MAGIC)
+	{
+		fprintf(stderr, "'%s' is not a desync bisect file\n", filename);
+		return false;
+	}
+	if (header.version != FILE_VERSION)
+	{
+		fprintf(stderr, "'%s' has version %u, expected %u\n", filename, header.version, (UnsignedInt)FILE_VERSION);
+		return false;
+	}
+	return true;
+}
+
+//=============================================================================
+/** Reads the frame index from the end of the file, if the game wrote one */
+//=============================================================================
+bool DesyncFile::readIndex(std::vector<IndexEntry>& index)
+{
+	index.clear();
+
+	const long start = ftell(m_file);
+	bool found = false;
+
+	IndexTrailer trailer;
+	RecordHeader record;
+	if (fseek(m_file, -(long)sizeof(trailer), SEEK_END) == 0
+		&& read(&trailer, sizeof(trailer))
+		&& trailer.magic == FILE_MAGIC
+		&& fseek(m_file, (long)trailer.indexOffset, SEEK_SET) == 0
+		&& read(&record, sizeof(record))
+		&& record.type == RECORD_INDEX
+		&& record.size % sizeof(IndexEntry) == 0)
+	{
+		index.resize(record.size / sizeof(IndexEntry));
+		found = index.empty() || read(&index[0], record.size);
+		if (!found)
+			index.clear();
+	}
+
+	fseek(m_file, start, SEEK_SET);
+	return found;
+}
+
+//=============================================================================
+bool DesyncFile::readFrame(ObjectIDSet& touched)
+{
+	RecordHeader record;
+	while (!m_atEnd)
+	{
+		if (!read(&record, sizeof(record)))
+		{
+			// a game that did not end normally has no index
+			m_atEnd = true;
+			return false;
+		}
+
+		switch (record.type)
+		{
+			case RECORD_STRING:
+			{
+				std::string str(record.size, '\0');
+				if (record.size > 0 && !read(&str[0], record.size))
+				{
+					m_atEnd = true;
+					return false;
+				}
+				m_strings.push_back(str);
+				break;
+			}
+
+			case RECORD_FRAME:
+			{
+				FrameHeader frame;
+				if (!read(&frame, sizeof(frame)))
+				{
+					m_atEnd = true;
+					return false;
+				}
+
+				for (UnsignedInt i = 0; i < frame.objectCount; ++i)
+				{
+					ObjectHeader object;
+					if (!read(&object, sizeof(object)))
+					{
+						m_atEnd = true;
+						return false;
+					}
+
+					touched.insert(object.objectID);
+
+					if (object.entryCount == OBJECT_REMOVED)
+					{
+						m_objects.erase(object.objectID);
+						continue;
+					}
+
+					ObjectState& state = m_objects[object.objectID];
+					state.templateName = object.templateName;
+					state.entries.resize(object.entryCount);
+					if (object.entryCount > 0 && !read(&state.entries[0], object.entryCount * sizeof(Entry)))
+					{
+						m_atEnd = true;
+						return false;
+					}
+				}
+
+				m_frame = frame.frame;
+				m_logicCRC = frame.logicCRC;
+				return true;
+			}
+
+			default:
+				// the index, or a record that a newer version added
+				if (record.type == RECORD_INDEX || fseek(m_file, (long)record.size, SEEK_CUR) != 0)
+				{
+					m_atEnd = true;
+					return false;
+				}
+				break;
+		}
+	}
+	return false;
+}
+
+//=============================================================================
+
+static const ObjectState *findObject(const DesyncFile& file, UnsignedInt id)
+{
+	ObjectStateMap::const_iterator it = file.getObjects().find(id);
+	return it != file.getObjects().end() ? &it->second : nullptr;
+}
+
+//=============================================================================
+
+static const char *objectName(UnsignedInt id)
+{
+	return id == GLOBAL_OBJECT_ID ? " (global)" : "";
+}
+
+//=============================================================================
+/** Prints the differences of one object. Returns true if there are any. Names are compared as
+	* strings, because the string numbers depend on the order the names were first used. */
+//=============================================================================
+static bool diffObject(const DesyncFile& a, const DesyncFile& b, UnsignedInt id, bool print)
+{
+	const ObjectState *stateA = findObject(a, id);
+	const ObjectState *stateB = findObject(b, id);
+
+	if (!stateA && !stateB)
+		return false;
+
+	if (!stateA || !stateB)
+	{
+		if (print)
+		{
+			const DesyncFile& owner = stateA ? a : b;
+			const ObjectState *state = stateA ? stateA : stateB;
+			printf("  Object %u%s %s only exists in %s\n", id, objectName(id), owner.getString(state->templateName), owner.getName());
+		}
+		return true;
+	}
+
+	bool differs = false;
+
+	if (std::string(a.getString(stateA->templateName)) != b.getString(stateB->templateName))
+	{
+		differs = true;
+		if (print)
+			printf("  Object %u%s is %s in %s and %s in %s\n", id, objectName(id),
+				a.getString(stateA->templateName), a.getName(), b.getString(stateB->templateName), b.getName());
+	}
+
+	const size_t count = stateA->entries.size() > stateB->entries.size() ? stateA->entries.size() : stateB->entries.size();
+	for (size_t i = 0; i < count; ++i)
+	{
+		const Entry *entryA = i < stateA->entries.size() ? &stateA->entries[i] : nullptr;
+		const Entry *entryB = i < stateB->entries.size() ? &stateB->entries[i] : nullptr;
+
+		if (entryA && entryB && entryA->crc == entryB->crc
+			&& std::string(a.getString(entryA->name)) == b.getString(entryB->name))
+			continue;
+
+		if (print)
+		{
+			if (!differs)
+				printf("  Object %u%s %s\n", id, objectName(id), a.getString(stateA->templateName));
+
+			if (entryA && entryB)
+				printf("    %-48s %08X %08X%s\n", a.getString(entryA->name), entryA->crc, entryB->crc,
+					std::string(a.getString(entryA->name)) != b.getString(entryB->name) ? " (different modules)" : "");
+			else if (entryA)
+				printf("    %-48s %08X only in %s\n", a.getString(entryA->name), entryA->crc, a.getName());
+			else
+				printf("    %-48s %08X only in %s\n", b.getString(entryB->name), entryB->crc, b.getName());
+		}
+		differs = true;
+	}
+
+	return differs;
+}
+
+//=============================================================================
+
+int main(int argc, char *argv[])
+{
+	if (argc != 3)
+	{
+		fprintf(stderr, "Usage: desyncdiff <fileA> <fileB>\n");
+		return 2;
+	}
+
+	DesyncFile a;
+	DesyncFile b;
+	if (!a.open(argv[1]) || !b.open(argv[2]))
+		return 2;
+
+	// The index gives the first logic CRC mismatch without reading the object data
+	std::vector<IndexEntry> indexA;
+	std::vector<IndexEntry> indexB;
+	if (a.readIndex(indexA) && b.readIndex(indexB))
+	{
+		size_t i = 0;
+		size_t j = 0;
+		while (i < indexA.size() && j < indexB.size())
+		{
+			if (indexA[i].frame < indexB[j].frame)
+				++i;
+			else if (indexA[i].frame > indexB[j].frame)
+				++j;
+			else if (indexA[i].logicCRC != indexB[j].logicCRC)
+				break;
+			else
+			{
+				++i;
+				++j;
+			}
+		}
+		if (i < indexA.size() && j < indexB.size())
+			printf("First logic CRC mismatch on frame %u: %08X %08X\n", indexA[i].frame, indexA[i].logicCRC, indexB[j].logicCRC);
+		else
+			printf("Logic CRCs match on all common frames\n");
+	}
+
+	// Apply the frame records of both files in step. Only the objects that were written since the
+	// last common frame can differ, because the state was equal at that frame.
+	ObjectIDSet touched;
+	bool haveA = a.readFrame(touched);
+	bool haveB = b.readFrame(touched);
+
+	while (haveA && haveB)
+	{
+		if (a.getFrame() < b.getFrame())
+		{
+			haveA = a.readFrame(touched);
+			continue;
+		}
+		if (a.getFrame() > b.getFrame())
+		{
+			haveB = b.readFrame(touched);
+			continue;
+		}
+
+		bool differs = false;
+		for (ObjectIDSet::const_iterator it = touched.begin(); it != touched.end() && !differs; ++it)
+			differs = diffObject(a, b, *it, false);
+
+		if (differs || a.getLogicCRC() != b.getLogicCRC())
+		{
+			printf("First difference on frame %u, logic CRC %08X in %s and %08X in %s\n",
+				a.getFrame(), a.getLogicCRC(), a.getName(), b.getLogicCRC(), b.getName());
+
+			if (!differs)
+				printf("  No object or module differs, the difference is in state that is not recorded per object\n");
+
+			for (ObjectIDSet::const_iterator it = touched.begin(); it != touched.end(); ++it)
+				diffObject(a, b, *it, true);
+
+			return 1;
+		}
+
+		touched.clear();
+		haveA = a.readFrame(touched);
+		haveB = b.readFrame(touched);
+	}
+
+	if (haveA != haveB)
+	{
+		printf("No difference up to frame %u, %s ends earlier\n", haveA ? b.getFrame() : a.getFrame(), haveA ? b.getName() : a.getName());
+		return 1;
+	}
+
+	printf("No difference\n");
+	return 0;
+}
@@ -44,6 +44,7 @@
 // USER INCLUDES //////////////////////////////////////////////////////////////
 #include "Lib/BaseType.h"
 #include "Common/Debug.h"
+#include "Common/CriticalSection.h"
 #include "Common/GameMemory.h"
 #include "Common/GlobalData.h"
 #include "Common/NameKeyGenerator.h"
@@ -75,6 +76,7 @@
 #include "Common/ModuleFactory.h"
 #include "Common/PlayerTemplate.h"
 #include "Common/MultiplayerSettings.h"
+#include "Common/WorkerThreadPool.h"
 
 #include "GameLogic/Armor.h"
 #include "GameLogic/CaveSystem.h"
@@ -200,6 +202,46 @@ static char *nextParam(char *newSource, const char *seps)
 	return first;
 }
 
+//-------------------------------------------------------------------------------------------------
+/** Returns true if the whole string is an optionally negative decimal number, so that a map name
+	* that starts with a digit is not taken for a thread count. */
+//-------------------------------------------------------------------------------------------------
+static Bool isInteger( const char *str )
+{
+	if (*str == '-')
+		++str;
+
+	if (*str == '\0')
+		return FALSE;
+
+	for (; *str != '\0'; ++str)
+	{
+		if (!isdigit((unsigned char)*str))
+			return FALSE;
+	}
+	return TRUE;
+}
+
+// Necessary to allow memory managers and such to have useful critical sections, the -threads workers allocate too
+static CriticalSection critSec1, critSec2, critSec3, critSec4, critSec5;
+
+//-------------------------------------------------------------------------------------------------
+/** Writes to the console that started the tool, if any, because this is a windows application
+	* without a console of its own. */
+//-------------------------------------------------------------------------------------------------
+static void printToConsole( const char *text )
+{
+	HANDLE out = GetStdHandle(STD_OUTPUT_HANDLE);
+	if ((out == nullptr || out == INVALID_HANDLE_VALUE) && AttachConsole(ATTACH_PARENT_PROCESS))
+		out = GetStdHandle(STD_OUTPUT_HANDLE);
+
+	if (out != nullptr && out != INVALID_HANDLE_VALUE)
+	{
+		DWORD written;
+		WriteFile(out, text, (DWORD)strlen(text), &written, nullptr);
+	}
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // PUBLIC FUNCTIONS ///////////////////////////////////////////////////////////
 ///////////////////////////////////////////////////////////////////////////////
@@ -211,6 +253,12 @@ Int APIENTRY WinMain( HINSTANCE hInstance, HINSTANCE hPrevInstance,
                       LPSTR lpCmdLine, Int nCmdShow )
 {
 
+	TheAsciiStringCriticalSection = &critSec1;
+	TheUnicodeStringCriticalSection = &critSec2;
+	TheDmaCriticalSection = &critSec3;
+	TheMemoryPoolCriticalSection = &critSec4;
+	TheDebugLogCriticalSection = &critSec5;
+
 	// initialize the memory manager early
 	initMemoryManager();
 
@@ -282,6 +330,31 @@ Int APIENTRY WinMain( HINSTANCE hInstance, HINSTANCE hPrevInstance,
 
 	TheWritableGlobalData->m_buildMapCache = TRUE;
 
+	// TheSuperHackers @feature Computes the map CRCs and decompresses the maps on worker threads with -threads <count>.
+	// Without a count, or with -1, it uses one thread less than there are processors.
+	for (std::list<std::string>::iterator it = argvSet.begin(); it != argvSet.end(); ++it)
+	{
+		if (stricmp(it->c_str(), "-threads") == 0)
+		{
+			Int numThreads = -1;
+			std::list<std::string>::iterator countIt = it;
+			++countIt;
+			if (countIt != argvSet.end() && isInteger(countIt->c_str()))
+			{
+				numThreads = atoi(countIt->c_str());
+				argvSet.erase(countIt);
+			}
+			argvSet.erase(it);
+
+			if (numThreads != 0)
+			{
+				TheWorkerThreadPool = new WorkerThreadPool;
+				TheWorkerThreadPool->init(numThreads);
+			}
+			break;
+		}
+	}
+
 	TheMapCache = new MapCache;
 
 	// add in allowed maps
@@ -291,11 +364,22 @@ Int APIENTRY WinMain( HINSTANCE hInstance, HINSTANCE hPrevInstance,
 		TheMapCache->addShippingMap((*cit).c_str());
 	}
 
+	const UnsignedInt startTime = timeGetTime();
+
 	TheMapCache->updateCache();
 
+	AsciiString timing;
+	timing.format("Built the map cache of %d maps in %u ms on %d worker threads\n", (Int)TheMapCache->size(),
+		timeGetTime() - startTime, TheWorkerThreadPool ? TheWorkerThreadPool->getThreadCount() : 0);
+	printToConsole(timing.str());
+	DEBUG_LOG(("%s", timing.str()));
+
 	delete TheMapCache;
 	TheMapCache = nullptr;
 
+	delete TheWorkerThreadPool;
+	TheWorkerThreadPool = nullptr;
+
 	// load the dialog box
 	//DialogBox( hInstance, (LPCTSTR)IMAGE_PACKER_DIALOG,
 	//					 nullptr, (DLGPROC)ImagePackerProc );
@@ -320,6 +404,12 @@ Int APIENTRY WinMain( HINSTANCE hInstance, HINSTANCE hPrevInstance,
 
 	shutdownMemoryManager();
 
+	TheAsciiStringCriticalSection = nullptr;
+	TheUnicodeStringCriticalSection = nullptr;
+	TheDmaCriticalSection = nullptr;
+	TheMemoryPoolCriticalSection = nullptr;
+	TheDebugLogCriticalSection = nullptr;
+
 	// all done
 	return 0;
 
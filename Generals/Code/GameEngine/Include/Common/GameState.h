@@ -162,6 +162,8 @@ public:
 										 SnapshotType which = SNAPSHOT_SAVELOAD  );  ///< save a game
 	SaveCode missionSave( void );																	 ///< do a in between mission save
 	SaveCode loadGame( AvailableGameInfo gameInfo );							 ///< load a save file
+	SaveCode saveGameToBuffer( std::vector<UnsignedByte>& buffer );			 ///< save the game into memory, without any user messages
+	SaveCode loadGameFromBuffer( const void *data, Int dataSize );		 ///< load a game saved with saveGameToBuffer
 	SaveGameInfo *getSaveGameInfo( void ) { return &m_gameInfo; }
 
 	// snapshot interaction
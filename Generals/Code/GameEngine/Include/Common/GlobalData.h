@@ -350,6 +350,12 @@ public:
 
 	std::vector<AsciiString> m_simulateReplays; ///< If not empty, simulate this list of replays and exit.
 	Int m_simulateReplayJobs; ///< Maximum number of processes to use for simulation, or SIMULATE_REPLAYS_SEQUENTIAL for sequential simulation
+	AsciiString m_simulateReplaySummaryFile; ///< If not empty, write the time taken by each simulated replay to this CSV file
+	UnsignedInt m_replaySnapshotInterval; ///< If not 0, keep an in-memory snapshot of replay playback every this many logic frames
+	Int m_replaySeekFrame; ///< If not negative, seek to this logic frame when replay playback starts
+	AsciiString m_desyncBisectFile; ///< If not empty, write the CRC of every object and module at each CRC frame of replay playback to this file
+	AsciiString m_perfTraceFile; ///< If not empty, write the PerfTrace timeline to this file
+	Int m_perfTraceMinTime; ///< PerfTrace scopes that are shorter than this many microseconds are not written
 
 	Int m_maxParticleCount;						///< maximum number of particles that can exist
 	Int m_maxFieldParticleCount;			///< maximum number of field-type particles that can exist (roughly)
@@ -538,6 +544,10 @@ public:
 	Int m_latencyPeriod;					///< Period of sinusoidal modulation of latency
 	Int m_latencyNoise;						///< Max amplitude of jitter to throw in
 	Int m_packetLoss;							///< Percent of packets to drop
+	Int m_latencySpikeChance;			///< Percent of packets that get a latency spike
+	Int m_latencySpike;						///< Mean duration of a latency spike in ms
+	Int m_packetReorder;					///< Percent of packets that arrive after the next packet
+	UnsignedInt m_networkSimulatorSeed;	///< Seed of the packet loss and latency simulation
 	Bool m_extraLogging;					///< More expensive debug logging to catch crashes.
 #endif
 
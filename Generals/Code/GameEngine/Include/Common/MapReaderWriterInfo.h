@@ -87,6 +87,7 @@ public:
 	CachedFileInputStream(void);
 	~CachedFileInputStream(void);
 	Bool open(AsciiString path);	///< Returns true if open succeeded.
+	Bool openBuffer(char *buffer, Int size);	///< Takes ownership of the file contents in buffer, which must come from NEW char[]. Does not use the file system.
 	void close(void);  ///< Explict close.  Destructor closes if file is left open.
 	virtual Int read(void *pData, Int numBytes);
 	virtual UnsignedInt tell(void);
@@ -97,6 +97,9 @@ public:
 	NameKeyType nameToKey(const char* name);
 	NameKeyType nameToLowercaseKey(const char *name);
 
+	/// Given a string, return its existing key, or NAMEKEY_INVALID if it was never converted. Never creates a key.
+	NameKeyType findNameKey(const AsciiString& name) const;
+
 	// given a key, return the name. this is almost never needed,
 	// except for a few rare cases like object serialization. also
 	// note that it's not particularly fast; it does a dumb linear
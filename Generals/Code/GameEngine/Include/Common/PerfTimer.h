@@ -41,6 +41,7 @@
 #endif
 
 #include "Common/GameCommon.h"	// ensure we get DUMP_PERF_STATS, or not
+#include "Common/PerfTrace.h"
 
 #ifdef PERF_TIMERS
 #include "GameLogic/GameLogic.h"
@@ -230,7 +231,7 @@ AutoPerfGatherIgnore::~AutoPerfGatherIgnore()
 //-------------------------------------------------------------------------------------------------
 #define DECLARE_TOTAL_PERF_TIMER(id)					static PerfGather s_##id(#id, false);
 #define DECLARE_PERF_TIMER(id)					static PerfGather s_##id(#id);
-#define USE_PERF_TIMER(id)							AutoPerfGather a_##id(s_##id);
+#define USE_PERF_TIMER(id)							AutoPerfGather a_##id(s_##id); PERF_TRACE_SCOPE(id)
 #define IGNORE_PERF_TIMER(id)						AutoPerfGatherIgnore a_##id(s_##id);
 
 //-------------------------------------------------------------------------------------------------
@@ -314,7 +315,8 @@ extern void StatMetricsDisplay( DebugDisplayInterface *dd, void *, FILE *fp );
 
 	#define DECLARE_PERF_TIMER(id)
 	#define  DECLARE_TOTAL_PERF_TIMER(id)
-	#define USE_PERF_TIMER(id)
+	// TheSuperHackers @feature The timers still show up in the PerfTrace timeline without PERF_TIMERS.
+	#define USE_PERF_TIMER(id)							PERF_TRACE_SCOPE(id)
 	#define IGNORE_PERF_TIMER(id)
 
 #endif	// PERF_TIMERS
@@ -54,6 +54,7 @@ enum RecorderModeType CPP_11(: Int) {
 };
 
 class CRCInfo;
+struct ReplaySnapshot;
 
 class RecorderClass : public SubsystemInterface {
 public:
@@ -84,6 +85,14 @@ public:
 #endif
 	Bool isPlaybackInProgress() const;
 
+	// TheSuperHackers @feature Replay snapshots. During playback the complete game state is saved into
+	// memory every TheGlobalData->m_replaySnapshotInterval logic frames, so that seeking only needs to
+	// restore the nearest earlier snapshot and simulate forward from there.
+	void updateSnapshots();														///< Take a due snapshot or perform a requested seek. Only call this between logic frames.
+	void requestSeek(UnsignedInt frame) { m_seekFrame = frame; }	///< Seek to this frame at the next updateSnapshots call.
+	Bool seekToFrame(UnsignedInt frame);							///< Restore the nearest snapshot and simulate up to the frame. Only call this between logic frames.
+	Int getSnapshotCount() const { return (Int)m_snapshots.size(); }
+
 public:
 	void handleCRCMessage(UnsignedInt newCRC, Int playerIndex, Bool fromPlayback);
 protected:
@@ -115,6 +124,7 @@ public:
 
 	RecorderModeType getMode();												///< Returns the current operating mode.
 	Bool isPlaybackMode() const { return m_mode == RECORDERMODETYPE_PLAYBACK || m_mode == RECORDERMODETYPE_SIMULATION_PLAYBACK; }
+	Bool isRestoringSnapshot() const { return m_isRestoringSnapshot; }	///< TRUE while a replay snapshot is loaded, which resets the game engine
 	void initControls();															///< Show or Hide the Replay controls
 
 	static AsciiString getReplayDir();								///< Returns the directory that holds the replay files.
@@ -158,6 +168,10 @@ protected:
 
 	CullBadCommandsResult cullBadCommands(); ///< prevent the user from giving mouse commands that he shouldn't be able to do during playback.
 
+	void takeSnapshotIfDue();													///< Save a snapshot if the snapshot interval has passed.
+	Bool restoreSnapshot(const ReplaySnapshot& snapshot);	///< Load the game state and playback position of a snapshot.
+	void clearSnapshots();
+
 	File* m_file;
 	AsciiString m_fileName;
 	Int m_currentFilePosition;
@@ -174,6 +188,10 @@ protected:
 	Int m_originalGameMode; // valid in replays
 
 	UnsignedInt m_nextFrame;												///< The Frame that the next message is to be executed on.  This can be -1.
+
+	std::vector<ReplaySnapshot *> m_snapshots;				///< Snapshots of the playback, sorted by frame.
+	Int m_seekFrame;																	///< Frame requested by requestSeek, or -1.
+	Bool m_isRestoringSnapshot;												///< Keeps the playback alive while the game engine is reset by the snapshot load.
 };
 
 extern RecorderClass *TheRecorder;
@@ -165,6 +165,8 @@ public:
 #endif
 	virtual void preloadModelAssets( AsciiString model ) = 0;	///< preload model asset
 	virtual void preloadTextureAssets( AsciiString texture ) = 0;	///< preload texture asset
+	virtual void beginPreloadModelAssets() {}	///< hold back the models of preloadModelAssets until endPreloadModelAssets
+	virtual void endPreloadModelAssets() {}		///< preload the held back models together
 
 	virtual void takeScreenShot(void) = 0;										///< saves screenshot to a file
 	virtual void toggleMovieCapture(void) = 0;							///< starts saving frames to an avi or frame sequence
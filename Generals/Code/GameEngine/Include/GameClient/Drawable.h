@@ -292,6 +292,8 @@ class Drawable : public Thing,
 
 	MEMORY_POOL_GLUE_WITH_USERLOOKUP_CREATE(Drawable, "Drawable" )
 
+	friend class DrawableGrid;
+
 public:
 
 	Drawable( const ThingTemplate *thing, DrawableStatusBits statusBits = DRAWABLE_STATUS_DEFAULT );
@@ -641,6 +643,8 @@ private:
 	DrawableID m_id;						///< this drawable's unique ID
 	Drawable *m_nextDrawable;
 	Drawable *m_prevDrawable;		///< list links
+	Int m_gridBucket;						///< bucket in the DrawableGrid of TheGameClient, or -1
+	Int m_gridIndex;						///< index in that bucket
 
 	DrawableStatusBits m_status;		///< status bits (see DrawableStatus enum)
 	UnsignedInt m_tintStatus;				///< tint color status bits (see TintStatus enum)
@@ -36,6 +36,11 @@
 #include "Common/STLTypedefs.h"
 #include "ref_ptr.h"
 
+#if RETAIL_COMPATIBLE_CRC
+#undef ENABLE_TARGET_SCAN_BUDGET
+#define ENABLE_TARGET_SCAN_BUDGET (0)
+#endif
+
 class AIGroup;
 class AttackPriorityInfo;
 class BuildListInfo;
@@ -223,6 +228,8 @@ public:
 	Real  m_aiDozerBoredRadiusModifier;  // Modifies ai dozers scan range so the move out farther than human ones.
 	Bool	m_aiCrushesInfantry; // If true, AI vehicles will attempt to crush infantry.
 
+	Int		m_maxTargetScansPerFrame; // How many idle units may scan for a target in one frame, 0 for no limit. Needs ENABLE_TARGET_SCAN_BUDGET.
+
 	AISideInfo *m_sideInfo;
 
 	AISideBuildList *m_sideBuildLists;
@@ -290,6 +297,14 @@ public:
 
 	UnsignedInt getNextGroupID( void ) { return ++m_nextGroupID; }
 
+#if ENABLE_TARGET_SCAN_BUDGET
+	/// Returns whether an idle unit may scan for a target in this frame. The caller keeps the ticket,
+	/// which holds its place in line while it has to wait, and is 0 otherwise.
+	Bool requestTargetScan( UnsignedInt &ticket );
+	Int getTargetScanCount( void ) const { return m_targetScanCount; }						///< scans that ran in this frame
+	Int getDeferredTargetScanCount( void ) const { return m_deferredTargetScanCount; }	///< scans that had to wait in this frame
+#endif
+
 protected:
 	Pathfinder *m_pathfinder;							///< the pathfinding system
 	std::list<AIGroup *> m_groupList;			///< the list of AIGroups
@@ -299,6 +314,20 @@ protected:
 
 	UnsignedInt m_nextGroupID;
 	FormationID m_nextFormationID;
+
+#if ENABLE_TARGET_SCAN_BUDGET
+	void resetTargetScans( void );
+
+	UnsignedInt m_targetScanFrame;						///< frame the counts are for
+	UnsignedInt m_nextTargetScanTicket;				///< ticket for the next caller that has to wait
+	UnsignedInt m_targetScanReservedStart;		///< first ticket with a reserved scan in this frame
+	UnsignedInt m_targetScanReservedEnd;			///< tickets from the start up to here have a reserved scan in this frame
+	Int m_targetScanCount;
+	Int m_newTargetScanCount;									///< scans of callers without a ticket in this frame
+	Int m_deferredTargetScanCount;
+	Int m_totalTargetScanCount;
+	Int m_totalDeferredTargetScanCount;
+#endif
 };
 
 extern AI *TheAI;												///< the Artificial Intelligence singleton
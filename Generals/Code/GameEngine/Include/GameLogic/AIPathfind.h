@@ -486,6 +486,7 @@ public:
 	~ZoneBlock();  // not virtual, please don't override without making virtual.  jba.
 
 	void blockCalculateZones(	PathfindCell **map, PathfindLayer layers[], const IRegion2D &bounds);	///< Does zone calculations.
+	void labelCellZones( PathfindCell **map, const IRegion2D &bounds );	///< Numbers the connected cells of the block 1, 2, 3...
 	zoneStorageType getEffectiveZone(LocomotorSurfaceTypeMask acceptableSurfaces, Bool crusher, zoneStorageType zone) const;
 
 	void clearMarkedPassable(void) {m_markedPassable = false;}
@@ -495,6 +496,9 @@ public:
 	Bool getInteractsWithBridge(void) const {return m_interactsWithBridge;}
 	void setInteractsWithBridge(Bool interacts) {m_interactsWithBridge = interacts;}
 
+	Bool getCellsInteractWithBridge(void) const {return m_cellsInteractWithBridge;}
+	Int getNumCellZones(void) const {return m_numCellZones;}
+
 protected:
 	void allocateZones(void);
 	void freeZones(void);
@@ -513,6 +517,9 @@ protected:
 	zoneStorageType *m_crusherZones;
 	Bool					m_interactsWithBridge;
 	Bool					m_markedPassable;
+
+	UnsignedShort m_numCellZones;							///< Zones labelCellZones gave the cells of the block.
+	Bool					m_cellsInteractWithBridge;	///< Some cell of the block connects to a layer.
 };
 typedef ZoneBlock *ZoneBlockP;
 
@@ -565,6 +572,7 @@ protected:
 protected:
 	ZoneBlock			*m_blockOfZoneBlocks;			///< Zone blocks - Info for hierarchical pathfinding at a "blocky" level.
 	ZoneBlock			**m_zoneBlocks;						///< Zone blocks as a matrix - contains matrix indexing into the map.
+	zoneStorageType *m_blockZoneBases;			///< Zone base of each block in the running zone calculation.
 	ICoord2D			m_zoneBlockExtent;				///< Zone block extents. Not the same scale as the pathfind extents.
 
 	UnsignedShort m_maxZone;								///< Max zone used.
@@ -748,6 +748,9 @@ private:
 	// AI -------------------------------------------------------------------------------------------
 	AttitudeType	m_attitude;
 	UnsignedInt		m_nextMoodCheckTime;
+#if ENABLE_TARGET_SCAN_BUDGET
+	UnsignedInt		m_targetScanTicket;										///< place in line while waiting for a target scan, see AI::requestTargetScan
+#endif
 
 	// Common AI "status" effects -------------------------------------------------------------------
 #ifdef ALLOW_DEMORALIZE
@@ -415,6 +415,23 @@ protected:
 	Bool hasUnitCompletedSequentialScript( Object *object, const AsciiString& sequentialScriptName );
 	Bool hasTeamCompletedSequentialScript( Team *team, const AsciiString& sequentialScriptName );
 
+	// TheSuperHackers @performance Index of m_namedObjects by name and by object, so that the named object
+	// lookups do not scan the whole list. Each index keeps its slots in ascending order, so the first slot
+	// is the one that a scan of the list would find first.
+	typedef std::vector<Int> NamedSlotList;
+	struct NamedObjectHash
+	{
+		size_t operator()(const Object *obj) const { return (size_t)obj / sizeof(void*); }
+	};
+	typedef std::hash_map< AsciiString, NamedSlotList, rts::hash<AsciiString>, rts::equal_to<AsciiString> > NamedSlotsByName;
+	typedef std::hash_map< const Object *, NamedSlotList, NamedObjectHash, rts::equal_to<const Object *> > NamedSlotsByObject;
+
+	Int findNamedSlot( const AsciiString& name ) const;	///< first slot in m_namedObjects with this name, or -1
+	Int findNamedSlot( const Object *obj ) const;				///< first slot in m_namedObjects with this object, or -1
+	void setNamedSlot( Int slot, const AsciiString& name, Object *obj );
+	void addNamedSlot( const AsciiString& name, Object *obj );
+	void rebuildNamedSlots( void );
+
 
 
 
@@ -434,6 +451,8 @@ protected:
 	Team							*m_conditionTeam;				///< Team that is being used to evaluate conditions, used for THIS_TEAM
 	Object						*m_conditionObject;				///< Unit that is being used to evaluate conditions, used for THIS_OBJECT
 	VecNamedRequests	m_namedObjects;
+	NamedSlotsByName	m_namedSlotsByName;
+	NamedSlotsByObject m_namedSlotsByObject;
 	Bool							m_firstUpdate;
 	Player						*m_currentPlayer;
 	Player						*m_skirmishHumanPlayer;
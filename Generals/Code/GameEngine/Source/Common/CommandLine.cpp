@@ -458,6 +458,74 @@ Int parseJobs(char *args[], int num)
 	return 1;
 }
 
+Int parseReplaySummary(char *args[], int num)
+{
+	if (num > 1)
+	{
+		TheWritableGlobalData->m_simulateReplaySummaryFile = args[1];
+		return 2;
+	}
+	return 1;
+}
+
+Int parseReplaySnapshotInterval(char *args[], int num)
+{
+	if (num > 1)
+	{
+		const Int interval = atoi(args[1]);
+		if (interval < 0)
+		{
+			printf("Invalid replay snapshot interval: %d\n", interval);
+			exit(1);
+		}
+		TheWritableGlobalData->m_replaySnapshotInterval = (UnsignedInt)interval;
+		return 2;
+	}
+	return 1;
+}
+
+Int parseReplaySeek(char *args[], int num)
+{
+	if (num > 1)
+	{
+		TheWritableGlobalData->m_replaySeekFrame = atoi(args[1]);
+		return 2;
+	}
+	return 1;
+}
+
+Int parseDesyncBisect(char *args[], int num)
+{
+	if (num > 1)
+	{
+		TheWritableGlobalData->m_desyncBisectFile = args[1];
+		return 2;
+	}
+	return 1;
+}
+
+#if ENABLE_PERF_TRACE
+Int parsePerfTrace(char *args[], int num)
+{
+	if (num > 1)
+	{
+		TheWritableGlobalData->m_perfTraceFile = args[1];
+		return 2;
+	}
+	return 1;
+}
+
+Int parsePerfTraceMinTime(char *args[], int num)
+{
+	if (num > 1)
+	{
+		TheWritableGlobalData->m_perfTraceMinTime = atoi(args[1]);
+		return 2;
+	}
+	return 1;
+}
+#endif
+
 Int parseXRes(char *args[], int num)
 {
 	if (num > 1)
@@ -534,6 +602,50 @@ Int parsePacketLoss(char *args[], int num)
 	return 2;
 }
 
+//=============================================================================
+//=============================================================================
+Int parseLatencySpikeChance(char *args[], int num)
+{
+	if (num > 1)
+	{
+		TheWritableGlobalData->m_latencySpikeChance = atoi(args[1]);
+	}
+	return 2;
+}
+
+//=============================================================================
+//=============================================================================
+Int parseLatencySpike(char *args[], int num)
+{
+	if (num > 1)
+	{
+		TheWritableGlobalData->m_latencySpike = atoi(args[1]);
+	}
+	return 2;
+}
+
+//=============================================================================
+//=============================================================================
+Int parsePacketReorder(char *args[], int num)
+{
+	if (num > 1)
+	{
+		TheWritableGlobalData->m_packetReorder = atoi(args[1]);
+	}
+	return 2;
+}
+
+//=============================================================================
+//=============================================================================
+Int parseNetworkSimulatorSeed(char *args[], int num)
+{
+	if (num > 1)
+	{
+		TheWritableGlobalData->m_networkSimulatorSeed = (UnsignedInt)strtoul(args[1], nullptr, 0);
+	}
+	return 2;
+}
+
 //=============================================================================
 //=============================================================================
 Int parseLowDetail(char *args[], int num)
@@ -1148,6 +1260,32 @@ static CommandLineParam paramsForStartup[] =
 	// (If you have 4 cores, call it with -jobs 4)
 	// If you do not call this, all replays will be simulated in sequence in the same process.
 	{ "-jobs", parseJobs },
+
+	// TheSuperHackers @feature Write the frame count, time and frames per second of each simulated
+	// replay to a CSV file. Pass the filename afterwards.
+	{ "-replaySummary", parseReplaySummary },
+
+	// TheSuperHackers @feature Keep an in-memory snapshot of the replay playback every N logic frames,
+	// so that seeking back and forth only simulates from the nearest snapshot. Pass N afterwards.
+	{ "-replaySnapshotInterval", parseReplaySnapshotInterval },
+
+	// TheSuperHackers @feature Seek to the given logic frame when the replay playback starts.
+	{ "-replaySeek", parseReplaySeek },
+
+	// TheSuperHackers @feature Write the CRC of every object and module at each CRC frame of the replay
+	// to a file. Pass the filename afterwards. Compare two of these files with the desyncdiff tool
+	// to find the first object and module that differs. Use it with a single replay.
+	{ "-desyncBisect", parseDesyncBisect },
+
+#if ENABLE_PERF_TRACE
+	// TheSuperHackers @feature Write a timeline of the perf timer scopes and the logic frames to a
+	// Chrome trace event file. Pass the filename afterwards. Use it with a single replay.
+	{ "-perfTrace", parsePerfTrace },
+
+	// TheSuperHackers @feature Leave perf timer scopes that are shorter than the given number of
+	// microseconds out of the -perfTrace file.
+	{ "-perfTraceMinTime", parsePerfTraceMinTime },
+#endif
 };
 
 // These Params are parsed during Engine Init before INI data is loaded
@@ -1247,6 +1385,10 @@ static CommandLineParam paramsForEngineInit[] =
 	{ "-latAmp", parseLatencyAmplitude },
 	{ "-latPeriod", parseLatencyPeriod },
 	{ "-latNoise", parseLatencyNoise },
+	{ "-latSpikeChance", parseLatencySpikeChance },
+	{ "-latSpike", parseLatencySpike },
+	{ "-packetReorder", parsePacketReorder },
+	{ "-netSimSeed", parseNetworkSimulatorSeed },
 	{ "-noViewLimit", parseNoViewLimit },
 	{ "-lowDetail", parseLowDetail },
 	{ "-noDynamicLOD", parseNoDynamicLOD },
@@ -49,6 +49,7 @@
 #include "Common/LocalFileSystem.h"
 #include "Common/GlobalData.h"
 #include "Common/PerfTimer.h"
+#include "Common/PerfTrace.h"
 #include "Common/RandomValue.h"
 #include "Common/NameKeyGenerator.h"
 #include "Common/ModuleFactory.h"
@@ -68,6 +69,7 @@
 #include "Common/Xfer.h"
 #include "Common/XferCRC.h"
 #include "Common/GameLOD.h"
+#include "Common/WorkerThreadPool.h"
 #include "Common/Registry.h"
 
 #include "GameLogic/Armor.h"
@@ -290,6 +292,9 @@ GameEngine::~GameEngine()
 	delete TheFileSystem;
 	TheFileSystem = nullptr;
 
+	delete TheWorkerThreadPool;
+	TheWorkerThreadPool = nullptr;
+
 	Drawable::killStaticImages();
 
 	_Module.Term();
@@ -297,6 +302,10 @@ GameEngine::~GameEngine()
 #ifdef PERF_TIMERS
 	PerfGather::termPerfDump();
 #endif
+
+#if ENABLE_PERF_TRACE
+	PerfTrace::close();
+#endif
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -371,6 +380,10 @@ void GameEngine::init()
 		// Create the low-level file system interface
 		TheFileSystem = createFileSystem();
 
+		// not part of the subsystem list, because it keeps no state between the jobs it runs
+		TheWorkerThreadPool = MSGNEW("GameEngineSubsystem") WorkerThreadPool;
+		TheWorkerThreadPool->init();
+
 		// not part of the subsystem list, because it should normally never be reset!
 		TheNameKeyGenerator = MSGNEW("GameEngineSubsystem") NameKeyGenerator;
 		TheNameKeyGenerator->init();
@@ -418,6 +431,10 @@ void GameEngine::init()
 	#ifdef PERF_TIMERS
 		PerfGather::initPerfDump("AAAPerfStats", PerfGather::PERF_NETTIME);
 	#endif
+	#if ENABLE_PERF_TRACE
+		if (!TheGlobalData->m_perfTraceFile.isEmpty())
+			PerfTrace::open(TheGlobalData->m_perfTraceFile.str(), TheGlobalData->m_perfTraceMinTime);
+	#endif
 
 		// read the water settings from INI (must do prior to initing GameClient, apparently)
 		ini.loadFileDirectory( "Data\\INI\\Default\\Water", INI_LOAD_OVERWRITE, &xferCRC );
@@ -736,6 +753,9 @@ void GameEngine::update( void )
 
 		if (canUpdateLogic)
 		{
+			// TheSuperHackers @feature Replay snapshots are taken and restored between logic frames.
+			TheRecorder->updateSnapshots();
+
 			TheGameClient->step();
 			TheGameLogic->UPDATE();
 		}
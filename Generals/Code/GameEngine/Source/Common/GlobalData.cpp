@@ -371,6 +371,10 @@ GlobalData* GlobalData::m_theOriginal = nullptr;
 	{ "LatencyPeriod",							INI::parseInt,				nullptr,			offsetof( GlobalData, m_latencyPeriod ) },
 	{ "LatencyNoise",								INI::parseInt,				nullptr,			offsetof( GlobalData, m_latencyNoise ) },
 	{ "PacketLoss",									INI::parseInt,				nullptr,			offsetof( GlobalData, m_packetLoss ) },
+	{ "LatencySpikeChance",					INI::parseInt,				nullptr,			offsetof( GlobalData, m_latencySpikeChance ) },
+	{ "LatencySpike",								INI::parseInt,				nullptr,			offsetof( GlobalData, m_latencySpike ) },
+	{ "PacketReorder",							INI::parseInt,				nullptr,			offsetof( GlobalData, m_packetReorder ) },
+	{ "NetworkSimulatorSeed",				INI::parseUnsignedInt,	nullptr,		offsetof( GlobalData, m_networkSimulatorSeed ) },
 */
 
 	{ "BuildSpeed",									INI::parseReal,				nullptr,			offsetof( GlobalData, m_BuildSpeed ) },
@@ -598,6 +602,10 @@ GlobalData::GlobalData()
 	m_latencyPeriod = 0;
 	m_latencyNoise = 0;
 	m_packetLoss = 0;
+	m_latencySpikeChance = 0;
+	m_latencySpike = 0;
+	m_packetReorder = 0;
+	m_networkSimulatorSeed = 0;
 	m_saveStats = FALSE;
 	m_saveAllStats = FALSE;
 	m_useLocalMOTD = FALSE;
@@ -977,6 +985,12 @@ GlobalData::GlobalData()
 
 	m_simulateReplays.clear();
 	m_simulateReplayJobs = SIMULATE_REPLAYS_SEQUENTIAL;
+	m_simulateReplaySummaryFile.clear();
+	m_replaySnapshotInterval = 0;
+	m_replaySeekFrame = -1;
+	m_desyncBisectFile.clear();
+	m_perfTraceFile.clear();
+	m_perfTraceMinTime = 0;
 
 	for (i = LEVEL_FIRST; i <= LEVEL_LAST; ++i)
 		m_healthBonus[i] = 1.0f;
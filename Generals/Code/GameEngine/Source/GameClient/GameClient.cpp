@@ -479,6 +479,7 @@ void GameClient::registerDrawable( Drawable *draw )
 
 	// add the drawable to the master list
 	draw->prependToList( &m_drawableList );
+	m_drawableGrid.add( draw );
 
 }
 
@@ -760,20 +761,26 @@ void GameClient::updateHeadless()
  */
 void GameClient::iterateDrawablesInRegion( Region3D *region, GameClientFuncPtr userFunc, void *userData )
 {
-	Drawable *draw, *nextDrawable;
-
-	for( draw = m_drawableList; draw; draw=nextDrawable )
+	if( region == nullptr )
 	{
-		nextDrawable = draw->getNextDrawable();
+		Drawable *draw, *nextDrawable;
 
-		Coord3D pos = *draw->getPosition();
-		if( region == nullptr ||
-			  (pos.x >= region->lo.x && pos.x <= region->hi.x &&
-			   pos.y >= region->lo.y && pos.y <= region->hi.y &&
-				 pos.z >= region->lo.z && pos.z <= region->hi.z) )
+		for( draw = m_drawableList; draw; draw=nextDrawable )
 		{
+			nextDrawable = draw->getNextDrawable();
 			(*userFunc)( draw, userData );
 		}
+		return;
+	}
+
+	// TheSuperHackers @performance Only look at the drawables in the grid cells of the region
+	DrawableGrid::Query query( &m_drawableGrid, region );
+
+	for( Int i = 0; i < query.getCount(); ++i )
+	{
+		Drawable *draw = query.get( i );
+		if( draw )
+			(*userFunc)( draw, userData );
 	}
 }
 
@@ -812,6 +819,7 @@ void GameClient::destroyDrawable( Drawable *draw )
 
 	// remove from the master list
 	draw->removeFromList(&m_drawableList);
+	m_drawableGrid.remove( draw );
 
 	//
 	// because drawables and objects are tightly coupled, not only MUST we maintain
@@ -1041,6 +1049,9 @@ void GameClient::preloadAssets( TimeOfDay timeOfDay )
 	MEMORYSTATUS before, after;
 	GlobalMemoryStatus(&before);
 
+	// TheSuperHackers @performance Load the models of all drawables together, so that their files are parsed in parallel
+	TheDisplay->beginPreloadModelAssets();
+
 	// first, for every drawable in the map load the assets for all states we care about
 	Drawable *draw;
 	for( draw = firstDrawable(); draw; draw = draw->getNextDrawable() )
@@ -1075,6 +1086,7 @@ void GameClient::preloadAssets( TimeOfDay timeOfDay )
 		}
 
 	}
+	TheDisplay->endPreloadModelAssets();
 	GlobalMemoryStatus(&after);
 
 	DEBUG_LOG(("Preloading memory dwAvailPageFile %d --> %d : %d",
@@ -1098,11 +1110,13 @@ void GameClient::preloadAssets( TimeOfDay timeOfDay )
 
 	GlobalMemoryStatus(&before);
 	extern std::vector<AsciiString>	debrisModelNamesGlobalHack;
+	TheDisplay->beginPreloadModelAssets();
 	size_t i=0;
 	for (; i<debrisModelNamesGlobalHack.size(); ++i)
 	{
 		TheDisplay->preloadModelAssets(debrisModelNamesGlobalHack[i]);
 	}
+	TheDisplay->endPreloadModelAssets();
 	GlobalMemoryStatus(&after);
 	debrisModelNamesGlobalHack.clear();
 
@@ -36,6 +36,7 @@
 #include "Common/LatchRestore.h"
 #include "Common/ThingTemplate.h"
 #include "Common/ThingFactory.h"
+#include "Common/WorkerThreadPool.h"
 
 #include "GameClient/Line2D.h"
 
@@ -2178,6 +2179,45 @@ inline void applyZone(PathfindCell &targetCell, const PathfindCell &sourceCell,
 
 }
 
+// TheSuperHackers @performance The equivalencies of the whole map are merged with a union find instead
+// of resolveZones, which visits every zone for each merge. A zone never gets a parent above itself, so
+// the root of a set is its lowest zone, and after flattenRootZones every zone refers to the lowest zone
+// it is connected to. That is the same result resolveZones gives, no matter the order of the merges.
+static Int findRootZone(zoneStorageType *zoneParents, Int zone)
+{
+	while (zoneParents[zone] != zone) {
+		zoneParents[zone] = zoneParents[zoneParents[zone]];
+		zone = zoneParents[zone];
+	}
+	return zone;
+}
+
+static void unionZones(Int zone1, Int zone2, zoneStorageType *zoneParents)
+{
+	DEBUG_ASSERTCRASH(zone1!=0 && zone2!=0,  ("Bad union zones."));
+	zone1 = findRootZone(zoneParents, zone1);
+	zone2 = findRootZone(zoneParents, zone2);
+	if (zone1 < zone2) {
+		zoneParents[zone2] = zone1;
+	} else {
+		zoneParents[zone1] = zone2;
+	}
+}
+
+inline void unionCellZones(const PathfindCell &targetCell, const PathfindCell &sourceCell, zoneStorageType *zoneParents)
+{
+	unionZones(targetCell.getZone(), sourceCell.getZone(), zoneParents);
+}
+
+static void flattenRootZones(zoneStorageType *zoneParents, Int sizeOfZones)
+{
+	Int i;
+	// The parent of a zone is below it, so it is already flattened.
+	for (i=1; i<sizeOfZones; i++) {
+		zoneParents[i] = zoneParents[zoneParents[i]];
+	}
+}
+
 inline void applyBlockZone(PathfindCell &targetCell, const PathfindCell &sourceCell,
 													 zoneStorageType *zoneEquivalency, Int firstZone, Int sizeOfZE)
 {
@@ -2200,7 +2240,9 @@ m_groundWaterZones(nullptr),
 m_groundRubbleZones(nullptr),
 m_crusherZones(nullptr),
 m_zonesAllocated(0),
-m_interactsWithBridge(FALSE)
+m_interactsWithBridge(FALSE),
+m_numCellZones(0),
+m_cellsInteractWithBridge(FALSE)
 {
 	m_cellOrigin.x = 0;
 	m_cellOrigin.y = 0;
@@ -2359,6 +2401,67 @@ zoneStorageType ZoneBlock::getEffectiveZone( LocomotorSurfaceTypeMask acceptable
 }
 
 
+/* Number the connected cells of the same type in the block 1, 2, 3... in the order the full map
+numbering used, so that adding the number of zones of the blocks before gives the same zones. Touches
+no other block, so the blocks can be numbered at the same time. */
+void ZoneBlock::labelCellZones(PathfindCell **map, const IRegion2D &bounds)
+{
+	enum {MAX_BLOCK_ZONES = PathfindZoneManager::ZONE_BLOCK_SIZE*PathfindZoneManager::ZONE_BLOCK_SIZE + 1};
+	zoneStorageType zoneEquivalency[MAX_BLOCK_ZONES];
+	zoneStorageType collapsedZones[MAX_BLOCK_ZONES];
+	Int maxZone = 1;	// we start using zone 0 as a flag.
+	Int i, j;
+	for (i=0; i<MAX_BLOCK_ZONES; i++) {
+		zoneEquivalency[i] = i;
+	}
+
+	m_cellsInteractWithBridge = false;
+	for( j=bounds.lo.y; j<=bounds.hi.y; j++ )	{
+		for( i=bounds.lo.x; i<=bounds.hi.x; i++ )	{
+			PathfindCell *cell = &map[i][j];
+			cell->setZone(0);
+
+			if (i>bounds.lo.x) {
+				if (map[i][j].getType() == map[i-1][j].getType()) {
+					applyZone(map[i][j], map[i-1][j], zoneEquivalency, maxZone);
+				}
+			}
+			if (j>bounds.lo.y) {
+				if (map[i][j].getType() == map[i][j-1].getType()) {
+					applyZone(map[i][j], map[i][j-1], zoneEquivalency, maxZone);
+				}
+			}
+			if (cell->getZone()==0) {
+				cell->setZone(maxZone);
+				maxZone++;
+			}
+			if (cell->getConnectLayer() > LAYER_GROUND) {
+				m_cellsInteractWithBridge = true;
+			}
+		}
+	}
+
+	// Collapse the zones into a 1,2,3... sequence, removing collapsed zones.
+	Int numZones = 0;
+	collapsedZones[0] = 0;
+	for (i=1; i<maxZone; i++) {
+		Int zone = zoneEquivalency[i];
+		if (zone == i) {
+			collapsedZones[i] = ++numZones;
+		}	else {
+			collapsedZones[i] = collapsedZones[zone];
+		}
+	}
+
+	for( j=bounds.lo.y; j<=bounds.hi.y; j++ )	{
+		for( i=bounds.lo.x; i<=bounds.hi.x; i++ )	{
+			map[i][j].setZone(collapsedZones[map[i][j].getZone()]);
+		}
+	}
+
+	m_numCellZones = numZones;
+}
+
 /* Allocate zone equivalency arrays large enough to hold m_maxZone entries.  If the arrays are already
 large enough, just return. */
 void ZoneBlock::allocateZones(void)
@@ -2397,6 +2500,7 @@ m_crusherZones(nullptr),
 m_hierarchicalZones(nullptr),
 m_blockOfZoneBlocks(nullptr),
 m_zoneBlocks(nullptr),
+m_blockZoneBases(nullptr),
 m_zonesAllocated(0)
 {
 	m_zoneBlockExtent.x = 0;
@@ -2440,6 +2544,9 @@ void PathfindZoneManager::freeBlocks()
 	delete [] m_zoneBlocks;
 	m_zoneBlocks = nullptr;
 
+	delete [] m_blockZoneBases;
+	m_blockZoneBases = nullptr;
+
 	m_zoneBlockExtent.x = 0;
 	m_zoneBlockExtent.y = 0;
 }
@@ -2479,6 +2586,7 @@ void PathfindZoneManager::allocateBlocks(const IRegion2D &globalBounds)
 
 	m_blockOfZoneBlocks = MSGNEW("PathfindZoneBlocks") ZoneBlock[(m_zoneBlockExtent.x)*(m_zoneBlockExtent.y)];
 	m_zoneBlocks = MSGNEW("PathfindZoneBlocks") ZoneBlockP[m_zoneBlockExtent.x];
+	m_blockZoneBases = MSGNEW("PathfindZoneBlocks") zoneStorageType[(m_zoneBlockExtent.x)*(m_zoneBlockExtent.y)];
 	Int i;
 	for (i=0; i<m_zoneBlockExtent.x; i++) {
 		m_zoneBlocks[i] = &m_blockOfZoneBlocks[i*(m_zoneBlockExtent.y)];
@@ -2503,6 +2611,58 @@ void PathfindZoneManager::reset(void)  ///< Called when the map is reset.
  * If you are a multiple terrain vehicle, like amphibious transport, the lookup is a little more
  * complicated.
  */
+struct ZoneJobData
+{
+	PathfindCell **map;
+	PathfindLayer *layers;
+	IRegion2D globalBounds;
+	ICoord2D blockExtent;
+	ZoneBlock *blocks;
+	zoneStorageType *zoneBases;
+};
+
+static void getZoneBlockBounds(const IRegion2D &globalBounds, Int xBlock, Int yBlock, IRegion2D &bounds)
+{
+	bounds.lo.x = globalBounds.lo.x + xBlock*PathfindZoneManager::ZONE_BLOCK_SIZE;
+	bounds.lo.y = globalBounds.lo.y + yBlock*PathfindZoneManager::ZONE_BLOCK_SIZE;
+	bounds.hi.x = bounds.lo.x + PathfindZoneManager::ZONE_BLOCK_SIZE - 1; // bounds are inclusive.
+	bounds.hi.y = bounds.lo.y + PathfindZoneManager::ZONE_BLOCK_SIZE - 1; // bounds are inclusive.
+	if (bounds.hi.x > globalBounds.hi.x) {
+		bounds.hi.x = globalBounds.hi.x;
+	}
+	if (bounds.hi.y > globalBounds.hi.y) {
+		bounds.hi.y = globalBounds.hi.y;
+	}
+}
+
+/* Numbers the cells of a block. Runs on a worker thread, so only touches the block and its cells. */
+static void labelBlockJob( void *userData, Int index )
+{
+	ZoneJobData *data = static_cast<ZoneJobData *>(userData);
+	IRegion2D bounds;
+	getZoneBlockBounds(data->globalBounds, index/data->blockExtent.y, index%data->blockExtent.y, bounds);
+	data->blocks[index].labelCellZones(data->map, bounds);
+}
+
+/* Moves the cells of a block to the zone base of the block, and calculates the block equivalencies.
+Runs on a worker thread, so only touches the block and its cells. */
+static void finishBlockJob( void *userData, Int index )
+{
+	ZoneJobData *data = static_cast<ZoneJobData *>(userData);
+	IRegion2D bounds;
+	getZoneBlockBounds(data->globalBounds, index/data->blockExtent.y, index%data->blockExtent.y, bounds);
+
+	const Int zoneBase = data->zoneBases[index];
+	Int i, j;
+	for( j=bounds.lo.y; j<=bounds.hi.y; j++ )	{
+		for( i=bounds.lo.x; i<=bounds.hi.x; i++ )	{
+			PathfindCell &cell = data->map[i][j];
+			cell.setZone(cell.getZone() + zoneBase);
+		}
+	}
+	data->blocks[index].blockCalculateZones(data->map, data->layers, bounds);
+}
+
 void PathfindZoneManager::calculateZones( PathfindCell **map, PathfindLayer layers[], const IRegion2D &globalBounds )
 {
 #ifdef DEBUG_QPF
@@ -2515,89 +2675,41 @@ void PathfindZoneManager::calculateZones( PathfindCell **map, PathfindLayer laye
 #endif
 #endif
 
-	m_maxZone = 1;	// we start using zone 0 as a flag.
-	const Int maxZones=24000;
-	zoneStorageType zoneEquivalency[maxZones];
+	// TheSuperHackers @performance The cells of each block are numbered on their own, on the worker threads.
+	// The numbering never joins cells of different blocks, so the zones of a block are the zones the full map
+	// numbering gave it, minus the number of zones of the blocks before.
 	Int i, j;
-	for (i=0; i<maxZones; i++) {
-		zoneEquivalency[i] = i;
-	}
 	for (i=0; i<=LAYER_LAST; i++) {
 		layers[i].setZone(0);
 	}
 
-	Int xCount = (globalBounds.hi.x-globalBounds.lo.x+1+ZONE_BLOCK_SIZE-1)/ZONE_BLOCK_SIZE;
-	Int yCount = (globalBounds.hi.y-globalBounds.lo.y+1+ZONE_BLOCK_SIZE-1)/ZONE_BLOCK_SIZE;
-
-	Int xBlock, yBlock;
-	for (xBlock = 0; xBlock<xCount; xBlock++) {
-		for (yBlock=0; yBlock<yCount; yBlock++) {
-			IRegion2D bounds;
-			bounds.lo.x = globalBounds.lo.x + xBlock*ZONE_BLOCK_SIZE;
-			bounds.lo.y = globalBounds.lo.y + yBlock*ZONE_BLOCK_SIZE;
-			bounds.hi.x = bounds.lo.x + ZONE_BLOCK_SIZE - 1; // bounds are inclusive.
-			bounds.hi.y = bounds.lo.y + ZONE_BLOCK_SIZE - 1; // bounds are inclusive.
-			if (bounds.hi.x > globalBounds.hi.x) {
-				bounds.hi.x = globalBounds.hi.x;
-			}
-			if (bounds.hi.y > globalBounds.hi.y) {
-				bounds.hi.y = globalBounds.hi.y;
-			}
-			if (bounds.lo.x>bounds.hi.x || bounds.lo.y>bounds.hi.y) {
-				DEBUG_CRASH(("Incorrect bounds calculation. Logic error, fix me. jba."));
-				continue;
-			}
-			m_zoneBlocks[xBlock][yBlock].setInteractsWithBridge(false);
-			for( j=bounds.lo.y; j<=bounds.hi.y; j++ )	{
-				for( i=bounds.lo.x; i<=bounds.hi.x; i++ )	{
-					PathfindCell *cell = &map[i][j];
-					cell->setZone(0);
+	DEBUG_ASSERTCRASH(m_zoneBlockExtent.x == (globalBounds.hi.x-globalBounds.lo.x+1+ZONE_BLOCK_SIZE-1)/ZONE_BLOCK_SIZE &&
+		m_zoneBlockExtent.y == (globalBounds.hi.y-globalBounds.lo.y+1+ZONE_BLOCK_SIZE-1)/ZONE_BLOCK_SIZE, ("Inconsistent allocation - SERIOUS ERROR. jba"));
 
-					if (i>bounds.lo.x) {
-						if (map[i][j].getType() == map[i-1][j].getType()) {
-							applyZone(map[i][j], map[i-1][j], zoneEquivalency, m_maxZone);
-						}
-					}
-					if (j>bounds.lo.y) {
-						if (map[i][j].getType() == map[i][j-1].getType()) {
-							applyZone(map[i][j], map[i][j-1], zoneEquivalency, m_maxZone);
-						}
-					}
-					if (cell->getZone()==0) {
-						cell->setZone(m_maxZone);
-						m_maxZone++;
-						if (m_maxZone>= maxZones) {
-							DEBUG_CRASH(("Ran out of pathfind zones.  SERIOUS ERROR! jba."));
-							break;
-						}
-					}
-					if (cell->getConnectLayer() > LAYER_GROUND) {
- 						m_zoneBlocks[xBlock][yBlock].setInteractsWithBridge(true);
-					}
+	ZoneJobData jobData;
+	jobData.map = map;
+	jobData.layers = layers;
+	jobData.globalBounds = globalBounds;
+	jobData.blockExtent = m_zoneBlockExtent;
+	jobData.blocks = m_blockOfZoneBlocks;
+	jobData.zoneBases = m_blockZoneBases;
 
-				}
-			}
- 		}
-	}
+	const Int blockCount = m_zoneBlockExtent.x*m_zoneBlockExtent.y;
+	WorkerThreadPool::parallelFor(labelBlockJob, &jobData, blockCount);
 
-	Int totalZones = m_maxZone;
-	if (totalZones>maxZones/2) {
-		DEBUG_LOG(("Max zones %d", m_maxZone));
+	// The zones of the blocks follow each other in the order the full map numbering visited the blocks.
+	Int totalZones = 1;	// we start using zone 0 as a flag.
+	for (i=0; i<blockCount; i++) {
+		ZoneBlock &block = m_blockOfZoneBlocks[i];
+		block.setInteractsWithBridge(block.getCellsInteractWithBridge());
+		m_blockZoneBases[i] = totalZones-1;
+		totalZones += block.getNumCellZones();
 	}
 
-	// Collapse the zones into a 1,2,3... sequence, removing collapsed zones.
-	m_maxZone = 1;
-	Int collapsedZones[maxZones];
-	collapsedZones[0] = 0;
-	for (i=1; i<totalZones; i++) {
-		Int zone = zoneEquivalency[i];
-		if (zone == i) {
-			collapsedZones[i] = m_maxZone;
-			++m_maxZone;
-		}	else {
-			collapsedZones[i] = collapsedZones[zone];
-		}
+	if (totalZones + LAYER_LAST + 1 > 0xffff) {
+		RELEASE_CRASH("Ran out of pathfind zones - fatal.");
 	}
+	m_maxZone = totalZones;
 #ifdef DEBUG_QPF
 #if defined(DEBUG_LOGGING)
 	QueryPerformanceCounter((LARGE_INTEGER *)&endTime64);
@@ -2605,25 +2717,10 @@ void PathfindZoneManager::calculateZones( PathfindCell **map, PathfindLayer laye
 	DEBUG_LOG(("Time to calculate first %f", timeToUpdate));
 #endif
 #endif
-	// Now map the zones in the map back into the collapsed zones.
-	for( j=globalBounds.lo.y; j<=globalBounds.hi.y; j++ )	{
-		for( i=globalBounds.lo.x; i<=globalBounds.hi.x; i++ )	{
-			map[i][j].setZone(collapsedZones[map[i][j].getZone()]);
-			if (map[i][j].getZone()==0) {
-				DEBUG_CRASH(("Zone not set cell %d, %d", i, j));
-			}
-		}
-	}
 	for (i=0; i<=LAYER_LAST; i++) {
-		Int zone = collapsedZones[layers[i].getZone()];
-		if (zone == 0) {
-			zone = m_maxZone;
-			m_maxZone++;
-		}
-		layers[i].setZone( zone );
-		if (!layers[i].isUnused() && !layers[i].isDestroyed() && layers[i].getZone()==0) {
-			DEBUG_CRASH(("Zone not set Layer %d", i));
-		}
+		// The layers follow the cells, one zone each.
+		layers[i].setZone( m_maxZone );
+		m_maxZone++;
 		layers[i].applyZone();
 		if (!layers[i].isUnused() && !layers[i].isDestroyed()) {
 			ICoord2D ndx;
@@ -2635,27 +2732,7 @@ void PathfindZoneManager::calculateZones( PathfindCell **map, PathfindLayer laye
 	}
 
 	allocateZones();
-	DEBUG_ASSERTCRASH(xBlock==m_zoneBlockExtent.x && yBlock==m_zoneBlockExtent.y, ("Inconsistent allocation - SERIOUS ERROR. jba"));
-	for (xBlock=0; xBlock<xCount; xBlock++) {
-		for (yBlock=0; yBlock<yCount; yBlock++) {
-			IRegion2D bounds;
-			bounds.lo.x = globalBounds.lo.x + xBlock*ZONE_BLOCK_SIZE;
-			bounds.lo.y = globalBounds.lo.y + yBlock*ZONE_BLOCK_SIZE;
-			bounds.hi.x = bounds.lo.x + ZONE_BLOCK_SIZE - 1; // bounds are inclusive.
-			bounds.hi.y = bounds.lo.y + ZONE_BLOCK_SIZE - 1; // bounds are inclusive.
-			if (bounds.hi.x > globalBounds.hi.x) {
-				bounds.hi.x = globalBounds.hi.x;
-			}
-			if (bounds.hi.y > globalBounds.hi.y) {
-				bounds.hi.y = globalBounds.hi.y;
-			}
-			if (bounds.lo.x>bounds.hi.x || bounds.lo.y>bounds.hi.y) {
-				DEBUG_CRASH(("Incorrect bounds calculation. Logic error, fix me. jba."));
-				continue;
-			}
-			m_zoneBlocks[xBlock][yBlock].blockCalculateZones(map, layers, bounds);
-		}
-	}
+	WorkerThreadPool::parallelFor(finishBlockJob, &jobData, blockCount);
 
 #ifdef DEBUG_QPF
 #if defined(DEBUG_LOGGING)
@@ -2680,14 +2757,14 @@ void PathfindZoneManager::calculateZones( PathfindCell **map, PathfindLayer laye
 			if ( (map[i][j].getConnectLayer() > LAYER_GROUND) &&
 				(map[i][j].getType() == PathfindCell::CELL_CLEAR) ) {
 				PathfindLayer *layer = layers + map[i][j].getConnectLayer();
-				resolveZones(map[i][j].getZone(), layer->getZone(), m_hierarchicalZones, m_maxZone);
+				unionZones(map[i][j].getZone(), layer->getZone(), m_hierarchicalZones);
 			}
 			if (i>globalBounds.lo.x && map[i][j].getZone()!=map[i-1][j].getZone()) {
 				if (map[i][j].getType() == map[i-1][j].getType()) {
-					applyZone(map[i][j], map[i-1][j], m_hierarchicalZones, m_maxZone);
+					unionCellZones(map[i][j], map[i-1][j], m_hierarchicalZones);
 				}
 				if (waterGround(map[i][j], map[i-1][j])) {
-					applyZone(map[i][j], map[i-1][j], m_groundWaterZones, m_maxZone);
+					unionCellZones(map[i][j], map[i-1][j], m_groundWaterZones);
 				}
 				if (groundRubble(map[i][j], map[i-1][j])) {
 					Int zone1 = map[i][j].getZone();
@@ -2695,24 +2772,24 @@ void PathfindZoneManager::calculateZones( PathfindCell **map, PathfindLayer laye
 					if (m_terrainZones[zone1] != m_terrainZones[zone2]) {
 						//DEBUG_LOG(("Matching terrain zone %d to %d.", zone1, zone2));
 					}
-					applyZone(map[i][j], map[i-1][j], m_groundRubbleZones, m_maxZone);
+					unionCellZones(map[i][j], map[i-1][j], m_groundRubbleZones);
 				}
 				if (groundCliff(map[i][j], map[i-1][j])) {
-					applyZone(map[i][j], map[i-1][j], m_groundCliffZones, m_maxZone);
+					unionCellZones(map[i][j], map[i-1][j], m_groundCliffZones);
 				}
 				if (terrain(map[i][j], map[i-1][j])) {
-					applyZone(map[i][j], map[i-1][j], m_terrainZones, m_maxZone);
+					unionCellZones(map[i][j], map[i-1][j], m_terrainZones);
 				}
 				if (crusherGround(map[i][j], map[i-1][j])) {
-					applyZone(map[i][j], map[i-1][j], m_crusherZones, m_maxZone);
+					unionCellZones(map[i][j], map[i-1][j], m_crusherZones);
 				}
 			}
 			if (j>globalBounds.lo.y && map[i][j].getZone()!=map[i][j-1].getZone()) {
 				if (map[i][j].getType() == map[i][j-1].getType()) {
-					applyZone(map[i][j], map[i][j-1], m_hierarchicalZones, m_maxZone);
+					unionCellZones(map[i][j], map[i][j-1], m_hierarchicalZones);
 				}
 				if (waterGround(map[i][j],map[i][j-1])) {
-					applyZone(map[i][j], map[i][j-1], m_groundWaterZones, m_maxZone);
+					unionCellZones(map[i][j], map[i][j-1], m_groundWaterZones);
 				}
 				if (groundRubble(map[i][j], map[i][j-1])) {
 					Int zone1 = map[i][j].getZone();
@@ -2720,16 +2797,16 @@ void PathfindZoneManager::calculateZones( PathfindCell **map, PathfindLayer laye
 					if (m_terrainZones[zone1] != m_terrainZones[zone2]) {
 						//DEBUG_LOG(("Matching terrain zone %d to %d.", zone1, zone2));
 					}
-					applyZone(map[i][j], map[i][j-1], m_groundRubbleZones, m_maxZone);
+					unionCellZones(map[i][j], map[i][j-1], m_groundRubbleZones);
 				}
 				if (groundCliff(map[i][j],map[i][j-1])) {
-					applyZone(map[i][j], map[i][j-1], m_groundCliffZones, m_maxZone);
+					unionCellZones(map[i][j], map[i][j-1], m_groundCliffZones);
 				}
 				if (terrain(map[i][j], map[i][j-1])) {
-					applyZone(map[i][j], map[i][j-1], m_terrainZones, m_maxZone);
+					unionCellZones(map[i][j], map[i][j-1], m_terrainZones);
 				}
 				if (crusherGround(map[i][j], map[i][j-1])) {
-					applyZone(map[i][j], map[i][j-1], m_crusherZones, m_maxZone);
+					unionCellZones(map[i][j], map[i][j-1], m_crusherZones);
 				}
 			}
 			DEBUG_ASSERTCRASH(map[i][j].getZone() != 0, ("Cleared the zone."));
@@ -2739,11 +2816,12 @@ void PathfindZoneManager::calculateZones( PathfindCell **map, PathfindLayer laye
 	if (m_maxZone >= m_zonesAllocated) {
 		RELEASE_CRASH("Pathfind allocation error - fatal. see jba.");
 	}
-	for (i=1; i<m_maxZone; i++) {
-		// Flatten hierarchical zones.
-		Int zone = m_hierarchicalZones[i];
-		m_hierarchicalZones[i] = m_hierarchicalZones[zone];
-	}
+	flattenRootZones(m_hierarchicalZones, m_maxZone);
+	flattenRootZones(m_groundCliffZones, m_maxZone);
+	flattenRootZones(m_groundWaterZones, m_maxZone);
+	flattenRootZones(m_groundRubbleZones, m_maxZone);
+	flattenRootZones(m_terrainZones, m_maxZone);
+	flattenRootZones(m_crusherZones, m_maxZone);
 	flattenZones(m_groundCliffZones, m_hierarchicalZones, m_maxZone);
 	flattenZones(m_groundWaterZones, m_hierarchicalZones, m_maxZone);
 	flattenZones(m_groundRubbleZones, m_hierarchicalZones, m_maxZone);
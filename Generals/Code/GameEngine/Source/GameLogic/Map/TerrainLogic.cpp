@@ -1448,6 +1448,31 @@ Real TerrainLogic::getLayerHeight( Real x, Real y, PathfindLayerEnum layer, Coor
 
 }
 
+//-------------------------------------------------------------------------------------------------
+/** default get heights for terrain logic */
+//-------------------------------------------------------------------------------------------------
+void TerrainLogic::getGroundHeights( const Coord2D *points, Real *heights, Int count ) const
+{
+	for (Int i = 0; i < count; ++i)
+		heights[i] = getGroundHeight(points[i].x, points[i].y);
+}
+
+//-------------------------------------------------------------------------------------------------
+/** default raw map height for terrain logic */
+//-------------------------------------------------------------------------------------------------
+Int TerrainLogic::getRawMapHeight( const ICoord2D *gridPos ) const
+{
+	return TheTerrainVisual->getRawMapHeight(gridPos);
+}
+
+//-------------------------------------------------------------------------------------------------
+/** default set raw map height for terrain logic */
+//-------------------------------------------------------------------------------------------------
+void TerrainLogic::setRawMapHeight( const ICoord2D *gridPos, Int height )
+{
+	TheTerrainVisual->setRawMapHeight(gridPos, height);
+}
+
 //-------------------------------------------------------------------------------------------------
 /** default isCliffCell for terrain logic */
 //-------------------------------------------------------------------------------------------------
@@ -2728,33 +2753,33 @@ void TerrainLogic::flattenTerrain(Object *obj)
 						ICoord2D gridPos;
 						gridPos.x = i;
 						gridPos.y = j;
-						TheTerrainVisual->setRawMapHeight(&gridPos, rawDataHeight);
+						setRawMapHeight(&gridPos, rawDataHeight);
 						gridPos.x = i-1;
 						gridPos.y = j;
-						TheTerrainVisual->setRawMapHeight(&gridPos, rawDataHeight);
+						setRawMapHeight(&gridPos, rawDataHeight);
 						gridPos.x = i+1;
 						gridPos.y = j;
-						TheTerrainVisual->setRawMapHeight(&gridPos, rawDataHeight);
+						setRawMapHeight(&gridPos, rawDataHeight);
 						gridPos.x = i;
 						gridPos.y = j-1;
-						TheTerrainVisual->setRawMapHeight(&gridPos, rawDataHeight);
+						setRawMapHeight(&gridPos, rawDataHeight);
 						gridPos.x = i;
 						gridPos.y = j+1;
-						TheTerrainVisual->setRawMapHeight(&gridPos, rawDataHeight);
+						setRawMapHeight(&gridPos, rawDataHeight);
 
 						//Added the corners so it does a whole 3X3 square... ML
 						gridPos.x = i-1;
 						gridPos.y = j-1;
-						TheTerrainVisual->setRawMapHeight(&gridPos, rawDataHeight);
+						setRawMapHeight(&gridPos, rawDataHeight);
 						gridPos.x = i+1;
 						gridPos.y = j+1;
-						TheTerrainVisual->setRawMapHeight(&gridPos, rawDataHeight);
+						setRawMapHeight(&gridPos, rawDataHeight);
 						gridPos.x = i+1;
 						gridPos.y = j-1;
-						TheTerrainVisual->setRawMapHeight(&gridPos, rawDataHeight);
+						setRawMapHeight(&gridPos, rawDataHeight);
 						gridPos.x = i-1;
 						gridPos.y = j+1;
-						TheTerrainVisual->setRawMapHeight(&gridPos, rawDataHeight);
+						setRawMapHeight(&gridPos, rawDataHeight);
 
 					}
 				}
@@ -2809,33 +2834,33 @@ void TerrainLogic::flattenTerrain(Object *obj)
 						ICoord2D gridPos;
 						gridPos.x = i;
 						gridPos.y = j;
-						TheTerrainVisual->setRawMapHeight(&gridPos, rawDataHeight);
+						setRawMapHeight(&gridPos, rawDataHeight);
 						gridPos.x = i-1;
 						gridPos.y = j;
-						TheTerrainVisual->setRawMapHeight(&gridPos, rawDataHeight);
+						setRawMapHeight(&gridPos, rawDataHeight);
 						gridPos.x = i+1;
 						gridPos.y = j;
-						TheTerrainVisual->setRawMapHeight(&gridPos, rawDataHeight);
+						setRawMapHeight(&gridPos, rawDataHeight);
 						gridPos.x = i;
 						gridPos.y = j-1;
-						TheTerrainVisual->setRawMapHeight(&gridPos, rawDataHeight);
+						setRawMapHeight(&gridPos, rawDataHeight);
 						gridPos.x = i;
 						gridPos.y = j+1;
-						TheTerrainVisual->setRawMapHeight(&gridPos, rawDataHeight);
+						setRawMapHeight(&gridPos, rawDataHeight);
 
 						//Added the corners so it does a whole 3X3 square... ML
 						gridPos.x = i-1;
 						gridPos.y = j-1;
-						TheTerrainVisual->setRawMapHeight(&gridPos, rawDataHeight);
+						setRawMapHeight(&gridPos, rawDataHeight);
 						gridPos.x = i+1;
 						gridPos.y = j+1;
-						TheTerrainVisual->setRawMapHeight(&gridPos, rawDataHeight);
+						setRawMapHeight(&gridPos, rawDataHeight);
 						gridPos.x = i+1;
 						gridPos.y = j-1;
-						TheTerrainVisual->setRawMapHeight(&gridPos, rawDataHeight);
+						setRawMapHeight(&gridPos, rawDataHeight);
 						gridPos.x = i-1;
 						gridPos.y = j+1;
-						TheTerrainVisual->setRawMapHeight(&gridPos, rawDataHeight);
+						setRawMapHeight(&gridPos, rawDataHeight);
 
 
 					}
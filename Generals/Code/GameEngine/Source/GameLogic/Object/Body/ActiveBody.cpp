@@ -466,24 +466,20 @@ void ActiveBody::attemptDamage( DamageInfo *damageInfo )
 		// if our health has gone down then do run the damage module callback
 		if( m_currentHealth < m_prevHealth )
 		{
-			for (BehaviorModule** m = obj->getBehaviorModules(); *m; ++m)
+			const Int damageCount = obj->getDispatchModuleCount(MODULEDISPATCH_DAMAGE);
+			for (Int i = 0; i < damageCount; ++i)
 			{
-				DamageModuleInterface* d = (*m)->getDamage();
-				if (!d)
-					continue;
-
+				DamageModuleInterface* d = obj->getDispatchModule(MODULEDISPATCH_DAMAGE, i)->getDamage();
 				d->onDamage( damageInfo );
 			}
 		}
 
 		if (m_curDamageState != oldState)
 		{
-			for (BehaviorModule** m = obj->getBehaviorModules(); *m; ++m)
+			const Int damageCount = obj->getDispatchModuleCount(MODULEDISPATCH_DAMAGE);
+			for (Int i = 0; i < damageCount; ++i)
 			{
-				DamageModuleInterface* d = (*m)->getDamage();
-				if (!d)
-					continue;
-
+				DamageModuleInterface* d = obj->getDispatchModule(MODULEDISPATCH_DAMAGE, i)->getDamage();
 				d->onBodyDamageStateChange( damageInfo, oldState, m_curDamageState );
 			}
 
@@ -601,24 +597,20 @@ void ActiveBody::attemptHealing( DamageInfo *damageInfo )
 		// if our health has gone UP then do run the damage module callback
 		if( m_currentHealth > m_prevHealth )
 		{
-			for (BehaviorModule** m = obj->getBehaviorModules(); *m; ++m)
+			const Int damageCount = obj->getDispatchModuleCount(MODULEDISPATCH_DAMAGE);
+			for (Int i = 0; i < damageCount; ++i)
 			{
-				DamageModuleInterface* d = (*m)->getDamage();
-				if (!d)
-					continue;
-
+				DamageModuleInterface* d = obj->getDispatchModule(MODULEDISPATCH_DAMAGE, i)->getDamage();
 				d->onHealing( damageInfo );
 			}
 		}
 
 		if (m_curDamageState != oldState)
 		{
-			for (BehaviorModule** m = obj->getBehaviorModules(); *m; ++m)
+			const Int damageCount = obj->getDispatchModuleCount(MODULEDISPATCH_DAMAGE);
+			for (Int i = 0; i < damageCount; ++i)
 			{
-				DamageModuleInterface* d = (*m)->getDamage();
-				if (!d)
-					continue;
-
+				DamageModuleInterface* d = obj->getDispatchModule(MODULEDISPATCH_DAMAGE, i)->getDamage();
 				d->onBodyDamageStateChange( damageInfo, oldState, m_curDamageState );
 			}
 		}
@@ -175,6 +175,8 @@ Object::Object( const ThingTemplate *tt, const ObjectStatusMaskType &objectStatu
 	m_xferContainedByID(INVALID_ID),
 	m_containedByFrame(0),
 	m_behaviors(nullptr),
+	m_moduleDispatch(nullptr),
+	m_firstTemplateModule(0),
 	m_body(nullptr),
 	m_contain(nullptr),
 	m_stealth(nullptr),
@@ -332,6 +334,8 @@ Object::Object( const ThingTemplate *tt, const ObjectStatusMaskType &objectStatu
 		*curB++ = m_firingTracker;
 	}
 
+	m_firstTemplateModule = (Short)(curB - m_behaviors);
+
 	// behaviors are always done first, so they get into the publicModule arrays
 	// before anything else.
 	const ModuleInfo& mi = tt->getBehaviorModuleInfo();
@@ -382,6 +386,11 @@ Object::Object( const ThingTemplate *tt, const ObjectStatusMaskType &objectStatu
 
 	*curB = nullptr;
 
+	m_moduleDispatch = &mi.getDispatch(m_behaviors + m_firstTemplateModule);
+#ifdef DEBUG_CRASHING
+	validateModuleDispatch();
+#endif
+
 	AIUpdateInterface *ai = getAIUpdateInterface();
 	if (ai) {
 		ai->setAttitude(getTeam()->getPrototype()->getTemplateInfo()->m_initialTeamAttitude);
@@ -476,11 +485,10 @@ void Object::initObject()
 
 	//For each special power module that we have, add it's type to the specialpower bits. This is
 	//for optimal access later.
-	for (BehaviorModule** m = m_behaviors; *m; ++m)
+	const Int specialPowerCount = getDispatchModuleCount(MODULEDISPATCH_SPECIAL_POWER);
+	for (Int i = 0; i < specialPowerCount; ++i)
 	{
-		SpecialPowerModuleInterface* sp = (*m)->getSpecialPower();
-		if (!sp)
-			continue;
+		SpecialPowerModuleInterface* sp = getDispatchModule(MODULEDISPATCH_SPECIAL_POWER, i)->getSpecialPower();
 
 		const SpecialPowerTemplate *spTemplate = sp->getSpecialPowerTemplate();
 		if( spTemplate )
@@ -563,6 +571,9 @@ Object::~Object()
 	m_ai = nullptr;
 	m_physics = nullptr;
 
+	// the dispatch would still find the modules below after they were deleted
+	m_moduleDispatch = nullptr;
+
 	// delete any modules present
 	for (BehaviorModule** b = m_behaviors; *b; ++b)
 	{
@@ -2110,11 +2121,10 @@ void Object::checkDisabledStatus()
 //-------------------------------------------------------------------------------------------------
 void Object::pauseAllSpecialPowers( const Bool disabling ) const
 {
-	for (BehaviorModule** m = m_behaviors; *m; ++m)
+	const Int specialPowerCount = getDispatchModuleCount(MODULEDISPATCH_SPECIAL_POWER);
+	for (Int i = 0; i < specialPowerCount; ++i)
 	{
-		SpecialPowerModuleInterface* sp = (*m)->getSpecialPower();
-		if (!sp)
-			continue;
+		SpecialPowerModuleInterface* sp = getDispatchModule(MODULEDISPATCH_SPECIAL_POWER, i)->getSpecialPower();
 
 		sp->pauseCountdown( disabling );// So it will pause if we are disabling.
 	}
@@ -2144,11 +2154,10 @@ void Object::updateTriggerAreaFlags()
 //-------------------------------------------------------------------------------------------------
 void Object::onCollide( Object *other, const Coord3D *loc, const Coord3D *normal )
 {
-	for (BehaviorModule** m = m_behaviors; *m; ++m)
+	const Int collideCount = getDispatchModuleCount(MODULEDISPATCH_COLLIDE);
+	for (Int i = 0; i < collideCount; ++i)
 	{
-		CollideModuleInterface* collide = (*m)->getCollide();
-		if (!collide)
-			continue;
+		CollideModuleInterface* collide = getDispatchModule(MODULEDISPATCH_COLLIDE, i)->getCollide();
 
 		// check each time thru the loop, in case a collide module sets it
 		if( getStatusBits().test( OBJECT_STATUS_NO_COLLISIONS ) )
@@ -2168,10 +2177,11 @@ void Object::onCollide( Object *other, const Coord3D *loc, const Coord3D *normal
 //-------------------------------------------------------------------------------------------------
 Bool Object::isSalvageCrate() const
 {
-	for( BehaviorModule** m = m_behaviors; *m; ++m )
+	const Int collideCount = getDispatchModuleCount(MODULEDISPATCH_COLLIDE);
+	for( Int i = 0; i < collideCount; ++i )
 	{
-		CollideModuleInterface* collide = (*m)->getCollide();
-		if( collide && collide->isSalvageCrateCollide() )
+		CollideModuleInterface* collide = getDispatchModule(MODULEDISPATCH_COLLIDE, i)->getCollide();
+		if( collide->isSalvageCrateCollide() )
 		{
 			return true;
 		}
@@ -2192,11 +2202,10 @@ void Object::updateUpgradeModules()
 	// We need to add in all of the already owned upgrades to handle "AND" requiring upgrades.
 	// We combine all the masks in case someone has a Object AND Player combination
 
-	for (BehaviorModule** module = m_behaviors; *module; ++module)
+	const Int upgradeCount = getDispatchModuleCount(MODULEDISPATCH_UPGRADE);
+	for (Int i = 0; i < upgradeCount; ++i)
 	{
-		UpgradeModuleInterface* upgrade = (*module)->getUpgrade();
-		if (!upgrade)
-			continue;
+		UpgradeModuleInterface* upgrade = getDispatchModule(MODULEDISPATCH_UPGRADE, i)->getUpgrade();
 
 		if( !upgrade->isAlreadyUpgraded() )
 		{
@@ -2215,11 +2224,10 @@ void Object::updateUpgradeModules()
 //-------------------------------------------------------------------------------------------------
 void Object::forceRefreshSubObjectUpgradeStatus()
 {
-	for (BehaviorModule** module = m_behaviors; *module; ++module)
+	const Int upgradeCount = getDispatchModuleCount(MODULEDISPATCH_UPGRADE);
+	for (Int i = 0; i < upgradeCount; ++i)
 	{
-		UpgradeModuleInterface* upgrade = (*module)->getUpgrade();
-		if (!upgrade)
-			continue;
+		UpgradeModuleInterface* upgrade = getDispatchModule(MODULEDISPATCH_UPGRADE, i)->getUpgrade();
 
 		if( upgrade->isSubObjectsUpgrade() )
 		{
@@ -2603,9 +2611,104 @@ void Object::calcNaturalRallyPoint(Coord2D *pt)
 
 }
 
+//-------------------------------------------------------------------------------------------------
+Int Object::getDispatchModuleCount( ModuleDispatchType type ) const
+{
+	if (m_moduleDispatch == nullptr)
+		return 0;
+
+	return (Int)m_moduleDispatch->m_interfaceModules[type].size();
+}
+
+//-------------------------------------------------------------------------------------------------
+BehaviorModule* Object::getDispatchModule( ModuleDispatchType type, Int index ) const
+{
+	return m_behaviors[m_firstTemplateModule + m_moduleDispatch->m_interfaceModules[type][index]];
+}
+
+#ifdef DEBUG_CRASHING
+//-------------------------------------------------------------------------------------------------
+/** The dispatch is shared by all objects of the template, so make sure that it also describes the
+	* modules that were created for this one. */
+//-------------------------------------------------------------------------------------------------
+void Object::validateModuleDispatch() const
+{
+	Int moduleCount = 0;
+	while (m_behaviors[moduleCount])
+		++moduleCount;
+
+	DEBUG_ASSERTCRASH(m_firstTemplateModule + m_moduleDispatch->m_moduleCount <= moduleCount,
+		("Module dispatch of %s has more modules than the object", getTemplate()->getName().str()));
+
+	for (Int i = 0; i < moduleCount; ++i)
+	{
+		BehaviorModule* module = m_behaviors[i];
+		const Short templateModule = (Short)(i - m_firstTemplateModule);
+		const Bool isTemplateModule = templateModule >= 0 && templateModule < m_moduleDispatch->m_moduleCount;
+
+		const Bool hasInterface[MODULEDISPATCH_COUNT] =
+		{
+			module->getCollide() != nullptr,
+			module->getDamage() != nullptr,
+			module->getDie() != nullptr,
+			module->getSpecialPower() != nullptr,
+			module->getUpgrade() != nullptr,
+		};
+
+		for (Int type = 0; type < MODULEDISPATCH_COUNT; ++type)
+		{
+			const std::vector<Short>& modules = m_moduleDispatch->m_interfaceModules[type];
+			const Bool inDispatch = isTemplateModule && std::find(modules.begin(), modules.end(), templateModule) != modules.end();
+			DEBUG_ASSERTCRASH(hasInterface[type] == inDispatch,
+				("Module dispatch of %s is wrong for interface %d of module %d", getTemplate()->getName().str(), type, i));
+		}
+
+		// a search in module order finds the first module of a name
+		const NameKeyType nameKey = module->getModuleNameKey();
+		Int first = 0;
+		while (m_behaviors[first]->getModuleNameKey() != nameKey)
+			++first;
+
+		DEBUG_ASSERTCRASH(findModule(nameKey) == m_behaviors[first],
+			("Module dispatch of %s does not find module %d by name", getTemplate()->getName().str(), i));
+	}
+}
+#endif
+
+//-------------------------------------------------------------------------------------------------
+/** The template modules are found by name through the dispatch. The helper modules in front of
+	* them are not in there, but no template module can have the name of a helper. */
 //-------------------------------------------------------------------------------------------------
 Module* Object::findModule(NameKeyType key) const
 {
+#ifndef INTENSE_DEBUG
+	if (m_moduleDispatch != nullptr)
+	{
+		const std::vector<ModuleDispatch::NameKeyModule>& nameKeyModules = m_moduleDispatch->m_nameKeyModules;
+		Int lo = 0;
+		Int hi = (Int)nameKeyModules.size();
+		while (lo < hi)
+		{
+			const Int mid = (lo + hi) / 2;
+			if (nameKeyModules[mid].nameKey < key)
+				lo = mid + 1;
+			else
+				hi = mid;
+		}
+
+		if (lo < (Int)nameKeyModules.size() && nameKeyModules[lo].nameKey == key)
+			return m_behaviors[m_firstTemplateModule + nameKeyModules[lo].module];
+
+		for (Int i = 0; i < m_firstTemplateModule; ++i)
+		{
+			if (m_behaviors[i]->getModuleNameKey() == key)
+				return m_behaviors[i];
+		}
+
+		return nullptr;
+	}
+#endif
+
 	Module* m = nullptr;
 
 	for (BehaviorModule** b = m_behaviors; *b; ++b)
@@ -3982,11 +4085,10 @@ Bool Object::affectedByUpgrade( const UpgradeTemplate *upgradeT ) const
 	// We need to add in all of the already owned upgrades to handle "AND" requiring upgrades.
 	// We combine all the masks in case someone has a Object AND Player combination
 
-	for (BehaviorModule** module = m_behaviors; *module; ++module)
+	const Int upgradeCount = getDispatchModuleCount(MODULEDISPATCH_UPGRADE);
+	for (Int i = 0; i < upgradeCount; ++i)
 	{
-		UpgradeModuleInterface* upgrade = (*module)->getUpgrade();
-		if (!upgrade)
-			continue;
+		UpgradeModuleInterface* upgrade = getDispatchModule(MODULEDISPATCH_UPGRADE, i)->getUpgrade();
 
 		if( upgrade->wouldUpgrade( maskToCheck ) )
 		{
@@ -4021,11 +4123,10 @@ void Object::giveUpgrade( const UpgradeTemplate *upgradeT )
 void Object::removeUpgrade( const UpgradeTemplate *upgradeT )
 {
 	m_objectUpgradesCompleted.clear( upgradeT->getUpgradeMask() );
-	for (BehaviorModule** module = m_behaviors; *module; ++module)
+	const Int upgradeCount = getDispatchModuleCount(MODULEDISPATCH_UPGRADE);
+	for (Int i = 0; i < upgradeCount; ++i)
 	{
-		UpgradeModuleInterface* upgrade = (*module)->getUpgrade();
-		if (!upgrade)
-			continue;
+		UpgradeModuleInterface* upgrade = getDispatchModule(MODULEDISPATCH_UPGRADE, i)->getUpgrade();
 
 		// Whoa, please note that while the function is called Object::RemoveUpgrade, it is not removing anything
 		// in the sense of undoing the effects.  It is just resetting the upgrade so it may be run again.
@@ -4105,11 +4206,11 @@ void Object::onDie( DamageInfo *damageInfo )
 	Bool selfInflicted = (damageInfo->in.m_sourceID == getID());
 
 	// FIRST, call our die modules.
-	for (BehaviorModule** d = m_behaviors; *d; ++d)
+	const Int dieCount = getDispatchModuleCount(MODULEDISPATCH_DIE);
+	for (Int i = 0; i < dieCount; ++i)
 	{
-		DieModuleInterface* die = (*d)->getDie();
-		if (die)
-			die->onDie(damageInfo);
+		DieModuleInterface* die = getDispatchModule(MODULEDISPATCH_DIE, i)->getDie();
+		die->onDie(damageInfo);
 	}
 
 	// When objects die we remove from the radar as they're really not interesting anymore
@@ -4698,11 +4799,10 @@ SpecialPowerModuleInterface *Object::getSpecialPowerModule( const SpecialPowerTe
 		return nullptr;
 
 	// search the modules for the one with the matching template
-	for (BehaviorModule** m = m_behaviors; *m; ++m)
+	const Int specialPowerCount = getDispatchModuleCount(MODULEDISPATCH_SPECIAL_POWER);
+	for (Int i = 0; i < specialPowerCount; ++i)
 	{
-		SpecialPowerModuleInterface* sp = (*m)->getSpecialPower();
-		if (!sp)
-			continue;
+		SpecialPowerModuleInterface* sp = getDispatchModule(MODULEDISPATCH_SPECIAL_POWER, i)->getSpecialPower();
 
 		if( sp->isModuleForPower( specialPowerTemplate ) )
 			return sp;
@@ -5107,11 +5207,10 @@ DockUpdateInterface *Object::getDockUpdateInterface( void )
 // ------------------------------------------------------------------------------------------------
 SpecialPowerModuleInterface* Object::findSpecialPowerModuleInterface( SpecialPowerType type ) const
 {
-	for (BehaviorModule** m = m_behaviors; *m; ++m)
+	const Int specialPowerCount = getDispatchModuleCount(MODULEDISPATCH_SPECIAL_POWER);
+	for (Int i = 0; i < specialPowerCount; ++i)
 	{
-		SpecialPowerModuleInterface* sp = (*m)->getSpecialPower();
-		if (!sp)
-			continue;
+		SpecialPowerModuleInterface* sp = getDispatchModule(MODULEDISPATCH_SPECIAL_POWER, i)->getSpecialPower();
 
 		const SpecialPowerTemplate *spTemplate = sp->getSpecialPowerTemplate();
 		if (spTemplate && spTemplate->getSpecialPowerType() == type)
@@ -5127,11 +5226,10 @@ SpecialPowerModuleInterface* Object::findSpecialPowerModuleInterface( SpecialPow
 // ------------------------------------------------------------------------------------------------
 SpecialPowerModuleInterface* Object::findAnyShortcutSpecialPowerModuleInterface() const
 {
-	for( BehaviorModule** m = m_behaviors; *m; ++m )
+	const Int specialPowerCount = getDispatchModuleCount(MODULEDISPATCH_SPECIAL_POWER);
+	for( Int i = 0; i < specialPowerCount; ++i )
 	{
-		SpecialPowerModuleInterface* sp = (*m)->getSpecialPower();
-		if (!sp)
-			continue;
+		SpecialPowerModuleInterface* sp = getDispatchModule(MODULEDISPATCH_SPECIAL_POWER, i)->getSpecialPower();
 
 		const SpecialPowerTemplate *spTemplate = sp->getSpecialPowerTemplate();
 		if( spTemplate && spTemplate->isShortcutPower() )
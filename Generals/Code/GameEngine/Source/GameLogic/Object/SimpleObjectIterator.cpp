@@ -29,6 +29,8 @@
 
 #include "GameLogic/ObjectIter.h"
 
+#include <algorithm>
+
 #include "Common/ThingTemplate.h"
 #include "GameLogic/Object.h"
 
@@ -271,3 +273,98 @@ Real SimpleObjectIterator::sortExpensiveToCheap(Clump *a, Clump *b)
 				 a->m_obj->getTemplate()->friend_getBuildCost();
 }
 
+//=============================================================================
+ObjectQueryResults::ObjectQueryResults()
+{
+	m_entries = m_inline;
+	m_count = 0;
+	m_capacity = INLINE_COUNT;
+	m_cur = 0;
+}
+
+//=============================================================================
+ObjectQueryResults::~ObjectQueryResults()
+{
+	if (m_entries != m_inline)
+		TheDynamicMemoryAllocator->freeBytes(m_entries);
+}
+
+//=============================================================================
+void ObjectQueryResults::grow()
+{
+	const Int newCapacity = m_capacity * 2;
+	Entry *newEntries = (Entry *)TheDynamicMemoryAllocator->allocateBytesDoNotZero(newCapacity * sizeof(Entry), "ObjectQueryResults");
+	memcpy(newEntries, m_entries, m_count * sizeof(Entry));
+
+	if (m_entries != m_inline)
+		TheDynamicMemoryAllocator->freeBytes(m_entries);
+
+	m_entries = newEntries;
+	m_capacity = newCapacity;
+}
+
+//=============================================================================
+void ObjectQueryResults::reverse()
+{
+	std::reverse(m_entries, m_entries + m_count);
+	m_cur = 0;
+}
+
+//-----------------------------------------------------------------------------
+Bool ObjectQueryResults::sortKeyLess(const SortKey &a, const SortKey &b)
+{
+	if (a.key != b.key)
+		return a.key < b.key;
+	return a.index < b.index;
+}
+
+//=============================================================================
+/**
+	Sorts a compact array of keys and moves the objects only once. The index breaks ties, which
+	gives the same order as the stable merge sort of SimpleObjectIterator.
+*/
+void ObjectQueryResults::sort(IterOrderType order)
+{
+	m_cur = 0;
+
+	if (order == ITER_FASTEST || m_count < 2)
+		return;
+
+	SortKey inlineKeys[INLINE_COUNT];
+	Entry inlineSorted[INLINE_COUNT];
+	SortKey *keys = inlineKeys;
+	Entry *sorted = inlineSorted;
+	if (m_count > INLINE_COUNT)
+	{
+		keys = (SortKey *)TheDynamicMemoryAllocator->allocateBytesDoNotZero(m_count * sizeof(SortKey), "ObjectQueryResults::sort");
+		sorted = (Entry *)TheDynamicMemoryAllocator->allocateBytesDoNotZero(m_count * sizeof(Entry), "ObjectQueryResults::sort");
+	}
+
+	Int i;
+	for (i = 0; i < m_count; ++i)
+	{
+		Real key;
+		switch (order)
+		{
+			case ITER_SORTED_NEAR_TO_FAR:					key = m_entries[i].numeric; break;
+			case ITER_SORTED_FAR_TO_NEAR:					key = -m_entries[i].numeric; break;
+			case ITER_SORTED_CHEAP_TO_EXPENSIVE:	key = (Real)m_entries[i].obj->getTemplate()->friend_getBuildCost(); break;
+			case ITER_SORTED_EXPENSIVE_TO_CHEAP:	key = -(Real)m_entries[i].obj->getTemplate()->friend_getBuildCost(); break;
+			default:															key = 0.0f; break;
+		}
+		keys[i].key = key;
+		keys[i].index = i;
+	}
+
+	std::sort(keys, keys + m_count, sortKeyLess);
+
+	for (i = 0; i < m_count; ++i)
+		sorted[i] = m_entries[keys[i].index];
+	memcpy(m_entries, sorted, m_count * sizeof(Entry));
+
+	if (keys != inlineKeys)
+	{
+		TheDynamicMemoryAllocator->freeBytes(keys);
+		TheDynamicMemoryAllocator->freeBytes(sorted);
+	}
+}
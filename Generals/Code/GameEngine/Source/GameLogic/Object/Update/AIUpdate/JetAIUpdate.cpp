@@ -141,6 +141,8 @@ protected:
 			return true;
 		return false;
 	}
+	// reserves the parking space it finds
+	virtual Bool hasSideEffects() const { return TRUE; }
 };
 
 //-------------------------------------------------------------------------------------------------
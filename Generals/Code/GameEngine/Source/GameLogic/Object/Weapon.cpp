@@ -1271,7 +1271,9 @@ void WeaponTemplate::dealDamageInternal(ObjectID sourceID, ObjectID victimID, co
 	DeathType deathType = getDeathType();
 	if (getProjectileTemplate() == nullptr || isProjectileDetonation)
 	{
-		SimpleObjectIterator *iter;
+		// TheSuperHackers @performance The victims are collected in place, without allocating an iterator
+		ObjectQueryResults victims;
+		ObjectQueryResults *iter;
 		Object *curVictim;
 		Real curVictimDistSqr;
 
@@ -1287,7 +1289,8 @@ void WeaponTemplate::dealDamageInternal(ObjectID sourceID, ObjectID victimID, co
 		Real radius = max(primaryRadius, secondaryRadius);
 		if (radius > 0.0f)
 		{
-			iter = ThePartitionManager->iterateObjectsInRange(pos, radius, DAMAGE_RANGE_CALC_TYPE);
+			ThePartitionManager->queryObjectsInRange(pos, radius, DAMAGE_RANGE_CALC_TYPE, victims);
+			iter = &victims;
 			curVictim = iter->firstWithNumeric(&curVictimDistSqr);
 		}
 		else
@@ -1300,8 +1303,6 @@ void WeaponTemplate::dealDamageInternal(ObjectID sourceID, ObjectID victimID, co
 			curVictim = primaryVictim;
 			curVictimDistSqr = 0.0f;
 		}
-		MemoryPoolObjectHolder hold(iter);
-
 		for (; curVictim != nullptr; curVictim = iter ? iter->nextWithNumeric(&curVictimDistSqr) : nullptr)
 		{
 			Bool killSelf = false;
@@ -2091,9 +2092,9 @@ Bool Weapon::isWithinAttackRange(const Object *source, const Object *target) con
 		{
 			//We're close enough to fire off ranged weapons -- but in the case of contact weapons
 			//we want to do a more detailed check to see if we're actually colliding with the target.
-			ObjectIterator *iter = ThePartitionManager->iteratePotentialCollisions( source->getPosition(), source->getGeometryInfo(), 0.0f );
-			MemoryPoolObjectHolder hold( iter );
-			for( Object *them = iter->first(); them; them = iter->next() )
+			ObjectQueryResults collisions;
+			ThePartitionManager->queryPotentialCollisions( source->getPosition(), source->getGeometryInfo(), 0.0f, collisions );
+			for( Object *them = collisions.first(); them; them = collisions.next() )
 			{
 				if( target == them )
 				{
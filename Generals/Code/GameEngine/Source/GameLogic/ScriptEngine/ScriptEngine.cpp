@@ -4678,6 +4678,7 @@ void ScriptEngine::reset( void )
 
 	// Clear the named objects list.
  	m_namedObjects.clear();
+	rebuildNamedSlots();
 
 	m_completedVideo.clear();
 	m_testingSpeech.clear();
@@ -5298,10 +5299,9 @@ Object * ScriptEngine::getUnitNamed(const AsciiString& unitName)
 		return m_conditionObject;
 	}
 
-	for (VecNamedRequestsIt it = m_namedObjects.begin(); it != m_namedObjects.end(); ++it) {
-		if (unitName == (it->first)) {
-			return it->second;
-		}
+	const Int slot = findNamedSlot(unitName);
+	if (slot >= 0) {
+		return m_namedObjects[slot].second;
 	}
 	return nullptr;
 }
@@ -5311,10 +5311,9 @@ Object * ScriptEngine::getUnitNamed(const AsciiString& unitName)
 //-------------------------------------------------------------------------------------------------
 Bool ScriptEngine::didUnitExist(const AsciiString& unitName)
 {
-	for (VecNamedRequestsIt it = m_namedObjects.begin(); it != m_namedObjects.end(); ++it) {
-		if (unitName == (it->first)) {
-			return (it->second == nullptr);
-		}
+	const Int slot = findNamedSlot(unitName);
+	if (slot >= 0) {
+		return (m_namedObjects[slot].second == nullptr);
 	}
 	return false;
 }
@@ -6394,35 +6393,34 @@ void ScriptEngine::addObjectToCache(Object* pNewObject)
 		return;
 	}
 
-	for (VecNamedRequestsIt it = m_namedObjects.begin(); it != m_namedObjects.end(); ++it) {
-		if (it->first == objName) {
-			if (it->second == nullptr) {
-				AsciiString newNameForDead;
-				newNameForDead.format("Reassigning dead object's name '%s' to object (%d) of type '%s'", objName.str(), pNewObject->getID(), pNewObject->getTemplate()->getName().str());
-				AppendDebugMessage(newNameForDead, FALSE);
-				DEBUG_LOG((newNameForDead.str()));
-				it->second = pNewObject;
-				return;
-			} else {
-				DEBUG_CRASH(("Attempting to assign the name '%s' to object (%d) of type '%s',"
-										 " but object (%d) of type '%s' already has that name",
-										 objName.str(), pNewObject->getID(), pNewObject->getTemplate()->getName().str(),
-										 it->second->getID(), it->second->getTemplate()->getName().str()));
-				return;
-			}
-		}
+	// The name is looked at before the object, so a slot with the name wins over a later slot with the object.
+	const Int nameSlot = findNamedSlot(objName);
+	const Int objectSlot = findNamedSlot(pNewObject);
 
-		if (pNewObject == (it->second)) {
-			it->first = objName;
+	if (nameSlot >= 0 && (objectSlot < 0 || nameSlot <= objectSlot)) {
+		Object *namedObject = m_namedObjects[nameSlot].second;
+		if (namedObject == nullptr) {
+			AsciiString newNameForDead;
+			newNameForDead.format("Reassigning dead object's name '%s' to object (%d) of type '%s'", objName.str(), pNewObject->getID(), pNewObject->getTemplate()->getName().str());
+			AppendDebugMessage(newNameForDead, FALSE);
+			DEBUG_LOG((newNameForDead.str()));
+			setNamedSlot(nameSlot, objName, pNewObject);
+			return;
+		} else {
+			DEBUG_CRASH(("Attempting to assign the name '%s' to object (%d) of type '%s',"
+									 " but object (%d) of type '%s' already has that name",
+									 objName.str(), pNewObject->getID(), pNewObject->getTemplate()->getName().str(),
+									 namedObject->getID(), namedObject->getTemplate()->getName().str()));
 			return;
 		}
 	}
 
-	NamedRequest req;
-	req.first = objName;
-	req.second = pNewObject;
+	if (objectSlot >= 0) {
+		setNamedSlot(objectSlot, objName, pNewObject);
+		return;
+	}
 
-	m_namedObjects.push_back(req);
+	addNamedSlot(objName, pNewObject);
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -6430,11 +6428,9 @@ void ScriptEngine::addObjectToCache(Object* pNewObject)
 //-------------------------------------------------------------------------------------------------
 void ScriptEngine::removeObjectFromCache( Object* pDeadObject )
 {
-	for (VecNamedRequestsIt it = m_namedObjects.begin(); it != m_namedObjects.end(); ++it) {
-		if (pDeadObject == (it->second)) {
-			it->second = nullptr;	// Don't remove it, cause we want to check whether we ever knew a name later
-			break;
-		}
+	const Int slot = findNamedSlot(pDeadObject);
+	if (slot >= 0) {
+		setNamedSlot(slot, m_namedObjects[slot].first, nullptr);	// Don't remove it, cause we want to check whether we ever knew a name later
 	}
 }
 
@@ -6463,28 +6459,130 @@ void ScriptEngine::transferObjectName( const AsciiString& unitName, Object *pNew
 
 	pNewObject->setName(unitName); // make sure it has the correct name.
 
-	//Loop through the cached list and find the string entry. If found, change the object
+	//Find the string entry in the cached list. If found, change the object
 	//so it's pointing to the new one.
-	for( VecNamedRequestsIt it = m_namedObjects.begin(); it != m_namedObjects.end(); ++it )
+	const Int slot = findNamedSlot( unitName );
+	if( slot >= 0 )
 	{
-		if( !unitName.compare( it->first ) )
+		Object* pOldObj = m_namedObjects[ slot ].second;
+		if( pOldObj )
 		{
-			Object* pOldObj = it->second;
-			if( pOldObj )
-			{
-				// if you are transferring your name, you should also transfer any custom indicator color you have.
-				if (pOldObj->hasCustomIndicatorColor())
-					pNewObject->setCustomIndicatorColor(pOldObj->getIndicatorColor());
-				else
-					pNewObject->removeCustomIndicatorColor();
-			}
+			// if you are transferring your name, you should also transfer any custom indicator color you have.
+			if (pOldObj->hasCustomIndicatorColor())
+				pNewObject->setCustomIndicatorColor(pOldObj->getIndicatorColor());
+			else
+				pNewObject->removeCustomIndicatorColor();
+		}
 
-			it->second = pNewObject;
+		setNamedSlot( slot, m_namedObjects[ slot ].first, pNewObject );
+	}
 
-			return;
+}
+
+//-------------------------------------------------------------------------------------------------
+static void insertNamedSlot( std::vector<Int>& slots, Int slot )
+{
+	slots.insert( std::lower_bound( slots.begin(), slots.end(), slot ), slot );
+}
+
+//-------------------------------------------------------------------------------------------------
+static void eraseNamedSlot( std::vector<Int>& slots, Int slot )
+{
+	std::vector<Int>::iterator it = std::lower_bound( slots.begin(), slots.end(), slot );
+	if( it != slots.end() && *it == slot )
+		slots.erase( it );
+}
+
+//-------------------------------------------------------------------------------------------------
+Int ScriptEngine::findNamedSlot( const AsciiString& name ) const
+{
+	NamedSlotsByName::const_iterator it = m_namedSlotsByName.find( name );
+	if( it == m_namedSlotsByName.end() || it->second.empty() )
+		return -1;
+	return it->second.front();
+}
+
+//-------------------------------------------------------------------------------------------------
+Int ScriptEngine::findNamedSlot( const Object *obj ) const
+{
+	if( obj == nullptr )
+		return -1;
+
+	NamedSlotsByObject::const_iterator it = m_namedSlotsByObject.find( obj );
+	if( it == m_namedSlotsByObject.end() || it->second.empty() )
+		return -1;
+	return it->second.front();
+}
+
+//-------------------------------------------------------------------------------------------------
+/** Change the name and object of a slot in m_namedObjects and keep the indices up to date */
+//-------------------------------------------------------------------------------------------------
+void ScriptEngine::setNamedSlot( Int slot, const AsciiString& name, Object *obj )
+{
+	NamedRequest& req = m_namedObjects[ slot ];
+
+	if( req.first != name )
+	{
+		NamedSlotsByName::iterator it = m_namedSlotsByName.find( req.first );
+		if( it != m_namedSlotsByName.end() )
+		{
+			eraseNamedSlot( it->second, slot );
+			if( it->second.empty() )
+				m_namedSlotsByName.erase( it );
 		}
+		insertNamedSlot( m_namedSlotsByName[ name ], slot );
+		req.first = name;
 	}
 
+	if( req.second != obj )
+	{
+		if( req.second )
+		{
+			NamedSlotsByObject::iterator it = m_namedSlotsByObject.find( req.second );
+			if( it != m_namedSlotsByObject.end() )
+			{
+				eraseNamedSlot( it->second, slot );
+				if( it->second.empty() )
+					m_namedSlotsByObject.erase( it );
+			}
+		}
+		if( obj )
+			insertNamedSlot( m_namedSlotsByObject[ obj ], slot );
+		req.second = obj;
+	}
+}
+
+//-------------------------------------------------------------------------------------------------
+void ScriptEngine::addNamedSlot( const AsciiString& name, Object *obj )
+{
+	const Int slot = (Int)m_namedObjects.size();
+
+	NamedRequest req;
+	req.first = name;
+	req.second = obj;
+	m_namedObjects.push_back( req );
+
+	// the new slot is the last one, so it goes at the end of the lists
+	m_namedSlotsByName[ name ].push_back( slot );
+	if( obj )
+		m_namedSlotsByObject[ obj ].push_back( slot );
+}
+
+//-------------------------------------------------------------------------------------------------
+/** Index m_namedObjects again after it was filled or cleared as a whole */
+//-------------------------------------------------------------------------------------------------
+void ScriptEngine::rebuildNamedSlots( void )
+{
+	m_namedSlotsByName.clear();
+	m_namedSlotsByObject.clear();
+
+	for( Int slot = 0; slot < (Int)m_namedObjects.size(); ++slot )
+	{
+		const NamedRequest& req = m_namedObjects[ slot ];
+		m_namedSlotsByName[ req.first ].push_back( slot );
+		if( req.second )
+			m_namedSlotsByObject[ req.second ].push_back( slot );
+	}
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -7010,6 +7108,7 @@ const ConditionTemplate * ScriptEngine::getConditionTemplate( Int ndx )
 void ScriptEngine::createNamedCache( void )
 {
 	m_namedObjects.clear();
+	rebuildNamedSlots();
 
 	if( !TheGameLogic )
 	{
@@ -7026,6 +7125,8 @@ void ScriptEngine::createNamedCache( void )
 		}
 		pObj = pObj->getNextObject();
 	}
+
+	rebuildNamedSlots();
 }
 
 void ScriptEngine::appendSequentialScript(const SequentialScript *scriptToSequence)
@@ -8332,6 +8433,8 @@ void ScriptEngine::xfer( Xfer *xfer )
 
 		}
 
+		rebuildNamedSlots();
+
 	}
 
 	// first update
@@ -44,6 +44,7 @@
 #include "Common/MultiplayerSettings.h"
 #include "Common/OSDisplay.h"
 #include "Common/PerfTimer.h"
+#include "Common/PerfTrace.h"
 #include "Common/Player.h"
 #include "Common/PlayerList.h"
 #include "Common/PlayerTemplate.h"
@@ -78,6 +79,7 @@
 #include "GameLogic/AIPathfind.h"
 #include "GameLogic/CaveSystem.h"
 #include "GameLogic/CrateSystem.h"
+#include "GameLogic/DesyncBisect.h"
 #include "GameLogic/FPUControl.h"
 #include "GameLogic/GameLogic.h"
 #include "GameLogic/Locomotor.h"
@@ -209,6 +211,7 @@ GameLogic::GameLogic( void )
 {
 	m_background = nullptr;
 	m_CRC = 0;
+	m_desyncBisect = nullptr;
 	m_isInUpdate = FALSE;
 
 	m_rankPointsToAddAtGameStart = 0;
@@ -304,6 +307,9 @@ GameLogic::~GameLogic()
 		m_background = nullptr;
 	}
 
+	delete m_desyncBisect;
+	m_desyncBisect = nullptr;
+
 	// destroy all remaining objects
 	destroyAllObjectsImmediate();
 
@@ -398,6 +404,13 @@ void GameLogic::reset( void )
 
 	setFPMode();
 
+	// finish the desync bisect file of the previous game, but keep writing it when a replay seek restores a snapshot
+	if (TheRecorder == nullptr || !TheRecorder->isRestoringSnapshot())
+	{
+		delete m_desyncBisect;
+		m_desyncBisect = nullptr;
+	}
+
 	// destroy all objects
 	destroyAllObjectsImmediate();
 
@@ -3080,6 +3093,8 @@ extern __int64 Total_Load_3D_Assets;
 // ------------------------------------------------------------------------------------------------
 void GameLogic::update( void )
 {
+	// TheSuperHackers @feature Frame markers and update phases for the PerfTrace timeline
+	PERF_TRACE_FRAME(m_frame)
 	USE_PERF_TIMER(GameLogic_update)
 
 	LatchRestore<Bool> inUpdateLatch(m_isInUpdate, TRUE);
@@ -3123,12 +3138,14 @@ void GameLogic::update( void )
 
 	// update (execute) scripts
 	{
+		PERF_TRACE_SCOPE(GameLogic_scripts)
 		TheScriptEngine->UPDATE();
 	}
 
 	// Note - TerrainLogic update needs to happen after ScriptEngine update, but before object updates.  jba.
 	// This way changes in bridges are noted in the script engine before being cleared in TerrainLogic->update
 	{
+		PERF_TRACE_SCOPE(GameLogic_terrain)
 		TheTerrainLogic->UPDATE();
 	}
 
@@ -3146,9 +3163,23 @@ void GameLogic::update( void )
 
 	if (generateForSolo || generateForMP)
 	{
-		m_CRC = getCRC( CRC_RECALC );
+		{
+			PERF_TRACE_SCOPE(GameLogic_crc)
+			m_CRC = getCRC( CRC_RECALC );
+		}
 		bool isPlayback = (TheRecorder && TheRecorder->isPlaybackMode());
 
+		// TheSuperHackers @feature Record the CRC of every object and module, to find where two runs of a replay diverge
+		if (isPlayback && !TheGlobalData->m_desyncBisectFile.isEmpty())
+		{
+			if (m_desyncBisect == nullptr)
+			{
+				m_desyncBisect = NEW DesyncBisectWriter;
+				m_desyncBisect->open(TheGlobalData->m_desyncBisectFile);
+			}
+			m_desyncBisect->recordFrame(m_frame, m_CRC);
+		}
+
 		GameMessage *msg = newInstance(GameMessage)(GameMessage::MSG_LOGIC_CRC);
 		msg->appendIntegerArgument(m_CRC);
 		msg->appendBooleanArgument(isPlayback);
@@ -3172,11 +3203,13 @@ void GameLogic::update( void )
 
 	// Update the Recorder
 	{
+		PERF_TRACE_SCOPE(GameLogic_recorder)
 		TheRecorder->UPDATE();
 	}
 
 	// process client commands
 	{
+		PERF_TRACE_SCOPE(GameLogic_commands)
 		processCommandList( TheCommandList );
 	}
 
@@ -3206,6 +3239,7 @@ void GameLogic::update( void )
 #endif
 
 	{
+		PERF_TRACE_SCOPE(GameLogic_sleepyUpdates)
 		while (!m_sleepyUpdates.empty())
 		{
 			UpdateModulePtr u = peekSleepyUpdate();
@@ -3252,16 +3286,19 @@ void GameLogic::update( void )
 
 	// update the Artificial Intelligence system
 	{
+		PERF_TRACE_SCOPE(GameLogic_ai)
 		TheAI->UPDATE();
 	}
 
 	// production updates
 	{
+		PERF_TRACE_SCOPE(GameLogic_buildAssistant)
 		TheBuildAssistant->UPDATE();
 	}
 
 	// update partition info
 	{
+		PERF_TRACE_SCOPE(GameLogic_partition)
 		ThePartitionManager->UPDATE();
 	}
 
@@ -3270,7 +3307,10 @@ void GameLogic::update( void )
 	//
 
 	// destroy all pending objects
-	processDestroyList();
+	{
+		PERF_TRACE_SCOPE(GameLogic_destroyList)
+		processDestroyList();
+	}
 
 	// reset the command list, destroying all messages
 	TheCommandList->reset();
@@ -3515,7 +3555,7 @@ UnsignedInt GameLogic::getCRC( Int mode, AsciiString deepCRCFileName )
 		else
 #endif // DEBUG_CRC
 		{
-			xferCRC = NEW XferCRC;
+			xferCRC = NEW XferFastCRC;
 			crcName = "lightCRC";
 		}
 		xferCRC->open(crcName);
@@ -29,6 +29,7 @@
 
 #pragma once
 
+#include "GameLogic/TerrainHeightField.h"
 #include "GameLogic/TerrainLogic.h"
 
 //-------------------------------------------------------------------------------------------------
@@ -54,6 +55,7 @@ public:
 	virtual void newMap( Bool saveGame );	///< Initialize the logic for new map.
 
 	virtual Real getGroundHeight( Real x, Real y, Coord3D* normal = nullptr ) const;
+	virtual void getGroundHeights( const Coord2D *points, Real *heights, Int count ) const;
 
 	virtual Bool isCliffCell( Real x, Real y) const;			///< is point cliff cell.
 
@@ -67,6 +69,9 @@ public:
 
 	virtual Bool isClearLineOfSight(const Coord3D& pos, const Coord3D& posOther) const;
 
+	virtual Int getRawMapHeight( const ICoord2D *gridPos ) const;
+	virtual void setRawMapHeight( const ICoord2D *gridPos, Int height );
+
 protected:
 
 	// snapshot methods
@@ -77,4 +82,7 @@ protected:
 	Real m_mapMinZ;	///< Minimum terrain z value.
 	Real m_mapMaxZ;	///< Maximum terrain z value.
 
+	TerrainHeightField m_heightField;	///< The heights of the logic, so that it does not need the terrain render object
+	Bool m_loadHeightFieldFromVisual;	///< The save game did not have the heights, take them from the terrain visual after loading
+
 };
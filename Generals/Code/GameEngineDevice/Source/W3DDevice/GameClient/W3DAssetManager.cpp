@@ -63,10 +63,20 @@
 #include <wwprofile.h>
 #include "wwmemlog.h"
 #include "ffactory.h"
+#include "RAMFILE.h"
+#include "chunkio.h"
+#include "w3d_file.h"
+#include "htree.h"
+#include "htreemgr.h"
+#include "hanimmgr.h"
+#include "hrawanim.h"
+#include "hcanim.h"
+#include "motchan.h"
 #include "font3d.h"
 #include "render2dsentence.h"
 #include "Common/PerfTimer.h"
 #include "Common/GlobalData.h"
+#include "Common/WorkerThreadPool.h"
 
 
 //---------------------------------------------------------------------
@@ -933,6 +943,12 @@ static Int Load_3D_Asset_Recursions=0;
 #endif
 //---------------------------------------------------------------------
 bool W3DAssetManager::Load_3D_Assets( const char * filename )
+{
+	return Load_3D_Assets( filename, nullptr );
+}
+
+//---------------------------------------------------------------------
+bool W3DAssetManager::Load_3D_Assets( const char * filename, const PreloadFile * preloadFile )
 {
 #ifdef DUMP_PERF_STATS
 		Load_3D_Asset_Recursions++;
@@ -960,7 +976,11 @@ bool W3DAssetManager::Load_3D_Assets( const char * filename )
 		return TRUE;	//this file has already been loaded.
 	}
 
-	bool result = WW3DAssetManager::Load_3D_Assets(filename);
+	bool result;
+	if (preloadFile != nullptr && preloadFile->data != nullptr)
+		result = Load_Preloaded_3D_Assets(*preloadFile);
+	else
+		result = WW3DAssetManager::Load_3D_Assets(filename);
 
 #if defined(RTS_DEBUG)
 	if (result && TheGlobalData->m_preloadReport)
@@ -987,6 +1007,354 @@ bool W3DAssetManager::Load_3D_Assets( const char * filename )
 
 }
 
+//---------------------------------------------------------------------
+// TheSuperHackers @performance Preloading files together, to parse parts of them on the worker threads.
+//
+// The files are read on the main thread, because the file system is not thread safe. Then the
+// hierarchy chunks, and the animation chunks whose hierarchy is loaded already, are parsed on the
+// worker threads. Neither touches the device or anything that can change until the files are
+// added. Everything else, such as meshes, which create textures and materials, is parsed on the
+// main thread when the files are added to the manager. The files are added one after the other
+// in the order they were asked for, with the same checks as Load_3D_Assets, so the loaded assets
+// are the same as when loading the files one at a time.
+//---------------------------------------------------------------------
+
+struct W3DAssetManager::PreloadChunk
+{
+	const char *data;				///< of the file
+	int size;								///< of the file
+	int offset;							///< of the chunk header in the file
+	int index;							///< of the chunk among the top level chunks of the file
+	uint32 chunkId;
+	HTreeClass *tree;				///< owned until it is handed to the HTreeManager
+	HAnimClass *anim;				///< owned until it is handed to the HAnimManager
+	bool loaded;
+};
+
+struct W3DAssetManager::PreloadFile
+{
+	const char *filename;
+	char *data;							///< nullptr when the file is loaded the regular way
+	int size;
+	int firstChunk;
+	int chunkCount;
+	PreloadChunk *chunks;
+};
+
+enum
+{
+	MAX_PRELOAD_BATCH_BYTES = 32 * 1024 * 1024,	///< bytes of files that are read before they are parsed and added
+};
+
+//---------------------------------------------------------------------
+/** The memory pools of the animation channels are created on first use, which is not thread
+	* safe, and the adaptive delta channel initializes its filter table on first construction. */
+//---------------------------------------------------------------------
+static void createPreloadMemoryPools()
+{
+	static Bool created = FALSE;
+	if (created)
+		return;
+
+	delete W3DNEW MotionChannelClass;
+	delete W3DNEW BitChannelClass;
+	delete W3DNEW TimeCodedMotionChannelClass;
+	delete W3DNEW AdaptiveDeltaMotionChannelClass;
+	delete W3DNEW TimeCodedBitChannelClass;
+	created = TRUE;
+}
+
+//---------------------------------------------------------------------
+void W3DAssetManager::Parse_Preload_Chunk( void *userData, Int index )
+{
+	PreloadChunk &chunk = static_cast<PreloadChunk *>(userData)[index];
+
+	RAMFileClass file(const_cast<char *>(chunk.data), chunk.size);
+	file.Open();
+	file.Seek(chunk.offset, SEEK_SET);
+
+	ChunkLoadClass cload(&file);
+	cload.Open_Chunk();
+
+	switch (chunk.chunkId)
+	{
+		case W3D_CHUNK_HIERARCHY:
+			chunk.loaded = chunk.tree->Load_W3D(cload) == HTreeClass::OK;
+			break;
+
+		case W3D_CHUNK_ANIMATION:
+			chunk.loaded = static_cast<HRawAnimClass *>(chunk.anim)->Load_W3D(cload) == HRawAnimClass::OK;
+			break;
+
+		case W3D_CHUNK_COMPRESSED_ANIMATION:
+			chunk.loaded = static_cast<HCompressedAnimClass *>(chunk.anim)->Load_W3D(cload) == HCompressedAnimClass::OK;
+			break;
+	}
+
+	cload.Close_Chunk();
+	file.Close();
+}
+
+//---------------------------------------------------------------------
+void W3DAssetManager::Load_3D_Assets( const AsciiString * filenames, Int count )
+{
+#ifdef DEBUG_LOGGING
+	const UnsignedInt startTime = timeGetTime();
+	Int parsedChunkCount = 0;
+#endif
+
+	// the workers would call into the profiler when an animation looks up its hierarchy
+	if (WWProfileManager::Is_Profile_Enabled())
+	{
+		for (Int i = 0; i < count; ++i)
+			Load_3D_Assets( filenames[i].str() );
+		return;
+	}
+
+	createPreloadMemoryPools();
+
+	std::vector<PreloadFile> files;
+	std::vector<PreloadChunk> chunks;
+	Int first = 0;
+
+	while (first < count)
+	{
+		files.clear();
+		chunks.clear();
+
+		Int batchBytes = 0;
+		Int last = first;
+		for (; last < count && batchBytes < MAX_PRELOAD_BATCH_BYTES; ++last)
+		{
+			PreloadFile file;
+			file.filename = filenames[last].str();
+			file.data = nullptr;
+			file.size = 0;
+			file.firstChunk = (int)chunks.size();
+			file.chunkCount = 0;
+			file.chunks = nullptr;
+
+			// the same model is often asked for many times, read it once
+			Bool readBefore = FALSE;
+			for (size_t i = 0; i < files.size(); ++i)
+			{
+				if (stricmp(files[i].filename, file.filename) == 0)
+				{
+					readBefore = TRUE;
+					break;
+				}
+			}
+
+			if (!readBefore)
+			{
+				Read_Preload_File( file, chunks );
+				batchBytes += file.size;
+			}
+
+			files.push_back(file);
+		}
+
+		if (!chunks.empty())
+		{
+			WorkerThreadPool::parallelFor( Parse_Preload_Chunk, &chunks[0], (Int)chunks.size() );
+#ifdef DEBUG_LOGGING
+			parsedChunkCount += (Int)chunks.size();
+#endif
+		}
+
+		for (size_t i = 0; i < files.size(); ++i)
+		{
+			PreloadFile &file = files[i];
+			if (file.chunkCount > 0)
+				file.chunks = &chunks[file.firstChunk];
+
+			Load_3D_Assets( file.filename, &file );
+		}
+
+		// the chunks of files that were loaded already were not handed to the managers
+		for (size_t i = 0; i < chunks.size(); ++i)
+		{
+			delete chunks[i].tree;
+			REF_PTR_RELEASE(chunks[i].anim);
+		}
+
+		for (size_t i = 0; i < files.size(); ++i)
+			delete [] files[i].data;
+
+		first = last;
+	}
+
+	DEBUG_LOG(("W3DAssetManager::Load_3D_Assets - Loaded %d files in %u ms, parsed %d chunks on %d worker threads",
+		count, timeGetTime() - startTime, parsedChunkCount, TheWorkerThreadPool ? TheWorkerThreadPool->getThreadCount() : 0));
+}
+
+//---------------------------------------------------------------------
+/** Reads the whole file and picks the chunks that can be parsed on the worker threads. Does
+	* nothing for files that are loaded already, so that they are skipped the regular way. */
+//---------------------------------------------------------------------
+void W3DAssetManager::Read_Preload_File( PreloadFile & preloadFile, std::vector<PreloadChunk> & preloadChunks )
+{
+	char basename[512];
+	strlcpy(basename, preloadFile.filename, ARRAY_SIZE(basename));
+	char *pext = strrchr(basename, '.');
+	if (pext)
+		*pext = '\0';
+	if (Find_Prototype(basename))
+		return;
+
+	FileClass * file = _TheFileFactory->Get_File( preloadFile.filename );
+	if (file == nullptr)
+		return;
+
+	if (file->Is_Available() && file->Open())
+	{
+		const int size = file->Size();
+		if (size > 0)
+		{
+			char *data = W3DNEWARRAY char[size];
+			if (file->Read(data, size) == size)
+			{
+				preloadFile.data = data;
+				preloadFile.size = size;
+			}
+			else
+			{
+				delete [] data;
+			}
+		}
+		file->Close();
+	}
+	_TheFileFactory->Return_File( file );
+
+	if (preloadFile.data == nullptr)
+		return;
+
+	RAMFileClass ramfile(preloadFile.data, preloadFile.size);
+	ramfile.Open();
+	ChunkLoadClass cload(&ramfile);
+
+	int offset = 0;
+	for (int index = 0; cload.Open_Chunk(); ++index)
+	{
+		PreloadChunk chunk;
+		chunk.data = preloadFile.data;
+		chunk.size = preloadFile.size;
+		chunk.offset = offset;
+		chunk.index = index;
+		chunk.chunkId = cload.Cur_Chunk_ID();
+		chunk.tree = nullptr;
+		chunk.anim = nullptr;
+		chunk.loaded = false;
+
+		offset += sizeof(ChunkHeader) + cload.Cur_Chunk_Length();
+
+		switch (chunk.chunkId)
+		{
+			case W3D_CHUNK_HIERARCHY:
+				chunk.tree = W3DNEW HTreeClass;
+				break;
+
+			case W3D_CHUNK_ANIMATION:
+			case W3D_CHUNK_COMPRESSED_ANIMATION:
+			{
+				// An animation that needs its hierarchy loaded on demand is left to the main thread.
+				// Hierarchies are never replaced, so this one is the one it would find later too.
+				W3dAnimHeaderStruct header;
+				if (cload.Open_Chunk())
+				{
+					if (cload.Read(&header, sizeof(header)) == sizeof(header))
+					{
+						char hierarchyName[W3D_NAME_LEN + 1];
+						strlcpy(hierarchyName, header.HierarchyName, ARRAY_SIZE(hierarchyName));
+						if (HTreeManager.Get_Tree(hierarchyName) != nullptr)
+						{
+							if (chunk.chunkId == W3D_CHUNK_ANIMATION)
+								chunk.anim = W3DNEW HRawAnimClass;
+							else
+								chunk.anim = W3DNEW HCompressedAnimClass;
+						}
+					}
+					cload.Close_Chunk();
+				}
+				break;
+			}
+		}
+
+		if (chunk.tree != nullptr || chunk.anim != nullptr)
+		{
+			preloadChunks.push_back(chunk);
+			++preloadFile.chunkCount;
+		}
+
+		cload.Close_Chunk();
+	}
+
+	ramfile.Close();
+}
+
+//---------------------------------------------------------------------
+/** Does what WW3DAssetManager::Load_3D_Assets does for a file, but takes the chunks that were
+	* parsed on the worker threads instead of parsing them again. */
+//---------------------------------------------------------------------
+bool W3DAssetManager::Load_Preloaded_3D_Assets( const PreloadFile & preloadFile )
+{
+	RAMFileClass ramfile(preloadFile.data, preloadFile.size);
+	if (!ramfile.Open())
+		return false;
+
+	ChunkLoadClass cload(&ramfile);
+
+	PreloadChunk *chunk = preloadFile.chunks;
+	PreloadChunk *chunkEnd = preloadFile.chunks + preloadFile.chunkCount;
+
+	for (int index = 0; cload.Open_Chunk(); ++index)
+	{
+		if (chunk != chunkEnd && chunk->index == index)
+		{
+			if (chunk->tree != nullptr)
+			{
+				if (chunk->loaded)
+					HTreeManager.Add_Tree(chunk->tree);
+				else
+					delete chunk->tree;
+				chunk->tree = nullptr;
+			}
+			else
+			{
+				if (chunk->loaded && HAnimManager.Peek_Anim(chunk->anim->Get_Name()) == nullptr)
+					HAnimManager.Add_Anim(chunk->anim);
+				REF_PTR_RELEASE(chunk->anim);
+			}
+			++chunk;
+		}
+		else
+		{
+			switch (cload.Cur_Chunk_ID())
+			{
+				case W3D_CHUNK_HIERARCHY:
+					HTreeManager.Load_Tree(cload);
+					break;
+
+				case W3D_CHUNK_ANIMATION:
+				case W3D_CHUNK_COMPRESSED_ANIMATION:
+				case W3D_CHUNK_MORPH_ANIMATION:
+					HAnimManager.Load_Anim(cload);
+					break;
+
+				default:
+					Load_Prototype(cload);
+					break;
+			}
+		}
+
+		cload.Close_Chunk();
+	}
+
+	ramfile.Close();
+
+	return true;
+}
+
 #ifdef DUMP_PERF_STATS
 __int64 Total_Get_HAnim_Time=0;
 static Int HAnim_Recursions=0;
@@ -38,6 +38,7 @@
  *   HTreeManagerClass::Free -- de-allocate all memory in use                                  *
  *   HTreeManagerClass::Free_All_Trees -- de-allocates all hierarchy trees currently loaded    *
  *   HTreeManagerClass::Load_Tree -- load a hierarchy tree from a file                         *
+ *   HTreeManagerClass::Add_Tree -- add a hierarchy tree that was loaded elsewhere             *
  *   HTreeManagerClass::Get_Tree_ID -- look up the ID of a named hierarchy tree                *
  *   HTreeManagerClass::Get_Tree -- get a pointer to the specified hierarchy tree              *
  *   HTreeManagerClass::Get_Tree -- get a pointer to the specified hierarchy tree              *
@@ -192,20 +193,9 @@ int HTreeManagerClass::Load_Tree(ChunkLoadClass & cload)
 		delete newtree;
 		goto Error;
 
-	} else if (Get_Tree_ID(newtree->Get_Name()) != -1) {
-
-		// tree with this name already exists, reject it!
-		delete newtree;
-		goto Error;
-
-	} else {
-
-		// ok, accept this hierarchy tree!
-		TreePtr[NumTrees] = newtree;
-		NumTrees++;
 	}
 
-	return 0;
+	return Add_Tree(newtree);
 
 Error:
 
@@ -213,6 +203,36 @@ Error:
 
 }
 
+/***********************************************************************************************
+ * HTreeManagerClass::Add_Tree -- add a hierarchy tree that was loaded elsewhere               *
+ *                                                                                             *
+ * INPUT:                                                                                      *
+ * newtree - a tree that loaded successfully, the manager takes ownership                      *
+ *                                                                                             *
+ * OUTPUT:                                                                                     *
+ * 0 if the tree was added, 1 if a tree with the same name exists and the new one was deleted  *
+ *                                                                                             *
+ * WARNINGS:                                                                                   *
+ *                                                                                             *
+ * HISTORY:                                                                                    *
+ *=============================================================================================*/
+int HTreeManagerClass::Add_Tree(HTreeClass * newtree)
+{
+	if (Get_Tree_ID(newtree->Get_Name()) != -1) {
+
+		// tree with this name already exists, reject it!
+		delete newtree;
+		return 1;
+
+	}
+
+	// ok, accept this hierarchy tree!
+	TreePtr[NumTrees] = newtree;
+	NumTrees++;
+
+	return 0;
+}
+
 /***********************************************************************************************
  * HTreeManagerClass::Get_Tree_ID -- look up the ID of a named hierarchy tree                  *
  *                                                                                             *
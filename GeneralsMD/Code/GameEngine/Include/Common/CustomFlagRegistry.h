@@ -0,0 +1,107 @@
+/*
+**	Command & Conquer Generals Zero Hour(tm)
+**	Copyright 2026 TheSuperHackers
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// FILE: CustomFlagRegistry.h /////////////////////////////////////////////////////////////////////
+// Desc:   Interns custom status names into dense indices so that per object sets of them
+//         can be stored and tested as bitsets.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "Common/AsciiString.h"
+#include "Common/STLTypedefs.h"
+
+//-------------------------------------------------------------------------------------------------
+/** A growable bitset of custom flag indices handed out by a CustomFlagRegistry.
+	* Bits beyond the stored words are implicitly clear, so sets only grow when a bit is set. */
+//-------------------------------------------------------------------------------------------------
+class CustomFlagSet
+{
+public:
+
+	enum { BITS_PER_WORD = 32 };
+
+	CustomFlagSet() { }
+
+	Bool test(Int index) const
+	{
+		if (index < 0)
+			return FALSE;
+		const size_t word = (size_t)index / BITS_PER_WORD;
+		if (word >= m_words.size())
+			return FALSE;
+		return (m_words[word] & (1u << (index % BITS_PER_WORD))) != 0;
+	}
+
+	/// Set or clear a bit. Returns TRUE if the bit changed.
+	Bool set(Int index, Bool value = TRUE);
+	Bool reset(Int index) { return set(index, FALSE); }
+
+	/// Returns TRUE if every bit of other is also set in this set.
+	Bool testAll(const CustomFlagSet& other) const;
+
+	/// Returns TRUE if any bit of other is also set in this set.
+	Bool testAny(const CustomFlagSet& other) const;
+
+	Bool any() const;
+	void clear() { m_words.clear(); }
+
+	Bool operator==(const CustomFlagSet& other) const;
+	Bool operator!=(const CustomFlagSet& other) const { return !(*this == other); }
+
+private:
+
+	std::vector<UnsignedInt> m_words;
+};
+
+//-------------------------------------------------------------------------------------------------
+/** Maps custom flag names to dense indices. Indices are never released, so an index handed out
+	* once stays valid for the lifetime of the engine. Names are only interned when game logic sets
+	* a flag by name; lookups never intern. Indices depend on the history of the session, so they
+	* must never decide iteration order or be written to a save game or CRC. */
+//-------------------------------------------------------------------------------------------------
+class CustomFlagRegistry
+{
+public:
+
+	enum { INVALID_INDEX = -1 };
+
+	CustomFlagRegistry() { }
+
+	/// Return the index of name, adding it if it is not known yet.
+	Int intern(const AsciiString& name);
+
+	/// Return the index of name, or INVALID_INDEX if it was never interned.
+	Int find(const AsciiString& name) const;
+
+	const AsciiString& getName(Int index) const { return m_names[index]; }
+	Int getCount() const { return (Int)m_names.size(); }
+
+	/// Set the bits of all known names in set. Returns FALSE if any name was never interned.
+	Bool findSet(const std::vector<AsciiString>& names, CustomFlagSet& set) const;
+
+private:
+
+	typedef std::hash_map< AsciiString, Int, rts::hash<AsciiString>, rts::equal_to<AsciiString> > IndexMap;
+
+	IndexMap m_indices;
+	std::vector<AsciiString> m_names;
+};
+
+// not part of the subsystem list, because it should never be reset!
+extern CustomFlagRegistry *TheCustomStatusRegistry;		///< names used by Object::setCustomStatus and friends
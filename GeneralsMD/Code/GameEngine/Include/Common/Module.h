@@ -93,6 +93,21 @@ enum ModuleInterfaceType CPP_11(: Int)
 	MODULEINTERFACE_CLIENT_UPDATE		= 0x00000800
 };
 
+//-------------------------------------------------------------------------------------------------
+/** The behavior module interfaces that Objects fan events out to. An Object reaches the modules
+	* of these through the ModuleDispatch of its template instead of asking all of its modules. */
+//-------------------------------------------------------------------------------------------------
+enum ModuleDispatchType CPP_11(: Int)
+{
+	MODULEDISPATCH_COLLIDE,
+	MODULEDISPATCH_DAMAGE,
+	MODULEDISPATCH_DIE,
+	MODULEDISPATCH_SPECIAL_POWER,
+	MODULEDISPATCH_UPGRADE,
+
+	MODULEDISPATCH_COUNT
+};
+
 //-------------------------------------------------------------------------------------------------
 /** Base class for data-read-from-INI for modules. */
 //-------------------------------------------------------------------------------------------------
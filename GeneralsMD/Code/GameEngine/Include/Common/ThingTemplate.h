@@ -53,6 +53,7 @@
 
 // FORWARD REFERENCES /////////////////////////////////////////////////////////////////////////////
 class AIUpdateModuleData;
+class BehaviorModule;
 class Image;
 class Object;
 class Drawable;
@@ -296,6 +297,24 @@ enum ModuleParseMode CPP_11(: Int)
 
 };
 
+//-------------------------------------------------------------------------------------------------
+/** Where the modules of an interface or of a name are among the modules that an Object creates
+	* from a ModuleInfo. The positions do not count unnamed entries, as no modules are created for
+	* those, and they do not count the helper modules that Object adds in front. */
+//-------------------------------------------------------------------------------------------------
+struct ModuleDispatch
+{
+	struct NameKeyModule
+	{
+		NameKeyType nameKey;
+		Short module;
+	};
+
+	std::vector<Short> m_interfaceModules[MODULEDISPATCH_COUNT];	///< in module order
+	std::vector<NameKeyModule> m_nameKeyModules;									///< sorted by name key, only the first module of a name
+	Int m_moduleCount;
+};
+
 //-------------------------------------------------------------------------------------------------
 class ModuleInfo
 {
@@ -324,9 +343,23 @@ private:
 	};
 	std::vector<Nugget> m_info;
 
+	// TheSuperHackers @performance The dispatch is built on first use and rebuilt after the info changed.
+	mutable ModuleDispatch m_dispatch;
+	mutable Bool m_dispatchValid;
+
+	void buildDispatch( BehaviorModule* const* modules ) const;
+
 public:
 
-	ModuleInfo() { }
+	ModuleInfo() : m_dispatchValid(FALSE) { }
+
+	/// modules are the template modules of an Object that was just created from this info
+	const ModuleDispatch& getDispatch( BehaviorModule* const* modules ) const
+	{
+		if (!m_dispatchValid)
+			buildDispatch( modules );
+		return m_dispatch;
+	}
 
 	void addModuleInfo( ThingTemplate *thingTemplate, const AsciiString& name, const AsciiString& moduleTag, const ModuleData* data, Int interfaceMask, Bool inheritable, Bool overrideableByLikeKind = FALSE );
 	const ModuleInfo::Nugget *getNuggetWithTag( const AsciiString& tag ) const;
@@ -379,6 +412,7 @@ public:
 	void clear()
 	{
 		m_info.clear();
+		m_dispatchValid = FALSE;
 	}
 
 	void setCopiedFromDefault(Bool v)
@@ -466,6 +500,8 @@ public:
 		return TEST_KINDOFMASK_ANY(m_kindof, anyKindOf);
 	}
 
+	const KindOfMaskType& getKindOfMask() const { return m_kindof; }
+
 	/// set the display name
 	const UnicodeString& getDisplayName() const { return m_displayName; }  ///< return display name
 
@@ -289,6 +289,8 @@ class Drawable : public Thing,
 
 	MEMORY_POOL_GLUE_WITH_USERLOOKUP_CREATE(Drawable, "Drawable" )
 
+	friend class DrawableGrid;
+
 public:
 
 	Drawable( const ThingTemplate *thing, DrawableStatusBits statusBits = DRAWABLE_STATUS_DEFAULT );
@@ -720,6 +722,8 @@ private:
 	DrawableID m_id;						///< this drawable's unique ID
 	Drawable *m_nextDrawable;
 	Drawable *m_prevDrawable;		///< list links
+	Int m_gridBucket;						///< bucket in the DrawableGrid of TheGameClient, or -1
+	Int m_gridIndex;						///< index in that bucket
 
   DynamicAudioEventInfo *m_customSoundAmbientInfo; ///< If not nullptr, info about the ambient sound to attach to this object
 
@@ -35,6 +35,7 @@
 #include "Common/SubsystemInterface.h"
 #include "GameClient/CommandXlat.h"
 #include "GameClient/Drawable.h"
+#include "GameClient/DrawableGrid.h"
 
 // forward declarations
 class AsciiString;
@@ -109,6 +110,7 @@ public:
 	DrawableID getDrawableIDCounter( void ) { return m_nextDrawableID; }
 
 	virtual Drawable *firstDrawable( void ) { return m_drawableList; }
+	DrawableGrid *getDrawableGrid( void ) { return &m_drawableGrid; }
 
 	virtual GameMessage::Type evaluateContextCommand( Drawable *draw,
 																										const Coord3D *pos,
@@ -179,6 +181,7 @@ protected:
 	UnsignedInt m_frame;																				///< Simulation frame number from server
 
 	Drawable *m_drawableList;																		///< All of the drawables in the world
+	DrawableGrid m_drawableGrid;																///< All of the drawables in the world by position
 //	DrawablePtrHash m_drawableHash;															///< Used for DrawableID lookups
 	DrawablePtrVector m_drawableVector;
 
@@ -50,6 +50,11 @@ class PathfindCell;
 
 #if !RETAIL_COMPATIBLE_PATHFINDING
 #undef RETAIL_COMPATIBLE_PATHFINDING_ALLOCATION
+#endif
+
+#if RETAIL_COMPATIBLE_PATHFINDING
+#undef USE_PATHFIND_OPEN_LIST_HEAP
+#define USE_PATHFIND_OPEN_LIST_HEAP (0)
 #endif
 
   typedef UnsignedShort zoneStorageType;
@@ -242,6 +247,11 @@ protected:
 
 	UnsignedShort m_totalCost, m_costSoFar;	///< cost estimates for A* search
 
+#if USE_PATHFIND_OPEN_LIST_HEAP
+	Int m_openHeapIndex;							///< index of this cell in the open list heap, -1 if not on it
+	UnsignedInt m_openSequence;				///< insertion order on the open list, breaks total cost ties
+#endif
+
 	/// have to include cell's coordinates, since cells are often accessed via pointer only
 	ICoord2D m_pos;
 
@@ -266,10 +276,16 @@ class PathfindCellList
 	friend class PathfindCell;
 
 public:
+#if USE_PATHFIND_OPEN_LIST_HEAP
+	PathfindCellList() : m_head(nullptr), m_tail(nullptr), m_openSequence(0) {}
+#else
 	PathfindCellList() : m_head(nullptr), m_tail(nullptr) {}
+#endif
 
 #if RETAIL_COMPATIBLE_PATHFINDING
 	void reset(PathfindCell* newHead = nullptr) { m_head = newHead; m_tail = nullptr; }
+#elif USE_PATHFIND_OPEN_LIST_HEAP
+	void reset() { m_head = nullptr; m_tail = nullptr; m_openHeap.clear(); m_openSequence = 0; }
 #else
 	void reset() { m_head = nullptr; m_tail = nullptr; }
 #endif
@@ -280,9 +296,31 @@ public:
 
 	Bool canReverseSort(PathfindCell& currentCell) const;
 
+#if USE_PATHFIND_OPEN_LIST_HEAP
+	Int getOpenHeapCount() const { return (Int)m_openHeap.size(); }
+	PathfindCell* getOpenHeapCell(Int index) const;
+#endif
+
 private:
+#if USE_PATHFIND_OPEN_LIST_HEAP
+	static Bool isOpenHeapLess(const PathfindCellInfo* a, const PathfindCellInfo* b);
+	void openHeapPush(PathfindCellInfo* info);
+	void openHeapRemove(PathfindCellInfo* info);
+	void openHeapSiftUp(Int index);
+	void openHeapSiftDown(Int index);
+	void openHeapPlace(Int index, PathfindCellInfo* info);
+	void openHeapUpdateHead();
+#endif
+
 	PathfindCell* m_head;
 	PathfindCell* m_tail;
+
+#if USE_PATHFIND_OPEN_LIST_HEAP
+	// TheSuperHackers @performance The open list is kept as a binary min heap keyed on (m_totalCost, m_openSequence).
+	// m_head always mirrors the heap top so getHead() and empty() behave the same as with the sorted list.
+	std::vector<PathfindCellInfo*> m_openHeap;
+	UnsignedInt m_openSequence;
+#endif
 };
 
 /**
@@ -537,6 +575,8 @@ public:
 	~ZoneBlock();  // not virtual, please don't override without making virtual.  jba.
 
 	void blockCalculateZones(	PathfindCell **map, PathfindLayer layers[], const IRegion2D &bounds);	///< Does zone calculations.
+	void labelCellZones( PathfindCell **map, const IRegion2D &bounds );	///< Numbers the connected cells of the block 1, 2, 3...
+	void offsetZones( Int delta );	///< Moves the zones of a block whose cells did not change.
 	zoneStorageType getEffectiveZone(LocomotorSurfaceTypeMask acceptableSurfaces, Bool crusher, zoneStorageType zone) const;
 
 	void clearMarkedPassable() {m_markedPassable = false;}
@@ -546,6 +586,14 @@ public:
 	Bool getInteractsWithBridge() const {return m_interactsWithBridge;}
 	void setInteractsWithBridge(Bool interacts) {m_interactsWithBridge = interacts;}
 
+	Bool isDirty() const {return m_dirty;}
+	void setDirty(Bool dirty) {m_dirty = dirty;}
+
+	Bool getCellsInteractWithBridge() const {return m_cellsInteractWithBridge;}
+	Int getNumCellZones() const {return m_numCellZones;}
+	Int getZoneBase() const {return m_zoneBase;}
+	void setZoneBase(Int zoneBase) {m_zoneBase = zoneBase;}
+
 protected:
 	void allocateZones();
 	void freeZones();
@@ -564,6 +612,13 @@ protected:
 	zoneStorageType *m_crusherZones;
 	Bool					m_interactsWithBridge;
 	Bool					m_markedPassable;
+
+	// The cells of the block hold the zones m_zoneBase+1 to m_zoneBase+m_numCellZones. While the block
+	// is not dirty they are kept, and the next zone calculation only moves them to the new base.
+	zoneStorageType m_zoneBase;
+	UnsignedShort m_numCellZones;
+	Bool					m_cellsInteractWithBridge;	///< Some cell of the block connects to a layer.
+	Bool					m_dirty;										///< The cells changed since the last zone calculation.
 };
 typedef ZoneBlock *ZoneBlockP;
 
@@ -589,6 +644,7 @@ public:
 
 	Bool needToCalculateZones() const {return m_nextFrameToCalculateZones <= TheGameLogic->getFrame() ;} ///< Returns true if the zones need to be recalculated.
 	void markZonesDirty() ; ///< Called when the zones need to be recalculated.
+	void markZonesDirty( const IRegion2D &cellBounds ) ; ///< Called when the zones need to be recalculated, and only the cells in the bounds changed.
 	void updateZonesForModify( PathfindCell **map,  PathfindLayer layers[], const IRegion2D &structureBounds, const IRegion2D &globalBounds ) ; ///< Called to recalculate an area when a structure has been removed.
 	void calculateZones(	PathfindCell **map, PathfindLayer layers[], const IRegion2D &bounds);	///< Does zone calculations.
 	zoneStorageType getEffectiveZone(LocomotorSurfaceTypeMask acceptableSurfaces, Bool crusher, zoneStorageType zone) const;
@@ -614,10 +670,12 @@ private:
 	void allocateZones();
 	void freeZones();
 	void freeBlocks();
+	void markBlocksDirty( const IRegion2D &cellBounds );
 
 private:
 	ZoneBlock			*m_blockOfZoneBlocks;			///< Zone blocks - Info for hierarchical pathfinding at a "blocky" level.
 	ZoneBlock			**m_zoneBlocks;						///< Zone blocks as a matrix - contains matrix indexing into the map.
+	zoneStorageType *m_blockZoneBases;			///< Zone base of each block in the running zone calculation.
 	ICoord2D			m_zoneBlockExtent;				///< Zone block extents. Not the same scale as the pathfind extents.
 
 	UnsignedShort m_maxZone;								///< Max zone used.
@@ -34,6 +34,7 @@
 #include "Common/DisabledTypes.h"
 #include "Common/GameType.h"
 #include "Common/KindOf.h"
+#include "Common/NameKeyGenerator.h"
 #include "Common/ObjectStatusTypes.h" // Precompiled header anyway, no detangling possibility
 #include "Common/Snapshot.h"
 #include "GameClient/TintStatus.h"
@@ -188,11 +189,42 @@ inline void SET_ALL_DAMAGE_TYPE_BITS(DamageTypeFlags& m)
 extern DamageTypeFlags DAMAGE_TYPE_FLAGS_NONE;
 extern DamageTypeFlags DAMAGE_TYPE_FLAGS_ALL;
 
-typedef std::pair<AsciiString, Int>		AsciiStringIntPair;	
-typedef std::vector<AsciiStringIntPair>	CustomFlags;
+//-------------------------------------------------------------------------------------------------
+/** Required (+Name) and forbidden (-Name) custom damage or death types. The names are resolved to
+	* name keys once when the INI is parsed so that the per hit test does not compare strings. */
+//-------------------------------------------------------------------------------------------------
+class CustomFlags
+{
+public:
+	void clear() { m_required.clear(); m_forbidden.clear(); }
+	Bool empty() const { return m_required.empty() && m_forbidden.empty(); }
+
+	void addRequired(NameKeyType key) { m_required.push_back(key); }
+	void addForbidden(NameKeyType key) { m_forbidden.push_back(key); }
+
+	Bool isRequired(NameKeyType key) const { return contains(m_required, key); }
+	Bool isForbidden(NameKeyType key) const { return contains(m_forbidden, key); }
+
+private:
+	static Bool contains(const std::vector<NameKeyType>& keys, NameKeyType key)
+	{
+		for (std::vector<NameKeyType>::const_iterator it = keys.begin(); it != keys.end(); ++it)
+		{
+			if (*it == key)
+				return TRUE;
+		}
+		return FALSE;
+	}
+
+	std::vector<NameKeyType> m_required;		///< custom types that pass the test
+	std::vector<NameKeyType> m_forbidden;		///< custom types that fail the test, these win over m_required
+};
 
 typedef std::pair<DamageTypeFlags, AsciiString>		DamageFlagsCustom;	
 
+// TheSuperHackers @performance The custom type is looked up as a name key instead of comparing it
+// against every listed name. The listed names got their keys when the INI was parsed, so a custom type
+// without a key cannot be listed, and the lookup must not create one during the match.
 inline Bool getCustomTypeFlag( const AsciiString& set, const CustomFlags& CustomTypes, const AsciiString& CustomType )
 {
 	Bool pass = TRUE;
@@ -206,15 +238,14 @@ inline Bool getCustomTypeFlag( const AsciiString& set, const CustomFlags& Custom
 	if(CustomTypes.empty())
 		return pass;
 
-	for (CustomFlags::const_iterator it = CustomTypes.begin(); 
-				it != CustomTypes.end();
-				++it)
-	{
-		if (it->second == 2 && it->first == CustomType)
-			return FALSE;
-		if (it->second == 1 && it->first == CustomType)
-			pass = TRUE;
-	}
+	const NameKeyType key = TheNameKeyGenerator->findNameKey(CustomType);
+	if (key == NAMEKEY_INVALID)
+		return pass;
+
+	if (CustomTypes.isForbidden(key))
+		return FALSE;
+	if (CustomTypes.isRequired(key))
+		return TRUE;
 	return pass;
 }
 
@@ -0,0 +1,76 @@
+/*
+**	Command & Conquer Generals Zero Hour(tm)
+**	Copyright 2026 TheSuperHackers
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// FILE: DesyncBisect.h ///////////////////////////////////////////////////////////////////////////
+// Desc:   Writes the CRC of every object and every module at each logic CRC frame, so that the
+//         desyncdiff tool can find the first object and module that differs between two runs.
+//         See Common/DesyncBisectFormat.h for the file format.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "Common/AsciiString.h"
+#include "Common/DesyncBisectFormat.h"
+#include "Common/GameType.h"
+#include "Common/STLTypedefs.h"
+
+class Object;
+
+//-------------------------------------------------------------------------------------------------
+class DesyncBisectWriter
+{
+public:
+
+	DesyncBisectWriter();
+	~DesyncBisectWriter();
+
+	Bool open(const AsciiString& filename);
+	void close();	///< write the index and close the file
+	Bool isOpen() const { return m_file != nullptr; }
+
+	/// Record the CRCs of the current game state. logicCRC is the CRC that GameLogic computed for this frame.
+	void recordFrame(UnsignedInt frame, UnsignedInt logicCRC);
+
+private:
+
+	typedef std::vector<DesyncBisect::Entry> EntryList;
+
+	struct ObjectRecord
+	{
+		UnsignedInt templateName;
+		EntryList entries;
+		UnsignedInt seenFrame;
+	};
+
+	typedef std::hash_map< ObjectID, ObjectRecord, rts::hash<ObjectID>, rts::equal_to<ObjectID> > ObjectRecordMap;
+	typedef std::hash_map< AsciiString, UnsignedInt, rts::hash<AsciiString>, rts::equal_to<AsciiString> > StringMap;
+
+	UnsignedInt getString(const AsciiString& str);	///< string number, writes a string record for new strings
+	void collectObjectEntries(Object *obj, EntryList& entries);
+	void collectGlobalEntries(EntryList& entries);
+	void addObject(ObjectID id, UnsignedInt templateName, const EntryList& entries, UnsignedInt frame);
+	void writeRecordHeader(UnsignedInt type, UnsignedInt size);
+	void write(const void *data, size_t size);
+
+	FILE *m_file;
+	StringMap m_strings;
+	ObjectRecordMap m_objects;										///< entries as of the last written frame
+	std::vector<UnsignedByte> m_frameData;							///< objects of the frame that is being recorded
+	UnsignedInt m_frameObjectCount;
+	std::vector<DesyncBisect::IndexEntry> m_index;
+};
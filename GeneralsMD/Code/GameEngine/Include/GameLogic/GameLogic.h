@@ -62,6 +62,7 @@ class WindowLayout;
 class TerrainLogic;
 class GhostObjectManager;
 class CommandButton;
+class DesyncBisectWriter;
 enum BuildableStatus CPP_11(: Int);
 
 
@@ -310,6 +311,7 @@ private:
 	// CRC cache system -----------------------------------------------------------------------------
 	UnsignedInt	m_CRC;																			///< Cache of previous CRC value
 	std::map<Int, UnsignedInt> m_cachedCRCs;								///< CRCs we've seen this frame
+	DesyncBisectWriter *m_desyncBisect;												///< Writes per object CRCs when TheGlobalData->m_desyncBisectFile is set
 	Bool m_shouldValidateCRCs;															///< Should we validate CRCs this frame?
 	//-----------------------------------------------------------------------------------------------
 	//Bool m_loadingScene;
@@ -827,6 +827,9 @@ private:
 	// AI -------------------------------------------------------------------------------------------
 	AttitudeType	m_attitude;
 	UnsignedInt		m_nextMoodCheckTime;
+#if ENABLE_TARGET_SCAN_BUDGET
+	UnsignedInt		m_targetScanTicket;										///< place in line while waiting for a target scan, see AI::requestTargetScan
+#endif
 	//UnsignedInt		m_locoClumpScanFrame;
 
 	// Common AI "status" effects -------------------------------------------------------------------
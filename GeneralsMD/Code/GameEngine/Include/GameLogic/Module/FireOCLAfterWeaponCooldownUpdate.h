@@ -62,6 +62,9 @@ public:
 	FireOCLAfterWeaponCooldownUpdate( Thing *thing, const ModuleData* moduleData );
 	// virtual destructor prototype provided by memory pool declaration
 
+	// module methods
+	static Int getInterfaceMask() { return UpdateModule::getInterfaceMask() | MODULEINTERFACE_UPGRADE; }
+
 	// BehaviorModule
 	virtual UpgradeModuleInterface* getUpgrade() { return this; }
 
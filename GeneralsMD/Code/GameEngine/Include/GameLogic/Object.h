@@ -37,6 +37,7 @@
 #include "Common/SpecialPowerMaskType.h"
 #include "Common/DisabledTypes.h"
 #include "Common/Thing.h"
+#include "Common/CustomFlagRegistry.h"
 #include "Common/ObjectStatusTypes.h"
 #include "Common/Upgrade.h"
 #include "Common/MessageStream.h"
@@ -50,6 +51,11 @@
 #include "GameLogic/Module/StealthUpdate.h"
 #include "GameLogic/Module/BodyModule.h" // Subdual Helper Data
 
+#if RETAIL_COMPATIBLE_CRC
+#undef ENABLE_INCREMENTAL_CRC
+#define ENABLE_INCREMENTAL_CRC (0)
+#endif
+
 //-----------------------------------------------------------------------------
 //           Forward References
 //-----------------------------------------------------------------------------
@@ -81,6 +87,7 @@ class ExperienceTracker;
 class FiringTracker;
 class HijackerUpdateInterface;
 class Module;
+struct ModuleDispatch;
 class OCLUpdate;
 class PartitionData;
 class PhysicsBehavior;
@@ -215,6 +222,17 @@ public:
 
 	void updateObjValuesFromMapProperties(Dict* properties);			///< Brings in properties set in the editor.
 
+	/// Must be called whenever state that is part of crc() changes, so that the cached CRC is rebuilt
+	void markCRCDirty() const
+	{
+#if ENABLE_INCREMENTAL_CRC
+		m_crcDirty = TRUE;
+#endif
+	}
+#if ENABLE_INCREMENTAL_CRC
+	void xferIncrementalCRC( Xfer *xfer );												///< CRC this object using its cached state CRC
+#endif
+
 	// ids and binding
 	ObjectID getID() const { return m_id; }												///< this object's unique ID
 	void friend_bindToDrawable( Drawable *draw );									///< set drawable association. for use ONLY by GameLogic!
@@ -353,6 +371,10 @@ public:
 
 	BehaviorModule** getBehaviorModules() const { return m_behaviors; }
 
+	// TheSuperHackers @performance The modules of one interface, in module order, without asking every module for it.
+	Int getDispatchModuleCount( ModuleDispatchType type ) const;
+	BehaviorModule* getDispatchModule( ModuleDispatchType type, Int index ) const;
+
 	BodyModuleInterface* getBodyModule() const { return m_body; }
 	ContainModuleInterface* getContain() const { return m_contain; }
   StealthUpdate*          getStealth() const { return m_stealth; }
@@ -666,10 +688,13 @@ public:
 	Bool isCurWeaponLockedPriority() const { return m_weaponSet.isCurWeaponLockedPriority(); }
 
 	//const ObjectCustomStatusType *getCustomStatus() const { return &m_customStatus; }
-	std::vector<AsciiString> getCustomStatus() const { return m_customStatusSet; }
-	void setCustomStatusFlags( const std::vector<AsciiString>& customStatusSetVec ) { m_customStatusSet = customStatusSetVec; } 
+	const std::vector<AsciiString>& getCustomStatus() const { return m_customStatusSet; }
+	const CustomFlagSet& getCustomStatusFlags() const { return m_customStatusFlags; }
+	void copyCustomStatusFrom( const Object* other ) { m_customStatusSet = other->m_customStatusSet; m_customStatusFlags = other->m_customStatusFlags; }
 	Bool testCustomStatus(const AsciiString& cst) const;
 	Bool testCustomStatusForAll(const std::vector<AsciiString>& cst) const;
+	Bool testCustomStatusForAll(const CustomFlagSet& cst) const { return m_customStatusFlags.testAll(cst); }
+	Bool testCustomStatusForAny(const CustomFlagSet& cst) const { return m_customStatusFlags.testAny(cst); }
 
 
 	void setArmorSetFlag(ArmorSetType ast);
@@ -688,12 +713,12 @@ public:
 	void clearCustomWeaponBonusCondition(const AsciiString& cst, Bool setIgnoreClear = TRUE);
 
 	// Weapon Bonus Ignore Clear for Designators towards bonuses registered onto Helpers,  i.e. like Target Designator logic
-	inline void setWeaponBonusConditionIgnoreClear(WeaponBonusConditionType wst) { m_weaponBonusConditionIC.set(wst); }
-	inline void clearWeaponBonusConditionIgnoreClear(WeaponBonusConditionType wst) { m_weaponBonusConditionIC.set(wst, 0); }
+	inline void setWeaponBonusConditionIgnoreClear(WeaponBonusConditionType wst) { m_weaponBonusConditionIC.set(wst); markCRCDirty(); }
+	inline void clearWeaponBonusConditionIgnoreClear(WeaponBonusConditionType wst) { m_weaponBonusConditionIC.set(wst, 0); markCRCDirty(); }
 
 	Bool testWeaponBonusConditionIgnoreClear(WeaponBonusConditionType wst) const { return m_weaponBonusConditionIC.test(wst); }
 	inline WeaponBonusConditionFlags getWeaponBonusConditionIgnoreClear() const { return m_weaponBonusConditionIC; }
-	inline void setWeaponBonusConditionFlagsIgnoreClear(WeaponBonusConditionFlags flags) { m_weaponBonusConditionIC = flags; }
+	inline void setWeaponBonusConditionFlagsIgnoreClear(WeaponBonusConditionFlags flags) { m_weaponBonusConditionIC = flags; markCRCDirty(); }
 	void setCustomWeaponBonusConditionIgnoreClear(const AsciiString& cst);
 	void clearCustomWeaponBonusConditionIgnoreClear(const AsciiString& cst);
 	
@@ -702,18 +727,18 @@ public:
 	Bool testWeaponBonusCondition(WeaponBonusConditionType wst) const { return m_weaponBonusCondition.test(wst); }
 
 	inline WeaponBonusConditionFlags getWeaponBonusCondition() const { return m_weaponBonusCondition; }
-	inline void setWeaponBonusConditionFlags(WeaponBonusConditionFlags flags) { m_weaponBonusCondition = flags; }
+	inline void setWeaponBonusConditionFlags(WeaponBonusConditionFlags flags) { m_weaponBonusCondition = flags; markCRCDirty(); }
 
 	void applyWeaponBonusConditionFlags(WeaponBonusConditionFlags flags);
 	void removeWeaponBonusConditionFlags(WeaponBonusConditionFlags flags);
 
 	// Weapon Bonus Against,  i.e. like Target Designator logic
-	inline void setWeaponBonusConditionAgainst(WeaponBonusConditionType wst) { m_weaponBonusConditionAgainst.set(wst); }
-	inline void clearWeaponBonusConditionAgainst(WeaponBonusConditionType wst) { m_weaponBonusConditionAgainst.set(wst, 0); }
+	inline void setWeaponBonusConditionAgainst(WeaponBonusConditionType wst) { m_weaponBonusConditionAgainst.set(wst); markCRCDirty(); }
+	inline void clearWeaponBonusConditionAgainst(WeaponBonusConditionType wst) { m_weaponBonusConditionAgainst.set(wst, 0); markCRCDirty(); }
 
 	Bool testWeaponBonusConditionAgainst(WeaponBonusConditionType wst) const { return m_weaponBonusConditionAgainst.test(wst); }
 	inline WeaponBonusConditionFlags getWeaponBonusConditionAgainst() const { return m_weaponBonusConditionAgainst; }
-	inline void setWeaponBonusConditionFlagsAgainst(WeaponBonusConditionFlags flags) { m_weaponBonusConditionAgainst = flags; }
+	inline void setWeaponBonusConditionFlagsAgainst(WeaponBonusConditionFlags flags) { m_weaponBonusConditionAgainst = flags; markCRCDirty(); }
 	void applyCustomWeaponBonusConditionFlags(const std::vector<AsciiString>& flags);
 	void removeCustomWeaponBonusConditionFlags(const std::vector<AsciiString>& flags);
 
@@ -721,19 +746,19 @@ public:
 	void clearCustomWeaponBonusConditionAgainst(const AsciiString& cst);
 	Bool testCustomWeaponBonusConditionAgainst(const AsciiString& cst) const;
 	//const ObjectCustomStatusType *getCustomWeaponBonusConditionAgainst() const { return &m_customWeaponBonusConditionAgainst; }
-	std::vector<AsciiString> getCustomWeaponBonusConditionAgainst() const { return m_customWeaponBonusConditionAgainst; }
+	const std::vector<AsciiString>& getCustomWeaponBonusConditionAgainst() const { return m_customWeaponBonusConditionAgainst; }
 	void setCustomWeaponBonusConditionFlagsAgainst(const std::vector<AsciiString>& flags) { m_customWeaponBonusConditionAgainst = flags; }
 
 
 	//const ObjectCustomStatusType *getCustomWeaponBonusCondition() const { return &m_customWeaponBonusCondition; }
-	std::vector<AsciiString> getCustomWeaponBonusCondition() const { return m_customWeaponBonusCondition; }
+	const std::vector<AsciiString>& getCustomWeaponBonusCondition() const { return m_customWeaponBonusCondition; }
 	// TO-DO: Change to Hash_Map. DONE.
 	/// Reverted to use Vector.
 	void setCustomWeaponBonusConditionFlags(const std::vector<AsciiString>& customFlags) { m_customWeaponBonusCondition = customFlags; }
 	Bool testCustomWeaponBonusCondition(const AsciiString& cst) const;
 
 	//const ObjectCustomStatusType *getCustomWeaponBonusConditionIgnoreClear() const { return &m_customWeaponBonusConditionIC; }
-	std::vector<AsciiString> getCustomWeaponBonusConditionIgnoreClear() const { return m_customWeaponBonusConditionIC; }
+	const std::vector<AsciiString>& getCustomWeaponBonusConditionIgnoreClear() const { return m_customWeaponBonusConditionIC; }
 	//void setCustomWeaponBonusConditionFlagsIgnoreClear(ObjectCustomStatusType map) { m_customWeaponBonusConditionIC = map; }
 	void setCustomWeaponBonusConditionFlagsIgnoreClear(const std::vector<AsciiString>& vec) { m_customWeaponBonusConditionIC = vec; }
 
@@ -990,6 +1015,9 @@ protected:
 	void xfer( Xfer *xfer );
 	void loadPostProcess();
 
+	void crcState( Xfer *xfer );
+	void crcWeapons( Xfer *xfer );
+
 	void handleShroud();
 	void handleValueMap();
 	void handleThreatMap();
@@ -999,6 +1027,10 @@ protected:
 	// It will go away someday. Yeah, right. Just like GlobalData.
 	Module* findModule(NameKeyType key) const;
 
+#ifdef DEBUG_CRASHING
+	void validateModuleDispatch() const;
+#endif
+
 	Bool didEnterOrExit() const;
 
 	void setID( ObjectID id );
@@ -1047,7 +1079,8 @@ private:
 	Object *			m_prev;
 	ObjectStatusMaskType		m_status;									///< status bits (see ObjectStatusMaskType)
 	//ObjectCustomStatusType		m_customStatus;	
-	std::vector<AsciiString>	m_customStatusSet;
+	std::vector<AsciiString>	m_customStatusSet;					///< custom statuses in the order they were set, used for iteration and xfer
+	CustomFlagSet							m_customStatusFlags;				///< the same custom statuses as interned bits, used for testing
 
 	ObjectID			m_shielderID;
 	ObjectID			m_shieldingID;
@@ -1105,6 +1138,8 @@ private:
 
 	// modules
 	BehaviorModule**							m_behaviors;	// BehaviorModule, not BehaviorModuleInterface
+	const ModuleDispatch*					m_moduleDispatch;				///< where the template modules of each interface and name are, shared by all objects of the template
+	Short													m_firstTemplateModule;	///< the number of helper modules in front of the template modules in m_behaviors
 
 	// cache these, for convenience
 	ContainModuleInterface*				m_contain;
@@ -1216,6 +1251,10 @@ private:
 	Bool													m_singleUseCommandUsed;
 	Bool													m_isReceivingDifficultyBonus;
 	Bool													m_parasiteCollideActive;
+#if ENABLE_INCREMENTAL_CRC
+	mutable Bool									m_crcDirty;							///< state covered by crcState() changed since m_cachedCRC was computed
+	UnsignedInt										m_cachedCRC;						///< CRC of crcState(), valid when not dirty
+#endif
 
 	std::vector<AsciiString>						m_rejectKeys;
 	std::vector<ObjectID> 							m_equipObjIDs;
@@ -52,6 +52,7 @@
 #include "Common/GameCommon.h"	// ensure we get DUMP_PERF_STATS, or not
 #include "GameLogic/ObjectIter.h"
 #include "Common/ObjectStatusTypes.h"
+#include "Common/CustomFlagRegistry.h"
 #include "Common/KindOf.h"
 #include "Common/Snapshot.h"
 #include "Common/Geometry.h"
@@ -316,13 +317,13 @@ class PartitionCell : public Snapshot	// not MPO: allocated in an array
 {
 private:
 	CellAndObjectIntersection*		m_firstCoiInCell;	///< list of COIs in this cell (may be null).
-	ShroudLevel										m_shroudLevel[MAX_PLAYER_COUNT];
 #ifdef PM_CACHE_TERRAIN_HEIGHT
 	Real													m_loTerrainZ;			///< lowest terrain-pt in this cell
 	Real													m_hiTerrainZ;			///< highest terrain-pt in this cell
 #endif
 	Int														m_threatValue[MAX_PLAYER_COUNT];
 	Int														m_cashValue[MAX_PLAYER_COUNT];
+	KindOfMaskType								m_kindOfAny;				///< every KindOf of the objects in this cell, may keep bits of objects that left
 	Short													m_coiCount;					///< number of COIs in this cell.
 	Short													m_cellX;						///< x-coord of this cell within the Partition Mgr coords (NOT in world coords)
 	Short													m_cellY;						///< y-coord of this cell within the Partition Mgr coords (NOT in world coords)
@@ -373,6 +374,15 @@ public:
 
 	CellAndObjectIntersection *getFirstCoiInCell() { return m_firstCoiInCell; }
 
+	/// FALSE if no object in this cell can have all of the given KindOf bits
+	Bool mayContainKindOf(const KindOfMaskType& mustBeSet) const { return TEST_KINDOFMASK_MULTI(m_kindOfAny, mustBeSet, KINDOFMASK_NONE); }
+
+	// intended only for CellAndObjectIntersection.
+	void friend_addKindOf(const KindOfMaskType& kindOf) { m_kindOfAny.set(kindOf); }
+
+	/// Replace the KindOf summary with the exact one, gathered by a query that visited every COI in this cell.
+	void friend_setKindOfAny(const KindOfMaskType& kindOf) { m_kindOfAny = kindOf; }
+
 	#ifdef RTS_DEBUG
 	void validateCoiList();
 	#endif
@@ -602,6 +612,27 @@ public:
 
 };
 
+//=====================================
+/**
+	TheSuperHackers @performance The mask tests of a filter chain, gathered once per query by
+	PartitionFilter::addMasks. They are tested without a virtual call per filter, and the KindOf bits
+	that must be set let getClosestObjects skip whole cells.
+*/
+struct PartitionFilterMasks
+{
+	KindOfMaskType m_kindOfMustBeSet;
+	KindOfMaskType m_kindOfMustBeClear;
+	ObjectStatusMaskType m_statusMustBeSet;
+	ObjectStatusMaskType m_statusMustBeClear;
+	Bool m_rejectDead;
+
+	PartitionFilterMasks() : m_rejectDead(FALSE) { }
+
+	Bool allow(const Object *objOther) const;
+	Bool allowCell(const PartitionCell *cell) const { return cell->mayContainKindOf(m_kindOfMustBeSet); }
+	Bool hasCellMask() const { return m_kindOfMustBeSet.any(); }
+};
+
 //=====================================
 /**
 	this is an ABC. PartitionData::iterate allows you to pass multiple filters
@@ -615,6 +646,10 @@ class PartitionFilter
 {
 public:
 	virtual Bool allow(Object *objOther) = 0;
+	/// Add this filter to the masks and return TRUE if the masks now do all its work, so allow need not be called.
+	virtual Bool addMasks(PartitionFilterMasks& masks) const { return FALSE; }
+	/// TRUE if allow changes game state. Mask tests are never moved ahead of such a filter, so it sees the same objects as before.
+	virtual Bool hasSideEffects() const { return FALSE; }
 #if defined(RTS_DEBUG)
 	virtual const char* debugGetName() = 0;
 #endif
@@ -849,6 +884,7 @@ private:
 public:
 	PartitionFilterAcceptByObjectStatus( ObjectStatusMaskType mustBeSet, ObjectStatusMaskType mustBeClear) : m_mustBeSet(mustBeSet), m_mustBeClear(mustBeClear) { }
 	virtual Bool allow(Object *objOther);
+	virtual Bool addMasks(PartitionFilterMasks& masks) const;
 #if defined(RTS_DEBUG)
 	virtual const char* debugGetName() { return "PartitionFilterAcceptByObjectStatus"; }
 #endif
@@ -861,9 +897,10 @@ public:
 class PartitionFilterAcceptByObjectCustomStatus : public PartitionFilter
 {
 private:
-	std::vector<AsciiString> m_mustBeSet, m_mustBeClear;
+	CustomFlagSet m_mustBeSet, m_mustBeClear;
+	Bool m_mustBeSetIsKnown;	///< false if a required status was never set on anything, so nothing can pass
 public:
-	PartitionFilterAcceptByObjectCustomStatus( std::vector<AsciiString> mustBeSet, std::vector<AsciiString> mustBeClear) : m_mustBeSet(mustBeSet), m_mustBeClear(mustBeClear) { }
+	PartitionFilterAcceptByObjectCustomStatus( const std::vector<AsciiString>& mustBeSet, const std::vector<AsciiString>& mustBeClear);
 	virtual Bool allow(Object *objOther);
 #if defined(RTS_DEBUG)
 	virtual const char* debugGetName() { return "PartitionFilterAcceptByObjectCustomStatus"; }
@@ -885,6 +922,7 @@ public:
 	{
 	}
 	virtual Bool allow(Object *objOther);
+	virtual Bool addMasks(PartitionFilterMasks& masks) const;
 #if defined(RTS_DEBUG)
 	virtual const char* debugGetName() { return "PartitionFilterRejectByObjectStatus"; }
 #endif
@@ -918,6 +956,7 @@ private:
 public:
 	PartitionFilterAcceptByKindOf(const KindOfMaskType& mustBeSet, const KindOfMaskType& mustBeClear) : m_mustBeSet(mustBeSet), m_mustBeClear(mustBeClear) { }
 	virtual Bool allow(Object *objOther);
+	virtual Bool addMasks(PartitionFilterMasks& masks) const;
 #if defined(RTS_DEBUG)
 	virtual const char* debugGetName() { return "PartitionFilterAcceptByKindOf"; }
 #endif
@@ -938,6 +977,7 @@ public:
 	{
 	}
 	virtual Bool allow(Object *objOther);
+	virtual Bool addMasks(PartitionFilterMasks& masks) const;
 #if defined(RTS_DEBUG)
 	virtual const char* debugGetName() { return "PartitionFilterRejectByKindOf"; }
 #endif
@@ -968,6 +1008,7 @@ class PartitionFilterAlive : public PartitionFilter
 {
 public:
 	PartitionFilterAlive(void) { }
+	virtual Bool addMasks(PartitionFilterMasks& masks) const;
 protected:
 	virtual Bool allow(Object *objOther);
 #if defined(RTS_DEBUG)
@@ -1301,6 +1342,13 @@ private:
 	Int							m_cellCountY;			///< number of cells, y
 	Int							m_totalCellCount;	///< x * y
 	PartitionCell*	m_cells;					///< array of cells
+
+	// TheSuperHackers @performance The shroud of each player is kept in planes of one value per cell, in the
+	// order of m_cells, instead of in the cells. A reveal then walks a row of cells in one tight loop.
+	Short*					m_shroudPlanes;																///< storage of the planes below
+	Short*					m_currentShroud[MAX_PLAYER_COUNT];						///< ShroudLevel::m_currentShroud of each cell
+	Short*					m_activeShroudLevel[MAX_PLAYER_COUNT];				///< ShroudLevel::m_activeShroudLevel of each cell
+
 	PartitionData*	m_dirtyModules;
 	Bool						m_updatedSinceLastReset;	///< Used to force a return of OBJECTSHROUD_INVALID before update has been called.
 
@@ -1315,7 +1363,7 @@ protected:
 
 	/**
 		This is an internal function that is used to implement the public
-		getClosestObject and iterateObjects calls.
+		getClosestObject, queryObjects and iterateObjects calls.
 	*/
 	Object *getClosestObjects(
 		const Object *obj,
@@ -1323,7 +1371,7 @@ protected:
 		Real maxDist,
 		DistanceCalculationType dc,
 		PartitionFilter **filters,
-		SimpleObjectIterator *iter,	// if nonnull, append ALL satisfactory objects to the iterator (not just the single closest)
+		ObjectQueryResults *results,	// if nonnull, append ALL satisfactory objects to the results (not just the single closest)
 		Real *closestDistArg,
 		Coord3D *closestVecArg
 	);
@@ -1339,7 +1387,7 @@ protected:
 		const ObjectCreationList *railgunocl,
 		DistanceCalculationType dc,
 		PartitionFilter **filters,
-		SimpleObjectIterator *iter,
+		ObjectQueryResults *results,
 		Bool checkBehind,
 		Real *closestDistArg,
 		Coord3D *closestVecArg
@@ -1355,7 +1403,7 @@ protected:
 		Real dirAngle,
 		DistanceCalculationType dc,
 		PartitionFilter **filters,
-		SimpleObjectIterator *iter,
+		ObjectQueryResults *results,
 		Bool checkBehind,
 		Real *closestDistArg,
 		Coord3D *closestDistVec
@@ -1393,6 +1441,20 @@ protected:
 	friend void hLineAddValue(Int x1, Int x2, Int y, void *threatValueParms);
 	friend void hLineRemoveValue(Int x1, Int x2, Int y, void *threatValueParms);
 
+	// The shroud of the cells x1 to x2 of row y, which must be inside the map.
+	void addLookers( Int playerIndex, Int y, Int x1, Int x2 );
+	void removeLookers( Int playerIndex, Int y, Int x1, Int x2 );
+	void addShrouders( Int playerIndex, Int y, Int x1, Int x2 );
+	void removeShrouders( Int playerIndex, Int y, Int x1, Int x2 );
+	void shroudStatusChanged( Int playerIndex, Int cellIndex, CellShroudStatus newShroud, Bool isLocalPlayer );
+	CellShroudStatus getCellShroudStatus( Int playerIndex, Int cellIndex ) const;
+
+	// The shroud of a cell in the order PartitionCell saves and checksums it.
+	void getShroudLevels( Int cellIndex, ShroudLevel *shroudLevels ) const;
+	void setShroudLevels( Int cellIndex, const ShroudLevel *shroudLevels );
+
+	friend class PartitionCell;
+
 	void processPendingUndoShroudRevealQueue(Bool considerTimestamp = TRUE);				///< keep popping and processing until you get to one that is in the future
 	void resetPendingUndoShroudRevealQueue();					///< Just delete everything in the queue without doing anything with them
 
@@ -1498,6 +1560,50 @@ public:
 	void getPMStats(double& gcoTimeThisFrameTotal, double& gcoTimeThisFrameAvg);
 #endif
 
+	// TheSuperHackers @performance The query calls fill the results in place and allocate nothing for
+	// typical counts. The iterate calls return the same objects in the same order in a new iterator.
+	void queryObjectsInRange(
+		const Object *obj,
+		Real maxDist,
+		DistanceCalculationType dc,
+		ObjectQueryResults &results,
+		PartitionFilter **filters = nullptr,
+		IterOrderType order = ITER_FASTEST
+	);
+
+	void queryObjectsInRange(
+		const Coord3D *pos,
+		Real maxDist,
+		DistanceCalculationType dc,
+		ObjectQueryResults &results,
+		PartitionFilter **filters = nullptr,
+		IterOrderType order = ITER_FASTEST
+	);
+
+	void queryPotentialCollisions(
+		const Coord3D* pos,
+		const GeometryInfo& geom,
+		Real angle,
+		ObjectQueryResults &results,
+		Bool use2D = false
+	);
+
+	void queryObjectsAlongLine(
+		const Object* source,
+		const Coord3D *pos,
+		const Coord3D *posOther,
+		Real radius,
+		Real infantryRadius,
+		Real checkPerDistance,
+		const FXList* railgunfx,
+		const ObjectCreationList *railgunocl,
+		DistanceCalculationType dc,
+		ObjectQueryResults &results,
+		Bool checkBehind = FALSE,
+		PartitionFilter **filters = nullptr,
+		IterOrderType order = ITER_FASTEST
+	);
+
 	SimpleObjectIterator *iterateObjectsInRange(
 		const Object *obj,
 		Real maxDist,
@@ -1639,8 +1745,6 @@ public:
 	void storeFoggedCells(ShroudStatusStoreRestore &outPartitionStore, Bool storeToFog) const;
 	void restoreFoggedCells(const ShroudStatusStoreRestore &inPartitionStore, Bool restoreToFog);
 
-	std::list<Drawable*> getDrawablesInRegion( IRegion2D *region2D );
-	std::list<Drawable*> getDrawablesInRegionEfficient();
 	Bool hasNoOffset() const { return m_radiusVec.empty(); }
 };
 
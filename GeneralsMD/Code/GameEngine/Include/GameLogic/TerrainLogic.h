@@ -234,6 +234,7 @@ public:
 
 	virtual Real getGroundHeight( Real x, Real y, Coord3D* normal = nullptr )  const;
 	virtual Real getLayerHeight(Real x, Real y, PathfindLayerEnum layer, Coord3D* normal = nullptr, Bool clip = true) const;
+	virtual void getGroundHeights( const Coord2D *points, Real *heights, Int count ) const;	///< getGroundHeight for many points, without normals
 	virtual void getExtent( Region3D *extent ) const { DEBUG_CRASH(("not implemented"));  }		///< @todo This should not be a stub - this should own this functionality
 	virtual void getExtentIncludingBorder( Region3D *extent ) const { DEBUG_CRASH(("not implemented"));  }		///< @todo This should not be a stub - this should own this functionality
 	virtual void getMaximumPathfindExtent( Region3D *extent ) const { DEBUG_CRASH(("not implemented"));  }		///< @todo This should not be a stub - this should own this functionality
@@ -327,6 +328,9 @@ public:
 	Int getActiveBoundary(void) { return m_activeBoundary; }
 	void setActiveBoundary(Int newActiveBoundary);
 
+	virtual Int getRawMapHeight( const ICoord2D *gridPos ) const;			///< height map sample at a grid position
+	virtual void setRawMapHeight( const ICoord2D *gridPos, Int height );	///< lowers the height map sample at a grid position, never raises it
+
   void flattenTerrain(Object *obj);  ///< Flatten the terrain under a building.
   void createCraterInTerrain(Object *obj);  ///< Flatten the terrain under a building.
 
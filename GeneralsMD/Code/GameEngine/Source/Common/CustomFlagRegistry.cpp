@@ -0,0 +1,142 @@
+/*
+**	Command & Conquer Generals Zero Hour(tm)
+**	Copyright 2026 TheSuperHackers
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// FILE: CustomFlagRegistry.cpp ///////////////////////////////////////////////////////////////////
+// Desc:   Interns custom status names into dense indices
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "PreRTS.h"	// This must go first in EVERY cpp file in the GameEngine
+
+#include "Common/CustomFlagRegistry.h"
+
+// Public Data ////////////////////////////////////////////////////////////////////////////////////
+CustomFlagRegistry *TheCustomStatusRegistry = nullptr;
+
+//-------------------------------------------------------------------------------------------------
+Bool CustomFlagSet::set(Int index, Bool value)
+{
+	if (index < 0)
+		return FALSE;
+
+	const size_t word = (size_t)index / BITS_PER_WORD;
+	const UnsignedInt mask = 1u << (index % BITS_PER_WORD);
+
+	if (word >= m_words.size())
+	{
+		if (!value)
+			return FALSE;
+		m_words.resize(word + 1, 0);
+	}
+
+	const UnsignedInt oldWord = m_words[word];
+	if (value)
+		m_words[word] |= mask;
+	else
+		m_words[word] &= ~mask;
+
+	return oldWord != m_words[word];
+}
+
+//-------------------------------------------------------------------------------------------------
+Bool CustomFlagSet::testAll(const CustomFlagSet& other) const
+{
+	for (size_t i = 0; i < other.m_words.size(); ++i)
+	{
+		const UnsignedInt mine = i < m_words.size() ? m_words[i] : 0;
+		if ((other.m_words[i] & mine) != other.m_words[i])
+			return FALSE;
+	}
+	return TRUE;
+}
+
+//-------------------------------------------------------------------------------------------------
+Bool CustomFlagSet::testAny(const CustomFlagSet& other) const
+{
+	const size_t count = min(m_words.size(), other.m_words.size());
+	for (size_t i = 0; i < count; ++i)
+	{
+		if (m_words[i] & other.m_words[i])
+			return TRUE;
+	}
+	return FALSE;
+}
+
+//-------------------------------------------------------------------------------------------------
+Bool CustomFlagSet::any() const
+{
+	for (size_t i = 0; i < m_words.size(); ++i)
+	{
+		if (m_words[i])
+			return TRUE;
+	}
+	return FALSE;
+}
+
+//-------------------------------------------------------------------------------------------------
+Bool CustomFlagSet::operator==(const CustomFlagSet& other) const
+{
+	const size_t count = max(m_words.size(), other.m_words.size());
+	for (size_t i = 0; i < count; ++i)
+	{
+		const UnsignedInt mine = i < m_words.size() ? m_words[i] : 0;
+		const UnsignedInt theirs = i < other.m_words.size() ? other.m_words[i] : 0;
+		if (mine != theirs)
+			return FALSE;
+	}
+	return TRUE;
+}
+
+//-------------------------------------------------------------------------------------------------
+Int CustomFlagRegistry::intern(const AsciiString& name)
+{
+	DEBUG_ASSERTCRASH(!name.isEmpty(), ("CustomFlagRegistry::intern - empty names are not allowed"));
+
+	IndexMap::const_iterator it = m_indices.find(name);
+	if (it != m_indices.end())
+		return it->second;
+
+	const Int index = (Int)m_names.size();
+	m_names.push_back(name);
+	m_indices[name] = index;
+	return index;
+}
+
+//-------------------------------------------------------------------------------------------------
+Int CustomFlagRegistry::find(const AsciiString& name) const
+{
+	IndexMap::const_iterator it = m_indices.find(name);
+	if (it != m_indices.end())
+		return it->second;
+
+	return INVALID_INDEX;
+}
+
+//-------------------------------------------------------------------------------------------------
+Bool CustomFlagRegistry::findSet(const std::vector<AsciiString>& names, CustomFlagSet& set) const
+{
+	Bool allKnown = TRUE;
+	for (std::vector<AsciiString>::const_iterator it = names.begin(); it != names.end(); ++it)
+	{
+		const Int index = find(*it);
+		if (index == INVALID_INDEX)
+			allKnown = FALSE;
+		else
+			set.set(index);
+	}
+	return allKnown;
+}
@@ -32,6 +32,7 @@
 #include "Common/AudioAffect.h"
 #include "Common/BuildAssistant.h"
 #include "Common/CRCDebug.h"
+#include "Common/CustomFlagRegistry.h"
 #include "Common/FramePacer.h"
 #include "Common/Radar.h"
 #include "Common/PlayerTemplate.h"
@@ -50,6 +51,7 @@
 #include "Common/ChatCommand.h"
 #include "Common/GlobalData.h"
 #include "Common/PerfTimer.h"
+#include "Common/PerfTrace.h"
 #include "Common/RandomValue.h"
 #include "Common/NameKeyGenerator.h"
 #include "Common/ModuleFactory.h"
@@ -69,6 +71,7 @@
 #include "Common/Xfer.h"
 #include "Common/XferCRC.h"
 #include "Common/GameLOD.h"
+#include "Common/WorkerThreadPool.h"
 #include "Common/Registry.h"
 #include "Common/GameCommon.h"	// FOR THE ALLOW_DEBUG_CHEATS_IN_RELEASE #define
 #include "Common/MapData.h"
@@ -289,9 +292,15 @@ GameEngine::~GameEngine()
 	delete TheNameKeyGenerator;
 	TheNameKeyGenerator = nullptr;
 
+	delete TheCustomStatusRegistry;
+	TheCustomStatusRegistry = nullptr;
+
 	delete TheFileSystem;
 	TheFileSystem = nullptr;
 
+	delete TheWorkerThreadPool;
+	TheWorkerThreadPool = nullptr;
+
 	delete TheGameLODManager;
 	TheGameLODManager = nullptr;
 
@@ -302,6 +311,10 @@ GameEngine::~GameEngine()
 #ifdef PERF_TIMERS
 	PerfGather::termPerfDump();
 #endif
+
+#if ENABLE_PERF_TRACE
+	PerfTrace::close();
+#endif
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -375,6 +388,10 @@ void GameEngine::init()
 	#ifdef PERF_TIMERS
 		PerfGather::initPerfDump("AAAPerfStats", PerfGather::PERF_NETTIME);
 	#endif
+	#if ENABLE_PERF_TRACE
+		if (!TheGlobalData->m_perfTraceFile.isEmpty())
+			PerfTrace::open(TheGlobalData->m_perfTraceFile.str(), TheGlobalData->m_perfTraceMinTime);
+	#endif
 
 
 
@@ -398,10 +415,17 @@ void GameEngine::init()
 		// Create the low-level file system interface
 		TheFileSystem = createFileSystem();
 
+		// not part of the subsystem list, because it keeps no state between the jobs it runs
+		TheWorkerThreadPool = MSGNEW("GameEngineSubsystem") WorkerThreadPool;
+		TheWorkerThreadPool->init();
+
 		// not part of the subsystem list, because it should normally never be reset!
 		TheNameKeyGenerator = MSGNEW("GameEngineSubsystem") NameKeyGenerator;
 		TheNameKeyGenerator->init();
 
+		// not part of the subsystem list either, interned custom status indices must stay valid
+		TheCustomStatusRegistry = MSGNEW("GameEngineSubsystem") CustomFlagRegistry;
+
 
     	#ifdef DUMP_PERF_STATS///////////////////////////////////////////////////////////////////////////
 	GetPrecisionTimer(&endTime64);//////////////////////////////////////////////////////////////////
@@ -912,6 +936,9 @@ void GameEngine::update( void )
 
 		if (canUpdateLogic)
 		{
+			// TheSuperHackers @feature Replay snapshots are taken and restored between logic frames.
+			TheRecorder->updateSnapshots();
+
 			TheGameClient->step();
 			TheGameLogic->UPDATE();
 		}
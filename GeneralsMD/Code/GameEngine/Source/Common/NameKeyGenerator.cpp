@@ -187,6 +187,21 @@ NameKeyType NameKeyGenerator::nameToLowercaseKey(const char *name)
 	return key;
 }
 
+//-------------------------------------------------------------------------------------------------
+NameKeyType NameKeyGenerator::findNameKey(const AsciiString& name) const
+{
+	const UnsignedInt hash = calcHashForString(name.str()) % SOCKET_COUNT;
+
+	const Bucket *b;
+	for (b = m_sockets[hash]; b; b = b->m_nextInSocket)
+	{
+		if (name.compare(b->m_nameString) == 0)
+			return b->m_key;
+	}
+
+	return NAMEKEY_INVALID;
+}
+
 //-------------------------------------------------------------------------------------------------
 NameKeyType NameKeyGenerator::nameToKeyImpl(const AsciiString& name)
 {
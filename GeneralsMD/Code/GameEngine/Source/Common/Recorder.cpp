@@ -47,6 +47,11 @@
 #include "Common/CRCDebug.h"
 #include "Common/OptionPreferences.h"
 #include "Common/version.h"
+#include "Common/GameState.h"
+#include "Common/LatchRestore.h"
+#include "Common/MessageStream.h"
+#include "Compression.h"
+#include "GameClient/GameClient.h"
 
 constexpr const char s_genrep[] = "GENREP";
 constexpr const UnsignedInt replayBufferBytes = 8192;
@@ -71,6 +76,9 @@ static const UnsignedInt desyncOffset = frameCountOffset + sizeof(UnsignedInt);
 static const UnsignedInt quitEarlyOffset = desyncOffset + sizeof(Bool);
 static const UnsignedInt disconOffset = quitEarlyOffset + sizeof(Bool);
 
+// TheSuperHackers @tweak Replay snapshots use at most this much memory. The oldest ones are dropped first.
+static const size_t maxReplaySnapshotBytes = 256 * 1024 * 1024;
+
 void RecorderClass::logGameStart(AsciiString options)
 {
 	if (!m_file)
@@ -372,6 +380,8 @@ RecorderClass::RecorderClass()
 	m_archiveReplays = FALSE;
 	m_nextFrame = 0;
 	m_wasDesync = FALSE;
+	m_seekFrame = -1;
+	m_isRestoringSnapshot = FALSE;
 	init(); // just for the heck of it.
 }
 
@@ -379,6 +389,7 @@ RecorderClass::RecorderClass()
  * Destructor
  */
 RecorderClass::~RecorderClass() {
+	clearSnapshots();
 }
 
 /**
@@ -413,6 +424,13 @@ void RecorderClass::init() {
  * Reset the recorder to the "initialized state."
  */
 void RecorderClass::reset() {
+	// TheSuperHackers @feature Loading a replay snapshot resets the game engine, but the playback continues.
+	if (m_isRestoringSnapshot)
+		return;
+
+	clearSnapshots();
+	m_seekFrame = -1;
+
 	if (m_file != nullptr) {
 		m_file->close();
 		m_file = nullptr;
@@ -475,6 +493,8 @@ void RecorderClass::stopPlayback() {
 		m_file = nullptr;
 	}
 	m_fileName.clear();
+	clearSnapshots();
+	m_seekFrame = -1;
 
 	if (!m_doingAnalysis)
 	{
@@ -1152,6 +1172,209 @@ void RecorderClass::handleCRCMessage(UnsignedInt newCRC, Int playerIndex, Bool f
 	//DEBUG_LOG(("RecorderClass::handleCRCMessage() - Skipping CRC of %8.8X from %d (our index is %d)", newCRC, playerIndex, localPlayerIndex));
 }
 
+// TheSuperHackers @feature A replay snapshot holds the complete game state at the start of a logic
+// frame, plus everything outside the save data that playback needs to continue from that frame.
+struct ReplaySnapshot
+{
+	ReplaySnapshot(const CRCInfo& crc) : crcInfo(crc) {}
+
+	UnsignedInt frame;										///< logic frame that runs next after restoring
+	Int filePosition;											///< replay file position after the frame number of the next command
+	UnsignedInt nextFrame;								///< frame of the next command in the replay file
+	CRCInfo crcInfo;											///< queued CRCs, because the replay CRC messages arrive late
+	GameLogicRandomState randomState;			///< not part of the save data
+	std::vector<UnsignedByte> data;				///< compressed save data
+};
+
+/**
+ * Take a snapshot that is due, or seek to the frame given to requestSeek.
+ */
+void RecorderClass::updateSnapshots()
+{
+	if (!isPlaybackInProgress() || m_file == nullptr || m_doingAnalysis)
+		return;
+
+	// Wait until the game runs, so the snapshot contains a started game.
+	if (TheGameLogic->getFrame() == 0 || !TheGameLogic->isInGame())
+		return;
+
+	if (m_seekFrame >= 0)
+	{
+		const UnsignedInt frame = (UnsignedInt)m_seekFrame;
+		m_seekFrame = -1;
+		seekToFrame(frame);
+		return;
+	}
+
+	takeSnapshotIfDue();
+}
+
+/**
+ * Save a snapshot when TheGlobalData->m_replaySnapshotInterval frames have passed since the last one.
+ * The first snapshot is taken as early as possible, so every later frame has a snapshot before it,
+ * until the oldest snapshots are dropped to stay within maxReplaySnapshotBytes.
+ */
+void RecorderClass::takeSnapshotIfDue()
+{
+	const UnsignedInt interval = TheGlobalData->m_replaySnapshotInterval;
+	if (interval == 0)
+		return;
+
+	const UnsignedInt frame = TheGameLogic->getFrame();
+	if (!m_snapshots.empty() && frame < m_snapshots.back()->frame + interval)
+		return;
+
+	// Pending commands are not part of the save data. In regular playback the CRC message of the
+	// previous frame can still be waiting here, so try again next frame.
+	if (TheCommandList->getFirstMessage() != nullptr)
+		return;
+
+	std::vector<UnsignedByte> saveData;
+	if (TheGameState->saveGameToBuffer(saveData) != SC_OK)
+	{
+		DEBUG_CRASH(("RecorderClass::takeSnapshotIfDue - Unable to save the game on frame %d", frame));
+		return;
+	}
+
+	ReplaySnapshot *snapshot = NEW ReplaySnapshot(*m_crcInfo);
+	snapshot->frame = frame;
+	snapshot->filePosition = m_file->position();
+	snapshot->nextFrame = m_nextFrame;
+	GetGameLogicRandomState(&snapshot->randomState);
+
+	// Use the fastest zlib level, because snapshots are taken while the replay plays.
+	const Int saveSize = (Int)saveData.size();
+	snapshot->data.resize(CompressionManager::getMaxCompressedSize(saveSize, COMPRESSION_ZLIB1));
+	const Int compressedSize = CompressionManager::compressData(COMPRESSION_ZLIB1, &saveData[0], saveSize, &snapshot->data[0], (Int)snapshot->data.size());
+	if (compressedSize > 0)
+		snapshot->data.resize(compressedSize);
+	else
+		snapshot->data.swap(saveData);
+
+	DEBUG_LOG(("RecorderClass::takeSnapshotIfDue - Frame %d, %d bytes, %d bytes compressed", frame, saveSize, compressedSize));
+
+	m_snapshots.push_back(snapshot);
+
+	size_t totalBytes = 0;
+	for (std::vector<ReplaySnapshot *>::const_iterator it = m_snapshots.begin(); it != m_snapshots.end(); ++it)
+		totalBytes += (*it)->data.size();
+
+	// Always keep the new snapshot, even if it is larger than the limit by itself.
+	while (totalBytes > maxReplaySnapshotBytes && m_snapshots.size() > 1)
+	{
+		ReplaySnapshot *oldest = m_snapshots.front();
+		DEBUG_LOG(("RecorderClass::takeSnapshotIfDue - Dropping the snapshot of frame %d", oldest->frame));
+		totalBytes -= oldest->data.size();
+		delete oldest;
+		m_snapshots.erase(m_snapshots.begin());
+	}
+}
+
+/**
+ * Restore the last snapshot at or before the frame, unless continuing from the current frame is
+ * faster, and simulate forward to the frame. Returns TRUE if playback arrived at the frame.
+ */
+Bool RecorderClass::seekToFrame(UnsignedInt frame)
+{
+	if (!isPlaybackInProgress() || m_file == nullptr)
+		return FALSE;
+
+	const ReplaySnapshot *snapshot = nullptr;
+	for (std::vector<ReplaySnapshot *>::const_iterator it = m_snapshots.begin(); it != m_snapshots.end(); ++it)
+	{
+		if ((*it)->frame > frame)
+			break;
+		snapshot = *it;
+	}
+
+	const UnsignedInt currentFrame = TheGameLogic->getFrame();
+	if (frame < currentFrame || (snapshot != nullptr && snapshot->frame > currentFrame))
+	{
+		if (snapshot == nullptr)
+		{
+			DEBUG_LOG(("RecorderClass::seekToFrame - No snapshot at or before frame %d", frame));
+			return FALSE;
+		}
+
+		if (!restoreSnapshot(*snapshot))
+			return FALSE;
+	}
+
+	// Simulate the remaining frames like the headless replay simulation does.
+	while (TheGameLogic->getFrame() < frame && isPlaybackInProgress())
+	{
+		takeSnapshotIfDue();
+		TheGameClient->updateHeadless();
+		TheGameLogic->UPDATE();
+
+		// Regular playback sends the CRC messages through the message stream.
+		if (m_mode != RECORDERMODETYPE_SIMULATION_PLAYBACK)
+			TheMessageStream->propagateMessages();
+	}
+
+	// The client skipped the simulated frames, so bring the view and drawables up to date once.
+	if (!TheGlobalData->m_headless)
+		TheGameClient->UPDATE();
+
+	return TheGameLogic->getFrame() == frame;
+}
+
+/**
+ * Load the save data of the snapshot and continue playback from its position in the replay file.
+ * If the load fails, the game is gone and playback stops.
+ */
+Bool RecorderClass::restoreSnapshot(const ReplaySnapshot& snapshot)
+{
+	const void *saveData = &snapshot.data[0];
+	Int saveSize = (Int)snapshot.data.size();
+
+	std::vector<UnsignedByte> uncompressed;
+	if (CompressionManager::isDataCompressed(saveData, saveSize))
+	{
+		uncompressed.resize(CompressionManager::getUncompressedSize(saveData, saveSize));
+		const Int size = CompressionManager::decompressData(const_cast<void *>(saveData), saveSize, &uncompressed[0], (Int)uncompressed.size());
+		if (size != (Int)uncompressed.size())
+		{
+			DEBUG_CRASH(("RecorderClass::restoreSnapshot - Unable to decompress the snapshot of frame %d", snapshot.frame));
+			return FALSE;
+		}
+		saveData = &uncompressed[0];
+		saveSize = size;
+	}
+
+	SaveCode result;
+	{
+		LatchRestore<Bool> restoring(m_isRestoringSnapshot, TRUE);
+		result = TheGameState->loadGameFromBuffer(saveData, saveSize);
+	}
+
+	if (result != SC_OK)
+	{
+		DEBUG_CRASH(("RecorderClass::restoreSnapshot - Unable to load the snapshot of frame %d", snapshot.frame));
+		stopPlayback();
+		return FALSE;
+	}
+
+	DEBUG_ASSERTCRASH(TheGameLogic->getFrame() == snapshot.frame, ("Snapshot of frame %d loaded frame %d", snapshot.frame, TheGameLogic->getFrame()));
+
+	m_file->seek(snapshot.filePosition, File::START);
+	m_nextFrame = snapshot.nextFrame;
+	*m_crcInfo = snapshot.crcInfo;
+	SetGameLogicRandomState(&snapshot.randomState);
+
+	// Anything queued belongs to the frame we came from.
+	TheCommandList->reset();
+
+	return TRUE;
+}
+
+void RecorderClass::clearSnapshots()
+{
+	for (std::vector<ReplaySnapshot *>::iterator it = m_snapshots.begin(); it != m_snapshots.end(); ++it)
+		delete *it;
+	m_snapshots.clear();
+}
+
 /**
  * Returns true if this version of the file is the same as our version of the game
  */
@@ -1197,6 +1420,9 @@ Bool RecorderClass::playbackFile(AsciiString filename)
 
 	m_mode = RECORDERMODETYPE_PLAYBACK;
 
+	clearSnapshots();
+	m_seekFrame = TheGlobalData->m_replaySeekFrame;
+
 	ReplayHeader header;
 	header.forPlayback = TRUE;
 	header.filename = filename;
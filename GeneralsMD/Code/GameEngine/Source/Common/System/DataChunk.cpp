@@ -50,17 +50,32 @@ CachedFileInputStream::~CachedFileInputStream(void)
 Bool CachedFileInputStream::open(AsciiString path)
 {
 	File *file=TheFileSystem->openFile(path.str(), File::READ | File::BINARY);
-	m_size = 0;
+	char *buffer = nullptr;
+	Int size = 0;
 
 	if (file) {
-		m_size=file->size();
-		if (m_size) {
-			m_buffer = file->readEntireAndClose();
+		size=file->size();
+		if (size) {
+			buffer = file->readEntireAndClose();
 			file = nullptr;
 		}
-		m_pos=0;
 	}
 
+	if (file)
+	{
+		file->close();
+	}
+	return openBuffer(buffer, size);
+}
+
+// TheSuperHackers @performance Decompresses without touching the file system, so that the map cache
+// can read the files on the main thread and decompress them on the worker threads.
+Bool CachedFileInputStream::openBuffer(char *buffer, Int size)
+{
+	m_buffer = buffer;
+	m_size = size;
+	m_pos = 0;
+
 	if (CompressionManager::isDataCompressed(m_buffer, m_size) == 0)
 	{
 		//DEBUG_LOG(("CachedFileInputStream::open() - file %s is uncompressed at %d bytes!", path.str(), m_size));
@@ -92,10 +107,6 @@ Bool CachedFileInputStream::open(AsciiString path)
 	//		m_buffer[2], m_buffer[3]));
 	//}
 
-	if (file)
-	{
-		file->close();
-	}
 	return m_size != 0;
 }
 
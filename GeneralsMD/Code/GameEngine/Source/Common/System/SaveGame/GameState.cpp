@@ -52,6 +52,7 @@
 #include "GameClient/InGameUI.h"
 #include "GameClient/ParticleSys.h"
 #include "GameClient/TerrainVisual.h"
+#include "GameLogic/AI.h"
 #include "GameLogic/GameLogic.h"
 #include "GameLogic/GhostObject.h"
 #include "GameLogic/PartitionManager.h"
@@ -321,6 +322,11 @@ void GameState::init( void )
 	addSnapshotBlock( "CHUNK_ParticleSystem",					TheParticleSystemManager,	SNAPSHOT_SAVELOAD );
 	addSnapshotBlock( "CHUNK_TerrainVisual",					TheTerrainVisual,					SNAPSHOT_SAVELOAD );
 	addSnapshotBlock( "CHUNK_GhostObject",						TheGhostObjectManager,		SNAPSHOT_SAVELOAD );
+#if ENABLE_TARGET_SCAN_BUDGET
+	// TheSuperHackers @tweak Units keep their target scan tickets in save games, so the queue that hands out
+	// the scans must be saved as well. Older builds skip this block.
+	addSnapshotBlock( "CHUNK_AI",									TheAI,									SNAPSHOT_SAVELOAD );
+#endif
 
 	// add all the snapshot objects to our list of data blocks for deep CRCs of logic
 	addSnapshotBlock( "CHUNK_TeamFactory",						TheTeamFactory,						SNAPSHOT_DEEPCRC_LOGICONLY );
@@ -1320,6 +1326,104 @@ void GameState::iterateSaveFiles( IterateSaveFileCallback callback, void *userDa
 
 }
 
+// ------------------------------------------------------------------------------------------------
+/** TheSuperHackers @feature Save the game into a memory buffer. Unlike saveGame, this does
+	* not report anything to the user, so it can be used for frequent snapshots of a running game */
+// ------------------------------------------------------------------------------------------------
+SaveCode GameState::saveGameToBuffer( std::vector<UnsignedByte>& buffer )
+{
+
+	// the map is embedded into the save data, but extracted to the save directory on load
+	CreateDirectory( getSaveDirectory().str(), nullptr );
+
+	SaveGameInfo *gameInfo = getSaveGameInfo();
+	gameInfo->saveFileType = SAVE_FILE_TYPE_NORMAL;
+	gameInfo->missionMapName.clear();
+
+	XferSaveBuffer xferSave;
+	xferSave.open( "SaveGameBuffer" );
+
+	try
+	{
+		xferSaveData( &xferSave, SNAPSHOT_SAVELOAD );
+	}
+	catch( ... )
+	{
+		DEBUG_LOG(( "GameState::saveGameToBuffer - Error saving game" ));
+		xferSave.close();
+		return SC_ERROR;
+	}
+
+	xferSave.close();
+	buffer.swap( xferSave.getBuffer() );
+
+	return SC_OK;
+
+}
+
+// ------------------------------------------------------------------------------------------------
+/** TheSuperHackers @feature Load a game saved with saveGameToBuffer. This follows the same
+	* steps as loadGame, but reports errors only through the return value */
+// ------------------------------------------------------------------------------------------------
+SaveCode GameState::loadGameFromBuffer( const void *data, Int dataSize )
+{
+
+	// clear the save directory of any temporary "scratch pad" maps
+	TheGameStateMap->clearScratchPadMaps();
+
+	XferLoadBuffer xferLoad( data, dataSize );
+	xferLoad.open( "SaveGameBuffer" );
+
+	// clear out the game engine
+	TheGameEngine->reset();
+
+	// lock creation of new ghost objects
+	TheGhostObjectManager->saveLockGhostObjects( TRUE );
+
+	LatchRestore<Bool> inLoadGame(m_isInLoadGame, TRUE);
+
+	// load the save data
+	Bool error = FALSE;
+	try
+	{
+		xferSaveData( &xferLoad, SNAPSHOT_SAVELOAD );
+	}
+	catch( ... )
+	{
+		error = TRUE;
+	}
+
+	xferLoad.close();
+
+	// un-savelock the ghost objects
+	TheGhostObjectManager->saveLockGhostObjects( FALSE );
+
+	try
+	{
+		// do the post-process from a save game load
+		gameStatePostProcessLoad();
+	}
+	catch (...)
+	{
+		error = TRUE;
+	}
+
+	if( error == TRUE )
+	{
+		DEBUG_LOG(( "GameState::loadGameFromBuffer - Error loading game" ));
+
+		// clear it out, again
+		if (TheGameLogic->isInGame())
+			TheGameLogic->clearGameData( FALSE );
+		TheGameEngine->reset();
+
+		return SC_INVALID_DATA;
+	}
+
+	return SC_OK;
+
+}
+
 // ------------------------------------------------------------------------------------------------
 /** Save game to xfer or load game using xfer */
 // ------------------------------------------------------------------------------------------------
@@ -69,6 +69,7 @@
 
 #include "GameLogic/Armor.h"
 #include "GameLogic/Module/AIUpdate.h"
+#include "GameLogic/Module/BehaviorModule.h"
 #include "GameLogic/Module/SpecialPowerModule.h"
 #include "GameLogic/Object.h"
 #include "GameLogic/Powers.h"
@@ -439,6 +440,7 @@ void ModuleInfo::addModuleInfo(ThingTemplate *thingTemplate,
 #endif
 
 	m_info.push_back(Nugget(name, moduleTag, data, interfaceMask, inheritable, overrideableByLikeKind));
+	m_dispatchValid = FALSE;
 
 }
 
@@ -458,6 +460,7 @@ Bool ModuleInfo::clearModuleDataWithTag(const AsciiString& tagToClear, AsciiStri
 			DEBUG_ASSERTCRASH(!cleared, ("Hmm, multiple clears in ModuleInfo::clearModuleDataWithTag, should this be possible?"));
 			clearedModuleNameOut = it->first;
 			it = m_info.erase(it);
+			m_dispatchValid = FALSE;
 			cleared = true;
 		}
 		else
@@ -515,6 +518,7 @@ Bool ModuleInfo::clearCopiedFromDefaultEntries(Int interfaceMask, const AsciiStr
 				{
 					// Don't inherit this module if it is entirely useless to us.
           it = m_info.erase( it );
+          m_dispatchValid = FALSE;
 			    ret = true;
 				}
 				else
@@ -531,6 +535,7 @@ Bool ModuleInfo::clearCopiedFromDefaultEntries(Int interfaceMask, const AsciiStr
              || candidate == FALSE )
         {
           it = m_info.erase( it );
+          m_dispatchValid = FALSE;
 			    ret = true;
         }
         else
@@ -539,6 +544,7 @@ Bool ModuleInfo::clearCopiedFromDefaultEntries(Int interfaceMask, const AsciiStr
       else // just dump this instance of this Module, since one of the same interface mask has been added by caller
       {
         it = m_info.erase( it );
+        m_dispatchValid = FALSE;
 			  ret = true;
       }
     }
@@ -566,6 +572,7 @@ Bool ModuleInfo::clearAiModuleInfo()
 		if (it->second->isAiModuleData() )
 		{
 			it = m_info.erase( it );
+			m_dispatchValid = FALSE;
 			ret = true;
 		}
 		else
@@ -576,6 +583,67 @@ Bool ModuleInfo::clearAiModuleInfo()
 	return ret;
 }
 
+//-------------------------------------------------------------------------------------------------
+static Bool nameKeyModuleLess(const ModuleDispatch::NameKeyModule& a, const ModuleDispatch::NameKeyModule& b)
+{
+	if (a.nameKey != b.nameKey)
+		return a.nameKey < b.nameKey;
+	return a.module < b.module;
+}
+
+//-------------------------------------------------------------------------------------------------
+/** The interfaces come from the getters of the modules of the first Object created from the info,
+	* so they match the fan-out loops that ask every module, and the name keys come from the module
+	* names, which are the class names that the modules report. Object checks both against the
+	* modules of every Object it creates in debug builds. */
+//-------------------------------------------------------------------------------------------------
+void ModuleInfo::buildDispatch( BehaviorModule* const* modules ) const
+{
+	for (Int type = 0; type < MODULEDISPATCH_COUNT; ++type)
+		m_dispatch.m_interfaceModules[type].clear();
+	m_dispatch.m_nameKeyModules.clear();
+
+	Short module = 0;
+	for (size_t i = 0; i < m_info.size(); ++i)
+	{
+		const Nugget& nugget = m_info[i];
+		if (nugget.first.isEmpty())
+			continue;
+
+		BehaviorModule* behavior = modules[module];
+		if (behavior->getCollide() != nullptr)
+			m_dispatch.m_interfaceModules[MODULEDISPATCH_COLLIDE].push_back(module);
+		if (behavior->getDamage() != nullptr)
+			m_dispatch.m_interfaceModules[MODULEDISPATCH_DAMAGE].push_back(module);
+		if (behavior->getDie() != nullptr)
+			m_dispatch.m_interfaceModules[MODULEDISPATCH_DIE].push_back(module);
+		if (behavior->getSpecialPower() != nullptr)
+			m_dispatch.m_interfaceModules[MODULEDISPATCH_SPECIAL_POWER].push_back(module);
+		if (behavior->getUpgrade() != nullptr)
+			m_dispatch.m_interfaceModules[MODULEDISPATCH_UPGRADE].push_back(module);
+
+		ModuleDispatch::NameKeyModule nameKeyModule;
+		nameKeyModule.nameKey = NAMEKEY(nugget.first);
+		nameKeyModule.module = module;
+		m_dispatch.m_nameKeyModules.push_back(nameKeyModule);
+
+		++module;
+	}
+
+	// keep only the first module of each name, like a search in module order finds
+	std::sort(m_dispatch.m_nameKeyModules.begin(), m_dispatch.m_nameKeyModules.end(), nameKeyModuleLess);
+	size_t count = 0;
+	for (size_t i = 0; i < m_dispatch.m_nameKeyModules.size(); ++i)
+	{
+		if (count == 0 || m_dispatch.m_nameKeyModules[count - 1].nameKey != m_dispatch.m_nameKeyModules[i].nameKey)
+			m_dispatch.m_nameKeyModules[count++] = m_dispatch.m_nameKeyModules[i];
+	}
+	m_dispatch.m_nameKeyModules.resize(count);
+
+	m_dispatch.m_moduleCount = module;
+	m_dispatchValid = TRUE;
+}
+
 //-------------------------------------------------------------------------------------------------
 void ThingTemplate::parseModuleName(INI* ini, void *instance, void* store, const void* userData)
 {
@@ -407,6 +407,8 @@ Drawable::Drawable( const ThingTemplate *thingTemplate, DrawableStatusBits statu
 
 	m_nextDrawable = nullptr;
 	m_prevDrawable = nullptr;
+	m_gridBucket = -1;
+	m_gridIndex = -1;
 
   m_customSoundAmbientInfo = nullptr;
 
@@ -4941,6 +4943,8 @@ void Drawable::setPosition(const Coord3D *pos)
 //-------------------------------------------------------------------------------------------------
 void Drawable::reactToTransformChange(const Matrix3D* oldMtx, const Coord3D* oldPos, Real oldAngle)
 {
+	TheGameClient->getDrawableGrid()->update(this);
+
 	for (DrawModule** dm = getDrawModules(); *dm; ++dm)
 	{
 		(*dm)->reactToTransformChange(oldMtx, oldPos, oldAngle);
@@ -534,6 +534,7 @@ void GameClient::registerDrawable( Drawable *draw )
 
 	// add the drawable to the master list
 	draw->prependToList( &m_drawableList );
+	m_drawableGrid.add( draw );
 
 }
 
@@ -859,8 +860,7 @@ void GameClient::iterateDrawablesInRegion( Region3D *region, GameClientFuncPtr u
 		}
 
 	}
-	else if(region == nullptr || ThePartitionManager->hasNoOffset() || 
-	    ( !TheGlobalData->m_usePartitionManagerToIterateDrawables || TheGlobalData->m_usePartitionManagerToIterateDrawablesOnlySelect ) )
+	else if(region == nullptr)
 	{
 		Drawable *draw, *nextDrawable;
 
@@ -868,34 +868,25 @@ void GameClient::iterateDrawablesInRegion( Region3D *region, GameClientFuncPtr u
 		{
 			nextDrawable = draw->getNextDrawable();
 
-			Coord3D pos = *draw->getPosition();
-			if( region == nullptr ||
-				(pos.x >= region->lo.x && pos.x <= region->hi.x &&
-				pos.y >= region->lo.y && pos.y <= region->hi.y &&
-					pos.z >= region->lo.z && pos.z <= region->hi.z) )
-			{
-				if(TheGlobalData->m_useEfficientDrawableScheme)
-					addDrawableToEfficientList(draw);
-				(*userFunc)( draw, userData );
-			}
+			if(TheGlobalData->m_useEfficientDrawableScheme)
+				addDrawableToEfficientList(draw);
+			(*userFunc)( draw, userData );
 		}
 	}
 	else
 	{
-		//IamInnocent - Attempted to use PartitionManager code to use WorldCell for Finding Drawables - 6/10/2025
-		std::list< Drawable* > drawables = ThePartitionManager->getDrawablesInRegion( nullptr );
-		
-		for( std::list< Drawable* >::iterator it = drawables.begin(); it != drawables.end(); ++it )
+		// TheSuperHackers @performance Only look at the drawables in the grid cells of the region
+		DrawableGrid::Query query( &m_drawableGrid, region );
+
+		for( Int i = 0; i < query.getCount(); ++i )
 		{
-			Coord3D pos = *(*it)->getPosition();
-			if( pos.x >= region->lo.x && pos.x <= region->hi.x &&
-				pos.y >= region->lo.y && pos.y <= region->hi.y &&
-					pos.z >= region->lo.z && pos.z <= region->hi.z )
-			{
-				if(TheGlobalData->m_useEfficientDrawableScheme)
-					addDrawableToEfficientList(*it);
-				(*userFunc)( (*it), userData );
-			}
+			Drawable *draw = query.get( i );
+			if( draw == nullptr )
+				continue;
+
+			if(TheGlobalData->m_useEfficientDrawableScheme)
+				addDrawableToEfficientList(draw);
+			(*userFunc)( draw, userData );
 		}
 	}
 }
@@ -993,6 +984,7 @@ void GameClient::destroyDrawable( Drawable *draw )
 
 	// remove from the master list
 	draw->removeFromList(&m_drawableList);
+	m_drawableGrid.remove( draw );
 
 	//
 	// because drawables and objects are tightly coupled, not only MUST we maintain
@@ -1027,6 +1019,7 @@ void GameClient::destroyDrawablePreserveGUI( Drawable *draw )
 
 	// remove from the master list
 	draw->removeFromList(&m_drawableList);
+	m_drawableGrid.remove( draw );
 
 	//
 	// because drawables and objects are tightly coupled, not only MUST we maintain
@@ -1263,6 +1256,9 @@ void GameClient::preloadAssets( TimeOfDay timeOfDay )
 	MEMORYSTATUS before, after;
 	GlobalMemoryStatus(&before);
 
+	// TheSuperHackers @performance Load the models of all drawables together, so that their files are parsed in parallel
+	TheDisplay->beginPreloadModelAssets();
+
 	// first, for every drawable in the map load the assets for all states we care about
 	Drawable *draw;
 	for( draw = firstDrawable(); draw; draw = draw->getNextDrawable() )
@@ -1297,6 +1293,7 @@ void GameClient::preloadAssets( TimeOfDay timeOfDay )
 		}
 
 	}
+	TheDisplay->endPreloadModelAssets();
 	GlobalMemoryStatus(&after);
 
 	DEBUG_LOG(("Preloading memory dwAvailPageFile %d --> %d : %d",
@@ -1320,11 +1317,13 @@ void GameClient::preloadAssets( TimeOfDay timeOfDay )
 
 	GlobalMemoryStatus(&before);
 	extern std::vector<AsciiString>	debrisModelNamesGlobalHack;
+	TheDisplay->beginPreloadModelAssets();
 	size_t i=0;
 	for (; i<debrisModelNamesGlobalHack.size(); ++i)
 	{
 		TheDisplay->preloadModelAssets(debrisModelNamesGlobalHack[i]);
 	}
+	TheDisplay->endPreloadModelAssets();
 	GlobalMemoryStatus(&after);
 	debrisModelNamesGlobalHack.clear();
 
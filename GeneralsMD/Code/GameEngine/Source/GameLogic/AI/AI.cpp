@@ -192,6 +192,7 @@ static const FieldParse TheAIFieldParseTable[] =
 
  	{ "AIDozerBoredRadiusModifier",	INI::parseReal,nullptr,			offsetof( TAiData, m_aiDozerBoredRadiusModifier ) },
  	{ "AICrushesInfantry",	INI::parseBool,nullptr,			offsetof( TAiData, m_aiCrushesInfantry ) },
+ 	{ "MaxTargetScansPerFrame",	INI::parseInt,nullptr,			offsetof( TAiData, m_maxTargetScansPerFrame ) },
 
  	{ "MaxRetaliationDistance",	INI::parseReal,nullptr,			offsetof( TAiData, m_maxRetaliateDistance ) },
  	{ "RetaliationFriendsRadius",	INI::parseReal,nullptr,			offsetof( TAiData, m_retaliateFriendsRadius ) },
@@ -304,6 +305,11 @@ AI::AI( void )
 	m_aiData = NEW TAiData;
 	m_pathfinder = NEW Pathfinder;
 	m_nextFormationID = NO_FORMATION_ID;
+#if ENABLE_TARGET_SCAN_BUDGET
+	m_totalTargetScanCount = 0;
+	m_totalDeferredTargetScanCount = 0;
+	resetTargetScans();
+#endif
 }
 
 /**
@@ -348,6 +354,17 @@ void AI::reset( void )
 	m_nextGroupID = 0;
 	m_nextFormationID = NO_FORMATION_ID;
 	getNextFormationID(); // increment once past NO_FORMATION_ID.  jba.
+
+#if ENABLE_TARGET_SCAN_BUDGET
+	if (m_totalTargetScanCount > 0)
+	{
+		DEBUG_LOG(("AI::reset - %d idle target scans, %d of them waited for a later frame at least once",
+			m_totalTargetScanCount, m_totalDeferredTargetScanCount));
+	}
+	m_totalTargetScanCount = 0;
+	m_totalDeferredTargetScanCount = 0;
+	resetTargetScans();
+#endif
 }
 
 /**
@@ -365,6 +382,74 @@ void AI::update( void )
 
 }
 
+#if ENABLE_TARGET_SCAN_BUDGET
+//-------------------------------------------------------------------------------------------------
+/** When many idle units come due for a target scan in the same frame, only MaxTargetScansPerFrame
+	* of them may scan, and the others get a ticket and try again next frame. At the start of every
+	* frame the oldest tickets get reserved scans, so the scans are handed out in the order in which
+	* the callers started to wait, and no caller waits forever. Everything depends on the order of
+	* the calls only, which is the same on every peer. */
+//-------------------------------------------------------------------------------------------------
+Bool AI::requestTargetScan( UnsignedInt &ticket )
+{
+	const Int budget = m_aiData->m_maxTargetScansPerFrame;
+	const UnsignedInt now = TheGameLogic->getFrame();
+	if (now != m_targetScanFrame)
+	{
+		m_targetScanFrame = now;
+		m_targetScanCount = 0;
+		m_newTargetScanCount = 0;
+		m_deferredTargetScanCount = 0;
+
+		// Tickets that had a reserved scan and did not use it keep their place ahead of all newer
+		// tickets, but have no reservation anymore.
+		const UnsignedInt waiting = m_nextTargetScanTicket - m_targetScanReservedEnd;
+		m_targetScanReservedStart = m_targetScanReservedEnd;
+		m_targetScanReservedEnd += min(waiting, (UnsignedInt)max(budget, 0));
+	}
+
+	Bool allowed;
+	if (budget <= 0)
+		allowed = TRUE;
+	else if (m_targetScanCount >= budget)
+		allowed = FALSE;
+	else if (ticket == 0)
+		allowed = m_newTargetScanCount < budget - (Int)(m_targetScanReservedEnd - m_targetScanReservedStart);
+	else
+		allowed = ticket < m_targetScanReservedEnd;
+
+	if (allowed)
+	{
+		if (ticket == 0)
+			++m_newTargetScanCount;
+		++m_targetScanCount;
+		++m_totalTargetScanCount;
+		ticket = 0;
+		return TRUE;
+	}
+
+	if (ticket == 0)
+	{
+		ticket = m_nextTargetScanTicket++;
+		++m_totalDeferredTargetScanCount;
+	}
+	++m_deferredTargetScanCount;
+	return FALSE;
+}
+
+//-------------------------------------------------------------------------------------------------
+void AI::resetTargetScans( void )
+{
+	m_targetScanFrame = 0;
+	m_nextTargetScanTicket = 1;
+	m_targetScanReservedStart = 1;
+	m_targetScanReservedEnd = 1;
+	m_targetScanCount = 0;
+	m_newTargetScanCount = 0;
+	m_deferredTargetScanCount = 0;
+}
+#endif
+
 /**
  * Destroy the AI system
  */
@@ -688,9 +773,9 @@ Object *AI::findClosestEnemy( const Object *me, Real range, UnsignedInt qualifie
 	Object *bestEnemy = nullptr;
 	Int			effectivePriority=0;
 	Int			actualPriority=0;
-	ObjectIterator *iter = ThePartitionManager->iterateObjectsInRange(me, range, FROM_BOUNDINGSPHERE_2D, filters, ITER_SORTED_NEAR_TO_FAR);
-	MemoryPoolObjectHolder holder(iter);
-	for (Object *theEnemy = iter->first(); theEnemy; theEnemy = iter->next())
+	ObjectQueryResults enemies;
+	ThePartitionManager->queryObjectsInRange(me, range, FROM_BOUNDINGSPHERE_2D, enemies, filters, ITER_SORTED_NEAR_TO_FAR);
+	for (Object *theEnemy = enemies.first(); theEnemy; theEnemy = enemies.next())
 	{
 		Int curPriority = info->getPriority(theEnemy->getTemplate());
 		if (curPriority == 0)
@@ -947,6 +1032,7 @@ m_structuresPoorMod(0.0f),
 m_teamWealthyMod(0.0f),
 m_aiDozerBoredRadiusModifier(2.0),
 m_aiCrushesInfantry(true),
+m_maxTargetScansPerFrame(64),
 m_maxRetaliateDistance(210.0f),
 m_retaliateFriendsRadius(120.0f)
 {
@@ -1029,15 +1115,36 @@ void AI::crc( Xfer *xfer )
 
 }
 
+//-----------------------------------------------------------------------------
+/** Xfer method
+	* Version Info:
+	* 1: Initial version
+	* 2: TheSuperHackers @tweak Serialize the target scan queue */
 //-----------------------------------------------------------------------------
 void AI::xfer( Xfer *xfer )
 {
 
 	// version
+#if ENABLE_TARGET_SCAN_BUDGET
+	XferVersion currentVersion = 2;
+#else
 	XferVersion currentVersion = 1;
+#endif
 	XferVersion version = currentVersion;
 	xfer->xferVersion( &version, currentVersion );
 
+#if ENABLE_TARGET_SCAN_BUDGET
+	if (version >= 2)
+	{
+		xfer->xferUnsignedInt( &m_targetScanFrame );
+		xfer->xferUnsignedInt( &m_nextTargetScanTicket );
+		xfer->xferUnsignedInt( &m_targetScanReservedStart );
+		xfer->xferUnsignedInt( &m_targetScanReservedEnd );
+		xfer->xferInt( &m_targetScanCount );
+		xfer->xferInt( &m_newTargetScanCount );
+	}
+#endif
+
 }
 
 //-----------------------------------------------------------------------------
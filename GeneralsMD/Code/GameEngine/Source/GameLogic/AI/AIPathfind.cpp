@@ -36,6 +36,7 @@
 #include "Common/LatchRestore.h"
 #include "Common/ThingTemplate.h"
 #include "Common/ThingFactory.h"
+#include "Common/WorkerThreadPool.h"
 
 #include "GameClient/Line2D.h"
 
@@ -1212,6 +1213,10 @@ PathfindCellInfo *PathfindCellInfo::getACellInfo(PathfindCell *cell,const ICoord
 		info->m_totalCost = 0;
 		info->m_open = 0;
 		info->m_closed = 0;
+#if USE_PATHFIND_OPEN_LIST_HEAP
+		info->m_openHeapIndex = -1;
+		info->m_openSequence = 0;
+#endif
 		info->m_obstacleID = INVALID_ID;
 		info->m_goalUnitID = INVALID_ID;
 		info->m_posUnitID = INVALID_ID;
@@ -1246,6 +1251,104 @@ Bool PathfindCellList::canReverseSort(PathfindCell& currentCell) const
 	return false;
 }
 
+#if USE_PATHFIND_OPEN_LIST_HEAP
+//-----------------------------------------------------------------------------------
+PathfindCell* PathfindCellList::getOpenHeapCell(Int index) const
+{
+	return m_openHeap[index]->m_cell;
+}
+
+//-----------------------------------------------------------------------------------
+// Cells with equal total cost are ordered by insertion sequence, which reproduces the
+// first-in-first-out order of equal costs in the sorted list, so paths remain deterministic.
+Bool PathfindCellList::isOpenHeapLess(const PathfindCellInfo* a, const PathfindCellInfo* b)
+{
+	if (a->m_totalCost != b->m_totalCost)
+		return a->m_totalCost < b->m_totalCost;
+
+	return a->m_openSequence < b->m_openSequence;
+}
+
+//-----------------------------------------------------------------------------------
+void PathfindCellList::openHeapPlace(Int index, PathfindCellInfo* info)
+{
+	m_openHeap[index] = info;
+	info->m_openHeapIndex = index;
+}
+
+//-----------------------------------------------------------------------------------
+void PathfindCellList::openHeapUpdateHead()
+{
+	m_head = m_openHeap.empty() ? nullptr : m_openHeap[0]->m_cell;
+}
+
+//-----------------------------------------------------------------------------------
+void PathfindCellList::openHeapSiftUp(Int index)
+{
+	PathfindCellInfo* info = m_openHeap[index];
+	while (index > 0) {
+		const Int parent = (index - 1) / 2;
+		if (!isOpenHeapLess(info, m_openHeap[parent]))
+			break;
+		openHeapPlace(index, m_openHeap[parent]);
+		index = parent;
+	}
+	openHeapPlace(index, info);
+}
+
+//-----------------------------------------------------------------------------------
+void PathfindCellList::openHeapSiftDown(Int index)
+{
+	const Int count = (Int)m_openHeap.size();
+	PathfindCellInfo* info = m_openHeap[index];
+	for (;;) {
+		Int child = index * 2 + 1;
+		if (child >= count)
+			break;
+		if (child + 1 < count && isOpenHeapLess(m_openHeap[child + 1], m_openHeap[child]))
+			++child;
+		if (!isOpenHeapLess(m_openHeap[child], info))
+			break;
+		openHeapPlace(index, m_openHeap[child]);
+		index = child;
+	}
+	openHeapPlace(index, info);
+}
+
+//-----------------------------------------------------------------------------------
+void PathfindCellList::openHeapPush(PathfindCellInfo* info)
+{
+	info->m_openSequence = m_openSequence++;
+	m_openHeap.push_back(info);
+	openHeapSiftUp((Int)m_openHeap.size() - 1);
+	openHeapUpdateHead();
+}
+
+//-----------------------------------------------------------------------------------
+void PathfindCellList::openHeapRemove(PathfindCellInfo* info)
+{
+	const Int index = info->m_openHeapIndex;
+	DEBUG_ASSERTCRASH(index >= 0 && index < (Int)m_openHeap.size() && m_openHeap[index] == info, ("Cell is not on the open list heap."));
+
+	PathfindCellInfo* last = m_openHeap.back();
+	m_openHeap.pop_back();
+	info->m_openHeapIndex = -1;
+
+	if (last != info) {
+		openHeapPlace(index, last);
+		if (index > 0 && isOpenHeapLess(last, m_openHeap[(index - 1) / 2]))
+			openHeapSiftUp(index);
+		else
+			openHeapSiftDown(index);
+	}
+
+	if (m_openHeap.empty())
+		m_openSequence = 0;
+
+	openHeapUpdateHead();
+}
+#endif
+
 //-----------------------------------------------------------------------------------
 
 /**
@@ -1863,6 +1966,18 @@ void PathfindCell::putOnSortedOpenList( PathfindCellList &list )
 	}
 #endif
 
+#if USE_PATHFIND_OPEN_LIST_HEAP
+	DEBUG_ASSERTCRASH(m_info, ("Has to have info."));
+	DEBUG_ASSERTCRASH(m_info->m_closed == FALSE && m_info->m_open == FALSE, ("Serious error - Invalid flags. jba"));
+
+	// mark the new cell as being on the open list
+	m_info->m_open = true;
+	m_info->m_closed = false;
+	m_info->m_nextOpen = nullptr;
+	m_info->m_prevOpen = nullptr;
+
+	list.openHeapPush(m_info);
+#else
 	// TheSuperHackers @performance Mauller 20/03/2026 Implement reverse insertion sorting.
 	// Long and complex paths often append PathfindCell's, with high total path costs, to the open list.
 	// Appending and reverse traversal allow faster insertion of these cells, reducing pathfinding overhead by 50 - 66%.
@@ -1872,6 +1987,7 @@ void PathfindCell::putOnSortedOpenList( PathfindCellList &list )
 	else {
 		forwardInsertionSort(list);
 	}
+#endif
 }
 
 /// remove self from "open" list
@@ -1879,6 +1995,9 @@ void PathfindCell::removeFromOpenList( PathfindCellList &list )
 {
 	DEBUG_ASSERTCRASH(m_info, ("Has to have info."));
 	DEBUG_ASSERTCRASH(m_info->m_closed==FALSE && m_info->m_open==TRUE, ("Serious error - Invalid flags. jba"));
+#if USE_PATHFIND_OPEN_LIST_HEAP
+	list.openHeapRemove(m_info);
+#else
 	if (m_info->m_nextOpen)
 		m_info->m_nextOpen->m_prevOpen = m_info->m_prevOpen;
 	else {
@@ -1889,6 +2008,7 @@ void PathfindCell::removeFromOpenList( PathfindCellList &list )
 		m_info->m_prevOpen->m_nextOpen = m_info->m_nextOpen;
 	else
 		list.m_head = getNextOpen();
+#endif
 
 	m_info->m_open = false;
 	m_info->m_nextOpen = nullptr;
@@ -1900,6 +2020,17 @@ void PathfindCell::removeFromOpenList( PathfindCellList &list )
 Int PathfindCell::releaseOpenList( PathfindCellList &list )
 {
 	Int count = 0;
+#if USE_PATHFIND_OPEN_LIST_HEAP
+	for (std::vector<PathfindCellInfo*>::iterator it = list.m_openHeap.begin(); it != list.m_openHeap.end(); ++it) {
+		count++;
+		PathfindCellInfo *curInfo = *it;
+		DEBUG_ASSERTCRASH(curInfo->m_closed==FALSE && curInfo->m_open==TRUE, ("Serious error - Invalid flags. jba"));
+		curInfo->m_openHeapIndex = -1;
+		curInfo->m_open = FALSE;
+		curInfo->m_cell->releaseInfo();
+	}
+	list.reset();
+#else
 	while (list.m_head) {
 		count++;
 		DEBUG_ASSERTCRASH(list.m_head->m_info, ("Has to have info."));
@@ -1935,6 +2066,7 @@ Int PathfindCell::releaseOpenList( PathfindCellList &list )
 		if(cur)
 			cur->releaseInfo();
 	}
+#endif
 	return count;
 }
 
@@ -2353,6 +2485,45 @@ inline void applyZone(PathfindCell &targetCell, const PathfindCell &sourceCell,
 
 }
 
+// TheSuperHackers @performance The equivalencies of the whole map are merged with a union find instead
+// of resolveZones, which visits every zone for each merge. A zone never gets a parent above itself, so
+// the root of a set is its lowest zone, and after flattenRootZones every zone refers to the lowest zone
+// it is connected to. That is the same result resolveZones gives, no matter the order of the merges.
+static Int findRootZone(zoneStorageType *zoneParents, Int zone)
+{
+	while (zoneParents[zone] != zone) {
+		zoneParents[zone] = zoneParents[zoneParents[zone]];
+		zone = zoneParents[zone];
+	}
+	return zone;
+}
+
+static void unionZones(Int zone1, Int zone2, zoneStorageType *zoneParents)
+{
+	DEBUG_ASSERTCRASH(zone1!=0 && zone2!=0,  ("Bad union zones."));
+	zone1 = findRootZone(zoneParents, zone1);
+	zone2 = findRootZone(zoneParents, zone2);
+	if (zone1 < zone2) {
+		zoneParents[zone2] = zone1;
+	} else {
+		zoneParents[zone1] = zone2;
+	}
+}
+
+inline void unionCellZones(const PathfindCell &targetCell, const PathfindCell &sourceCell, zoneStorageType *zoneParents)
+{
+	unionZones(targetCell.getZone(), sourceCell.getZone(), zoneParents);
+}
+
+static void flattenRootZones(zoneStorageType *zoneParents, Int sizeOfZones)
+{
+	Int i;
+	// The parent of a zone is below it, so it is already flattened.
+	for (i=1; i<sizeOfZones; i++) {
+		zoneParents[i] = zoneParents[zoneParents[i]];
+	}
+}
+
 inline void applyBlockZone(PathfindCell &targetCell, const PathfindCell &sourceCell,
 													 zoneStorageType *zoneEquivalency, Int firstZone, Int sizeOfZE)
 {
@@ -2375,7 +2546,11 @@ m_groundWaterZones(nullptr),
 m_groundRubbleZones(nullptr),
 m_crusherZones(nullptr),
 m_zonesAllocated(0),
-m_interactsWithBridge(FALSE)
+m_interactsWithBridge(FALSE),
+m_zoneBase(0),
+m_numCellZones(0),
+m_cellsInteractWithBridge(FALSE),
+m_dirty(TRUE)
 {
 	m_cellOrigin.x = 0;
 	m_cellOrigin.y = 0;
@@ -2472,6 +2647,86 @@ void ZoneBlock::blockCalculateZones(PathfindCell **map, PathfindLayer layers[],
 
 }
 
+/* Number the connected cells of the same type in the block 1, 2, 3... in the order the full map
+numbering used, so that adding the number of zones of the blocks before gives the same zones. Touches
+no other block, so the blocks can be numbered at the same time. */
+void ZoneBlock::labelCellZones(PathfindCell **map, const IRegion2D &bounds)
+{
+	enum {MAX_BLOCK_ZONES = PathfindZoneManager::ZONE_BLOCK_SIZE*PathfindZoneManager::ZONE_BLOCK_SIZE + 1};
+	zoneStorageType zoneEquivalency[MAX_BLOCK_ZONES];
+	zoneStorageType collapsedZones[MAX_BLOCK_ZONES];
+	Int maxZone = 1;	// we start using zone 0 as a flag.
+	Int i, j;
+	for (i=0; i<MAX_BLOCK_ZONES; i++) {
+		zoneEquivalency[i] = i;
+	}
+
+	m_cellsInteractWithBridge = false;
+	for( j=bounds.lo.y; j<=bounds.hi.y; j++ )	{
+		for( i=bounds.lo.x; i<=bounds.hi.x; i++ )	{
+			PathfindCell *cell = &map[i][j];
+			cell->setZone(0);
+
+			if (i>bounds.lo.x) {
+				if (map[i][j].getType() == map[i-1][j].getType()) {
+					applyZone(map[i][j], map[i-1][j], zoneEquivalency, maxZone);
+				}
+			}
+			if (j>bounds.lo.y) {
+				if (map[i][j].getType() == map[i][j-1].getType()) {
+					applyZone(map[i][j], map[i][j-1], zoneEquivalency, maxZone);
+				}
+			}
+			if (cell->getZone()==0) {
+				cell->setZone(maxZone);
+				maxZone++;
+			}
+			if (cell->getConnectLayer() > LAYER_GROUND) {
+				m_cellsInteractWithBridge = true;
+			}
+		}
+	}
+
+	// Collapse the zones into a 1,2,3... sequence, removing collapsed zones.
+	Int numZones = 0;
+	collapsedZones[0] = 0;
+	for (i=1; i<maxZone; i++) {
+		Int zone = zoneEquivalency[i];
+		if (zone == i) {
+			collapsedZones[i] = ++numZones;
+		} else {
+			collapsedZones[i] = collapsedZones[zone];
+		}
+	}
+
+	for( j=bounds.lo.y; j<=bounds.hi.y; j++ ) {
+		for( i=bounds.lo.x; i<=bounds.hi.x; i++ ) {
+			PathfindCell &cell = map[i][j];
+			cell.setZone(collapsedZones[cell.getZone()]);
+		}
+	}
+
+	m_zoneBase = 0;
+	m_numCellZones = numZones;
+}
+
+/* The cells kept their types and moved to zones delta higher, so blockCalculateZones would find the
+same equivalencies delta higher. */
+void ZoneBlock::offsetZones(Int delta)
+{
+	m_firstZone += delta;
+	if (m_numZones==1) {
+		return; // no zone equivalency tables in use.
+	}
+	Int i;
+	for (i=0; i<m_zonesAllocated; i++) {
+		m_groundCliffZones[i] += delta;
+		m_groundWaterZones[i] += delta;
+		m_groundRubbleZones[i] += delta;
+		m_crusherZones[i] += delta;
+	}
+}
+
 //
 // Return the zone at this location.
 //
@@ -2577,6 +2832,7 @@ m_crusherZones(nullptr),
 m_hierarchicalZones(nullptr),
 m_blockOfZoneBlocks(nullptr),
 m_zoneBlocks(nullptr),
+m_blockZoneBases(nullptr),
 m_zonesAllocated(0)
 {
 	m_zoneBlockExtent.x = 0;
@@ -2620,6 +2876,9 @@ void PathfindZoneManager::freeBlocks()
 	delete [] m_zoneBlocks;
 	m_zoneBlocks = nullptr;
 
+	delete [] m_blockZoneBases;
+	m_blockZoneBases = nullptr;
+
 	m_zoneBlockExtent.x = 0;
 	m_zoneBlockExtent.y = 0;
 }
@@ -2659,6 +2918,7 @@ void PathfindZoneManager::allocateBlocks(const IRegion2D &globalBounds)
 
 	m_blockOfZoneBlocks = MSGNEW("PathfindZoneBlocks") ZoneBlock[(m_zoneBlockExtent.x)*(m_zoneBlockExtent.y)];
 	m_zoneBlocks = MSGNEW("PathfindZoneBlocks") ZoneBlockP[m_zoneBlockExtent.x];
+	m_blockZoneBases = MSGNEW("PathfindZoneBlocks") zoneStorageType[(m_zoneBlockExtent.x)*(m_zoneBlockExtent.y)];
 	Int i;
 	for (i=0; i<m_zoneBlockExtent.x; i++) {
 		m_zoneBlocks[i] = &m_blockOfZoneBlocks[i*(m_zoneBlockExtent.y)];
@@ -2674,6 +2934,20 @@ void PathfindZoneManager::reset()  ///< Called when the map is reset.
 
 void PathfindZoneManager::markZonesDirty()  ///< Called when the zones need to be recalculated.
 {
+	IRegion2D allCells;
+	allCells.lo.x = 0;
+	allCells.lo.y = 0;
+	allCells.hi.x = m_zoneBlockExtent.x*ZONE_BLOCK_SIZE;
+	allCells.hi.y = m_zoneBlockExtent.y*ZONE_BLOCK_SIZE;
+	markZonesDirty(allCells);
+}
+
+/* Only the blocks that hold a cell in the bounds are numbered again, the other blocks keep the
+zones of their cells. */
+void PathfindZoneManager::markZonesDirty( const IRegion2D &cellBounds )
+{
+	markBlocksDirty(cellBounds);
+
 #if RTS_GENERALS && RETAIL_COMPATIBLE_PATHFINDING
 	m_nextFrameToCalculateZones = TheGameLogic->getFrame();
 #else
@@ -2685,6 +2959,23 @@ void PathfindZoneManager::markZonesDirty()  ///< Called when the zones need to b
 #endif
 }
 
+void PathfindZoneManager::markBlocksDirty( const IRegion2D &cellBounds )
+{
+	if (m_zoneBlocks == nullptr) {
+		return;
+	}
+	Int loX = MAX(cellBounds.lo.x, 0)/ZONE_BLOCK_SIZE;
+	Int loY = MAX(cellBounds.lo.y, 0)/ZONE_BLOCK_SIZE;
+	Int hiX = MIN(cellBounds.hi.x/ZONE_BLOCK_SIZE, m_zoneBlockExtent.x-1);
+	Int hiY = MIN(cellBounds.hi.y/ZONE_BLOCK_SIZE, m_zoneBlockExtent.y-1);
+	Int blockX, blockY;
+	for (blockX = loX; blockX<=hiX; blockX++) {
+		for (blockY = loY; blockY<=hiY; blockY++) {
+			m_zoneBlocks[blockX][blockY].setDirty(true);
+		}
+	}
+}
+
 /**
  * Calculate zones.  A zone is an area of the same terrain - clear, water or cliff.
  * The utility of zones is that if current location and destination are in the same zone,
@@ -2698,6 +2989,72 @@ void PathfindZoneManager::markZonesDirty()  ///< Called when the zones need to b
 static  Bool  s_stopForceCalling = FALSE;
 #endif
 
+struct ZoneJobData
+{
+	PathfindCell **map;
+	PathfindLayer *layers;
+	IRegion2D globalBounds;
+	ICoord2D blockExtent;
+	ZoneBlock *blocks;
+	zoneStorageType *zoneBases;
+};
+
+static void getZoneBlockBounds(const IRegion2D &globalBounds, Int xBlock, Int yBlock, IRegion2D &bounds)
+{
+	bounds.lo.x = globalBounds.lo.x + xBlock*PathfindZoneManager::ZONE_BLOCK_SIZE;
+	bounds.lo.y = globalBounds.lo.y + yBlock*PathfindZoneManager::ZONE_BLOCK_SIZE;
+	bounds.hi.x = bounds.lo.x + PathfindZoneManager::ZONE_BLOCK_SIZE - 1; // bounds are inclusive.
+	bounds.hi.y = bounds.lo.y + PathfindZoneManager::ZONE_BLOCK_SIZE - 1; // bounds are inclusive.
+	if (bounds.hi.x > globalBounds.hi.x) {
+		bounds.hi.x = globalBounds.hi.x;
+	}
+	if (bounds.hi.y > globalBounds.hi.y) {
+		bounds.hi.y = globalBounds.hi.y;
+	}
+}
+
+/* Numbers the cells of a dirty block. Runs on a worker thread, so only touches the block and its cells. */
+static void labelBlockJob( void *userData, Int index )
+{
+	ZoneJobData *data = static_cast<ZoneJobData *>(userData);
+	ZoneBlock &block = data->blocks[index];
+	if (!block.isDirty()) {
+		return;
+	}
+	IRegion2D bounds;
+	getZoneBlockBounds(data->globalBounds, index/data->blockExtent.y, index%data->blockExtent.y, bounds);
+	block.labelCellZones(data->map, bounds);
+}
+
+/* Moves the cells of a block to the zone base of the block, and calculates the block equivalencies.
+Runs on a worker thread, so only touches the block and its cells. */
+static void finishBlockJob( void *userData, Int index )
+{
+	ZoneJobData *data = static_cast<ZoneJobData *>(userData);
+	ZoneBlock &block = data->blocks[index];
+	IRegion2D bounds;
+	getZoneBlockBounds(data->globalBounds, index/data->blockExtent.y, index%data->blockExtent.y, bounds);
+
+	const Int delta = data->zoneBases[index] - block.getZoneBase();
+	if (delta != 0) {
+		Int i, j;
+		for( j=bounds.lo.y; j<=bounds.hi.y; j++ ) {
+			for( i=bounds.lo.x; i<=bounds.hi.x; i++ ) {
+				PathfindCell &cell = data->map[i][j];
+				cell.setZone(cell.getZone() + delta);
+			}
+		}
+		block.setZoneBase(data->zoneBases[index]);
+	}
+
+	if (block.isDirty()) {
+		block.blockCalculateZones(data->map, data->layers, bounds);
+		block.setDirty(false);
+	} else if (delta != 0) {
+		block.offsetZones(delta);
+	}
+}
+
 void PathfindZoneManager::calculateZones( PathfindCell **map, PathfindLayer layers[], const IRegion2D &globalBounds )
 {
 #ifdef DEBUG_QPF
@@ -2712,109 +3069,49 @@ void PathfindZoneManager::calculateZones( PathfindCell **map, PathfindLayer laye
 #endif
 #endif
 
-	m_maxZone = 1;	// we start using zone 0 as a flag.
-	const Int maxZones=24000;
-	zoneStorageType zoneEquivalency[maxZones];
+	// TheSuperHackers @performance The cells of each block are numbered on their own, on the worker threads.
+	// The numbering never joins cells of different blocks, so the zones of a block are the zones the full map
+	// numbering gave it, minus the number of zones of the blocks before. Blocks that did not change since the
+	// last calculation keep their numbering.
 	Int i, j;
-	for (i=0; i<maxZones; i++) {
-		zoneEquivalency[i] = i;
-	}
 	for (i=0; i<=LAYER_LAST; i++) {
 		layers[i].setZone(0);
 	}
 
-	Int xCount = (globalBounds.hi.x-globalBounds.lo.x+1+ZONE_BLOCK_SIZE-1)/ZONE_BLOCK_SIZE;
-	Int yCount = (globalBounds.hi.y-globalBounds.lo.y+1+ZONE_BLOCK_SIZE-1)/ZONE_BLOCK_SIZE;
+	DEBUG_ASSERTCRASH(m_zoneBlockExtent.x == (globalBounds.hi.x-globalBounds.lo.x+1+ZONE_BLOCK_SIZE-1)/ZONE_BLOCK_SIZE &&
+		m_zoneBlockExtent.y == (globalBounds.hi.y-globalBounds.lo.y+1+ZONE_BLOCK_SIZE-1)/ZONE_BLOCK_SIZE, ("Zone blocks don't match the map."));
 
-	Int xBlock, yBlock;
-	for (xBlock = 0; xBlock<xCount; xBlock++) {
-		for (yBlock=0; yBlock<yCount; yBlock++) {
-			IRegion2D bounds;
-			bounds.lo.x = globalBounds.lo.x + xBlock*ZONE_BLOCK_SIZE;
-			bounds.lo.y = globalBounds.lo.y + yBlock*ZONE_BLOCK_SIZE;
-			bounds.hi.x = bounds.lo.x + ZONE_BLOCK_SIZE - 1; // bounds are inclusive.
-			bounds.hi.y = bounds.lo.y + ZONE_BLOCK_SIZE - 1; // bounds are inclusive.
-			if (bounds.hi.x > globalBounds.hi.x) {
-				bounds.hi.x = globalBounds.hi.x;
-			}
-			if (bounds.hi.y > globalBounds.hi.y) {
-				bounds.hi.y = globalBounds.hi.y;
-			}
-#if RTS_GENERALS && RETAIL_COMPATIBLE_PATHFINDING
-			if (bounds.lo.x>bounds.hi.x || bounds.lo.y>bounds.hi.y) {
-				DEBUG_CRASH(("Incorrect bounds calculation. Logic error, fix me. jba."));
-				continue;
-			}
-#endif
-			m_zoneBlocks[xBlock][yBlock].setInteractsWithBridge(false);
-			for( j=bounds.lo.y; j<=bounds.hi.y; j++ )	{
-				for( i=bounds.lo.x; i<=bounds.hi.x; i++ )	{
-					PathfindCell *cell = &map[i][j];
-					cell->setZone(0);
+	ZoneJobData jobData;
+	jobData.map = map;
+	jobData.layers = layers;
+	jobData.globalBounds = globalBounds;
+	jobData.blockExtent = m_zoneBlockExtent;
+	jobData.blocks = m_blockOfZoneBlocks;
+	jobData.zoneBases = m_blockZoneBases;
 
-					if (i>bounds.lo.x) {
-						if (map[i][j].getType() == map[i-1][j].getType()) {
-							applyZone(map[i][j], map[i-1][j], zoneEquivalency, m_maxZone);
-						}
-					}
-					if (j>bounds.lo.y) {
-						if (map[i][j].getType() == map[i][j-1].getType()) {
-							applyZone(map[i][j], map[i][j-1], zoneEquivalency, m_maxZone);
-						}
-					}
-					if (cell->getZone()==0) {
-						cell->setZone(m_maxZone);
-						m_maxZone++;
-#if RTS_GENERALS && RETAIL_COMPATIBLE_PATHFINDING
-						if (m_maxZone>= maxZones) {
-							DEBUG_CRASH(("Ran out of pathfind zones.  SERIOUS ERROR! jba."));
-							break;
-						}
-#endif
-					}
-					if (cell->getConnectLayer() > LAYER_GROUND) {
- 						m_zoneBlocks[xBlock][yBlock].setInteractsWithBridge(true);
-					}
+	const Int blockCount = m_zoneBlockExtent.x*m_zoneBlockExtent.y;
+	WorkerThreadPool::parallelFor(labelBlockJob, &jobData, blockCount);
 
-				}
-			}
- 		}
+	// The zones of the blocks follow each other in the order the full map numbering visited the blocks.
+	Int totalZones = 1;	// we start using zone 0 as a flag.
+	for (i=0; i<blockCount; i++) {
+		ZoneBlock &block = m_blockOfZoneBlocks[i];
+		block.setInteractsWithBridge(block.getCellsInteractWithBridge());
+		m_blockZoneBases[i] = totalZones-1;
+		totalZones += block.getNumCellZones();
 	}
 
-	Int totalZones = m_maxZone;
-
-	// Collapse the zones into a 1,2,3... sequence, removing collapsed zones.
-	m_maxZone = 1;
-	Int collapsedZones[maxZones];
-	collapsedZones[0] = 0;
-	for (i=1; i<totalZones; i++) {
-		Int zone = zoneEquivalency[i];
-		if (zone == i) {
-			collapsedZones[i] = m_maxZone;
-			++m_maxZone;
-		} else {
-			collapsedZones[i] = collapsedZones[zone];
-		}
+	if (totalZones + LAYER_LAST + 1 > 0xffff) {
+		RELEASE_CRASH("Ran out of pathfind zones - fatal.");
 	}
+	m_maxZone = totalZones;
 
-	// Now map the zones in the map back into the collapsed zones.
-	for( j=globalBounds.lo.y; j<=globalBounds.hi.y; j++ ) {
-		for( i=globalBounds.lo.x; i<=globalBounds.hi.x; i++ ) {
-			PathfindCell &cell = map[i][j];
-			cell.setZone(collapsedZones[cell.getZone()]);
-		}
-	}
-	
 	for (i=0; i<=LAYER_LAST; i++) {
 		PathfindLayer &r_thisLayer = layers[i];
 
-		Int zone = collapsedZones[r_thisLayer.getZone()];
-		if (zone == 0) {
-			zone = m_maxZone;
-			m_maxZone++;
-		}
-
-		r_thisLayer.setZone( zone );
+		// The layers follow the cells, one zone each.
+		r_thisLayer.setZone( m_maxZone );
+		m_maxZone++;
 		r_thisLayer.applyZone();
 
 		if (!r_thisLayer.isUnused() && !r_thisLayer.isDestroyed()) {
@@ -2828,28 +3125,7 @@ void PathfindZoneManager::calculateZones( PathfindCell **map, PathfindLayer laye
 
 	allocateZones();
 
-	for (xBlock=0; xBlock<xCount; xBlock++) {
-		for (yBlock=0; yBlock<yCount; yBlock++) {
-			IRegion2D bounds;
-			bounds.lo.x = globalBounds.lo.x + xBlock*ZONE_BLOCK_SIZE;
-			bounds.lo.y = globalBounds.lo.y + yBlock*ZONE_BLOCK_SIZE;
-			bounds.hi.x = bounds.lo.x + ZONE_BLOCK_SIZE - 1; // bounds are inclusive.
-			bounds.hi.y = bounds.lo.y + ZONE_BLOCK_SIZE - 1; // bounds are inclusive.
-
-			if (bounds.hi.x > globalBounds.hi.x)
-				bounds.hi.x = globalBounds.hi.x;
-
-			if (bounds.hi.y > globalBounds.hi.y)
-				bounds.hi.y = globalBounds.hi.y;
-#if RTS_GENERALS && RETAIL_COMPATIBLE_PATHFINDING
-			if (bounds.lo.x>bounds.hi.x || bounds.lo.y>bounds.hi.y) {
-				DEBUG_CRASH(("Incorrect bounds calculation. Logic error, fix me. jba."));
-				continue;
-			}
-#endif
-			m_zoneBlocks[xBlock][yBlock].blockCalculateZones(map, layers, bounds);
-		}
-	}
+	WorkerThreadPool::parallelFor(finishBlockJob, &jobData, blockCount);
 
 	// Determine water/ground equivalent zones, and ground/cliff equivalent zones.
 	for (i=0; i<m_zonesAllocated; i++) {
@@ -2868,7 +3144,7 @@ void PathfindZoneManager::calculateZones( PathfindCell **map, PathfindLayer laye
 			if ( (r_thisCell.getConnectLayer() > LAYER_GROUND) &&
 				(r_thisCell.getType() == PathfindCell::CELL_CLEAR) ) {
 				PathfindLayer *layer = layers + r_thisCell.getConnectLayer();
-				resolveZones(r_thisCell.getZone(), layer->getZone(), m_hierarchicalZones, m_maxZone);
+				unionZones(r_thisCell.getZone(), layer->getZone(), m_hierarchicalZones);
 			}
 
 			if ( i > globalBounds.lo.x && r_thisCell.getZone() != map[i-1][j].getZone() ) {
@@ -2876,47 +3152,47 @@ void PathfindZoneManager::calculateZones( PathfindCell **map, PathfindLayer laye
 
 #if RTS_GENERALS && RETAIL_COMPATIBLE_PATHFINDING
 				if (r_thisCell.getType() == r_leftCell.getType()) {
-					applyZone(r_thisCell, r_leftCell, m_hierarchicalZones, m_maxZone);
+					unionCellZones(r_thisCell, r_leftCell, m_hierarchicalZones);
 				}
 				if (waterGround(r_thisCell, r_leftCell)) {
-					applyZone(r_thisCell, r_leftCell, m_groundWaterZones, m_maxZone);
+					unionCellZones(r_thisCell, r_leftCell, m_groundWaterZones);
 				}
 				if (groundRubble(r_thisCell, r_leftCell)) {
-					applyZone(r_thisCell, r_leftCell, m_groundRubbleZones, m_maxZone);
+					unionCellZones(r_thisCell, r_leftCell, m_groundRubbleZones);
 				}
 				if (groundCliff(r_thisCell, r_leftCell)) {
-					applyZone(r_thisCell, r_leftCell, m_groundCliffZones, m_maxZone);
+					unionCellZones(r_thisCell, r_leftCell, m_groundCliffZones);
 				}
 				if (terrain(r_thisCell, r_leftCell)) {
-					applyZone(r_thisCell, r_leftCell, m_terrainZones, m_maxZone);
+					unionCellZones(r_thisCell, r_leftCell, m_terrainZones);
 				}
 				if (crusherGround(r_thisCell, r_leftCell)) {
-					applyZone(r_thisCell, r_leftCell, m_crusherZones, m_maxZone);
+					unionCellZones(r_thisCell, r_leftCell, m_crusherZones);
 				}
 #else
 				//if this is true, skip all the ones below
 				if (r_thisCell.getType() == r_leftCell.getType())
-					applyZone(r_thisCell, r_leftCell, m_hierarchicalZones, m_maxZone);
+					unionCellZones(r_thisCell, r_leftCell, m_hierarchicalZones);
 				else {
 					Bool notTerrainOrCrusher = TRUE; // if this is false, skip the if-else-ladder below
 
 					if (terrain(r_thisCell, r_leftCell)) {
-						applyZone(r_thisCell, r_leftCell, m_terrainZones, m_maxZone);
+						unionCellZones(r_thisCell, r_leftCell, m_terrainZones);
 						notTerrainOrCrusher = FALSE;
 					}
 
 					if (crusherGround(r_thisCell, r_leftCell)) {
-						applyZone(r_thisCell, r_leftCell, m_crusherZones, m_maxZone);
+						unionCellZones(r_thisCell, r_leftCell, m_crusherZones);
 						notTerrainOrCrusher = FALSE;
 					}
 
 					if ( notTerrainOrCrusher ) {
 						if (waterGround(r_thisCell, r_leftCell))
-							applyZone(r_thisCell, r_leftCell, m_groundWaterZones, m_maxZone);
+							unionCellZones(r_thisCell, r_leftCell, m_groundWaterZones);
 						else if (groundRubble(r_thisCell, r_leftCell))
-							applyZone(r_thisCell, r_leftCell, m_groundRubbleZones, m_maxZone);
+							unionCellZones(r_thisCell, r_leftCell, m_groundRubbleZones);
 						else if (groundCliff(r_thisCell, r_leftCell))
-							applyZone(r_thisCell, r_leftCell, m_groundCliffZones, m_maxZone);
+							unionCellZones(r_thisCell, r_leftCell, m_groundCliffZones);
 					}
 
 				}
@@ -2929,47 +3205,47 @@ void PathfindZoneManager::calculateZones( PathfindCell **map, PathfindLayer laye
 
 #if RTS_GENERALS && RETAIL_COMPATIBLE_PATHFINDING
 				if (r_thisCell.getType() == r_topCell.getType()) {
-					applyZone(r_thisCell, r_topCell, m_hierarchicalZones, m_maxZone);
+					unionCellZones(r_thisCell, r_topCell, m_hierarchicalZones);
 				}
 				if (waterGround(r_thisCell, r_topCell)) {
-					applyZone(r_thisCell, r_topCell, m_groundWaterZones, m_maxZone);
+					unionCellZones(r_thisCell, r_topCell, m_groundWaterZones);
 				}
 				if (groundRubble(r_thisCell, r_topCell)) {
-					applyZone(r_thisCell, r_topCell, m_groundRubbleZones, m_maxZone);
+					unionCellZones(r_thisCell, r_topCell, m_groundRubbleZones);
 				}
 				if (groundCliff(r_thisCell, r_topCell)) {
-					applyZone(r_thisCell, r_topCell, m_groundCliffZones, m_maxZone);
+					unionCellZones(r_thisCell, r_topCell, m_groundCliffZones);
 				}
 				if (terrain(r_thisCell, r_topCell)) {
-					applyZone(r_thisCell, r_topCell, m_terrainZones, m_maxZone);
+					unionCellZones(r_thisCell, r_topCell, m_terrainZones);
 				}
 				if (crusherGround(r_thisCell, r_topCell)) {
-					applyZone(r_thisCell, r_topCell, m_crusherZones, m_maxZone);
+					unionCellZones(r_thisCell, r_topCell, m_crusherZones);
 				}
 #else
 				//if this is true, skip all the ones below
 				if (r_thisCell.getType() == r_topCell.getType())
-					applyZone(r_thisCell, r_topCell, m_hierarchicalZones, m_maxZone);
+					unionCellZones(r_thisCell, r_topCell, m_hierarchicalZones);
 				else {
 					Bool notTerrainOrCrusher = TRUE; // if this is false, skip the if-else-ladder below
 
 					if (terrain(r_thisCell, r_topCell)) {
-						applyZone(r_thisCell, r_topCell, m_terrainZones, m_maxZone);
+						unionCellZones(r_thisCell, r_topCell, m_terrainZones);
 						notTerrainOrCrusher = FALSE;
 					}
 
 					if (crusherGround(r_thisCell, r_topCell)) {
-						applyZone(r_thisCell, r_topCell, m_crusherZones, m_maxZone);
+						unionCellZones(r_thisCell, r_topCell, m_crusherZones);
 						notTerrainOrCrusher = FALSE;
 					}
 
 					if (notTerrainOrCrusher) {
 						if (waterGround(r_thisCell, r_topCell))
-							applyZone(r_thisCell, r_topCell, m_groundWaterZones, m_maxZone);
+							unionCellZones(r_thisCell, r_topCell, m_groundWaterZones);
 						else if (groundRubble(r_thisCell, r_topCell))
-							applyZone(r_thisCell, r_topCell, m_groundRubbleZones, m_maxZone);
+							unionCellZones(r_thisCell, r_topCell, m_groundRubbleZones);
 						else if (groundCliff(r_thisCell, r_topCell))
-							applyZone(r_thisCell, r_topCell, m_groundCliffZones, m_maxZone);
+							unionCellZones(r_thisCell, r_topCell, m_groundCliffZones);
 					}
 
 				}
@@ -2981,10 +3257,12 @@ void PathfindZoneManager::calculateZones( PathfindCell **map, PathfindLayer laye
 	}
 
 	//FLATTEN HIERARCHICAL ZONES
-	for (i=1; i<m_maxZone; i++) {
-		Int zone = m_hierarchicalZones[i];
-		m_hierarchicalZones[i] = m_hierarchicalZones[zone];
-	}
+	flattenRootZones(m_hierarchicalZones, m_maxZone);
+	flattenRootZones(m_groundCliffZones, m_maxZone);
+	flattenRootZones(m_groundWaterZones, m_maxZone);
+	flattenRootZones(m_groundRubbleZones, m_maxZone);
+	flattenRootZones(m_terrainZones, m_maxZone);
+	flattenRootZones(m_crusherZones, m_maxZone);
 
 	//THIS BLOCK IS 20%
 	flattenZones(m_groundCliffZones, m_hierarchicalZones, m_maxZone);
@@ -3069,6 +3347,9 @@ void PathfindZoneManager::updateZonesForModify(PathfindCell **map, PathfindLayer
 		bounds.hi.y = globalBounds.hi.y;
 	}
 
+	// The cells get zones of their neighbors here, so the next zone calculation must number them again.
+	markBlocksDirty(bounds);
+
 	Int xBlock, yBlock;
 	for (xBlock = 0; xBlock<m_zoneBlockExtent.x; xBlock++) {
 		for (yBlock=0; yBlock<m_zoneBlockExtent.y; yBlock++) {
@@ -4342,7 +4623,7 @@ void Pathfinder::classifyFence( Object *obj, Bool insert )
  	}
 #if !(RTS_GENERALS && RETAIL_COMPATIBLE_PATHFINDING)
 	if (didAnything) {
-		m_zoneManager.markZonesDirty();
+		m_zoneManager.markZonesDirty(cellBounds);
 		m_zoneManager.updateZonesForModify(m_map, m_layers, cellBounds, m_extent);
 	}
 #endif
@@ -4415,6 +4696,7 @@ void Pathfinder::classifyObjectFootprint( Object *obj, Bool insert )
 				}
 				// recalc the wall.
 				m_layers[LAYER_WALL].classifyWallCells(m_wallPieces, m_numWallPieces);
+				m_zoneManager.markZonesDirty();
 			}
 		}
 	}
@@ -4457,7 +4739,9 @@ void Pathfinder::internal_classifyObjectFootprint( Object *obj, Bool insert )
 	{
 		case GEOMETRY_BOX:
 		{
+#if RTS_GENERALS && RETAIL_COMPATIBLE_PATHFINDING
 			m_zoneManager.markZonesDirty();
+#endif
 			Real angle = obj->getOrientation();
 
 			Real halfsizeX = obj->getGeometryInfo().getMajorRadius();
@@ -4529,7 +4813,9 @@ void Pathfinder::internal_classifyObjectFootprint( Object *obj, Bool insert )
 		case GEOMETRY_SPHERE:	// not quite right, but close enough
 		case GEOMETRY_CYLINDER:
 		{
+#if RTS_GENERALS && RETAIL_COMPATIBLE_PATHFINDING
 			m_zoneManager.markZonesDirty();
+#endif
 			// fill in all cells that overlap as obstacle cells
 			/// @todo This is a very inefficient circle-rasterizer
 			ICoord2D topLeft, bottomRight;
@@ -4634,6 +4920,11 @@ void Pathfinder::internal_classifyObjectFootprint( Object *obj, Bool insert )
 		cellBounds.hi.y = m_extent.hi.y;
 	}
 
+#if !(RTS_GENERALS && RETAIL_COMPATIBLE_PATHFINDING)
+	// TheSuperHackers @performance Only the cells in the bounds change their type, so only their zone blocks are numbered again.
+	m_zoneManager.markZonesDirty(cellBounds);
+#endif
+
 	if (!insert) {
 		for( j=cellBounds.lo.y; j<=cellBounds.hi.y; j++ )
 		{
@@ -5037,6 +5328,7 @@ void Pathfinder::classifyMap()
 	if (!m_layers[LAYER_WALL].isUnused()) {
 		m_layers[LAYER_WALL].classifyWallCells(m_wallPieces, m_numWallPieces);
 	}
+	m_zoneManager.markZonesDirty();
 	m_zoneManager.calculateZones(m_map, m_layers, m_extent);
 }
 
@@ -5068,8 +5360,14 @@ void Pathfinder::debugShowSearch(  Bool pathFound  )
 		addIcon(nullptr, 0, 0, color);	 // erase.
 	}
 
+#if USE_PATHFIND_OPEN_LIST_HEAP
+	for( Int i = 0; i < m_openList.getOpenHeapCount(); ++i )
+	{
+		s = m_openList.getOpenHeapCell(i);
+#else
 	for( s = m_openList.getHead(); s; s=s->getNextOpen() )
 	{
+#endif
 		// create objects to show path - they decay
 		RGBColor color;
 		color.red = color.green = 0;
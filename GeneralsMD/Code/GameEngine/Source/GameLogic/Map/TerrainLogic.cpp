@@ -1500,6 +1500,31 @@ Real TerrainLogic::getLayerHeight( Real x, Real y, PathfindLayerEnum layer, Coor
 
 }
 
+//-------------------------------------------------------------------------------------------------
+/** default get heights for terrain logic */
+//-------------------------------------------------------------------------------------------------
+void TerrainLogic::getGroundHeights( const Coord2D *points, Real *heights, Int count ) const
+{
+	for (Int i = 0; i < count; ++i)
+		heights[i] = getGroundHeight(points[i].x, points[i].y);
+}
+
+//-------------------------------------------------------------------------------------------------
+/** default raw map height for terrain logic */
+//-------------------------------------------------------------------------------------------------
+Int TerrainLogic::getRawMapHeight( const ICoord2D *gridPos ) const
+{
+	return TheTerrainVisual->getRawMapHeight(gridPos);
+}
+
+//-------------------------------------------------------------------------------------------------
+/** default set raw map height for terrain logic */
+//-------------------------------------------------------------------------------------------------
+void TerrainLogic::setRawMapHeight( const ICoord2D *gridPos, Int height )
+{
+	TheTerrainVisual->setRawMapHeight(gridPos, height);
+}
+
 //-------------------------------------------------------------------------------------------------
 /** default isCliffCell for terrain logic */
 //-------------------------------------------------------------------------------------------------
@@ -2958,33 +2983,33 @@ void TerrainLogic::flattenTerrain(Object *obj)
 						ICoord2D gridPos;
 						gridPos.x = i;
 						gridPos.y = j;
-						TheTerrainVisual->setRawMapHeight(&gridPos, rawDataHeight);
+						setRawMapHeight(&gridPos, rawDataHeight);
 						gridPos.x = i-1;
 						gridPos.y = j;
-						TheTerrainVisual->setRawMapHeight(&gridPos, rawDataHeight);
+						setRawMapHeight(&gridPos, rawDataHeight);
 						gridPos.x = i+1;
 						gridPos.y = j;
-						TheTerrainVisual->setRawMapHeight(&gridPos, rawDataHeight);
+						setRawMapHeight(&gridPos, rawDataHeight);
 						gridPos.x = i;
 						gridPos.y = j-1;
-						TheTerrainVisual->setRawMapHeight(&gridPos, rawDataHeight);
+						setRawMapHeight(&gridPos, rawDataHeight);
 						gridPos.x = i;
 						gridPos.y = j+1;
-						TheTerrainVisual->setRawMapHeight(&gridPos, rawDataHeight);
+						setRawMapHeight(&gridPos, rawDataHeight);
 
 						//Added the corners so it does a whole 3X3 square... ML
 						gridPos.x = i-1;
 						gridPos.y = j-1;
-						TheTerrainVisual->setRawMapHeight(&gridPos, rawDataHeight);
+						setRawMapHeight(&gridPos, rawDataHeight);
 						gridPos.x = i+1;
 						gridPos.y = j+1;
-						TheTerrainVisual->setRawMapHeight(&gridPos, rawDataHeight);
+						setRawMapHeight(&gridPos, rawDataHeight);
 						gridPos.x = i+1;
 						gridPos.y = j-1;
-						TheTerrainVisual->setRawMapHeight(&gridPos, rawDataHeight);
+						setRawMapHeight(&gridPos, rawDataHeight);
 						gridPos.x = i-1;
 						gridPos.y = j+1;
-						TheTerrainVisual->setRawMapHeight(&gridPos, rawDataHeight);
+						setRawMapHeight(&gridPos, rawDataHeight);
 
 					}
 				}
@@ -3039,33 +3064,33 @@ void TerrainLogic::flattenTerrain(Object *obj)
 						ICoord2D gridPos;
 						gridPos.x = i;
 						gridPos.y = j;
-						TheTerrainVisual->setRawMapHeight(&gridPos, rawDataHeight);
+						setRawMapHeight(&gridPos, rawDataHeight);
 						gridPos.x = i-1;
 						gridPos.y = j;
-						TheTerrainVisual->setRawMapHeight(&gridPos, rawDataHeight);
+						setRawMapHeight(&gridPos, rawDataHeight);
 						gridPos.x = i+1;
 						gridPos.y = j;
-						TheTerrainVisual->setRawMapHeight(&gridPos, rawDataHeight);
+						setRawMapHeight(&gridPos, rawDataHeight);
 						gridPos.x = i;
 						gridPos.y = j-1;
-						TheTerrainVisual->setRawMapHeight(&gridPos, rawDataHeight);
+						setRawMapHeight(&gridPos, rawDataHeight);
 						gridPos.x = i;
 						gridPos.y = j+1;
-						TheTerrainVisual->setRawMapHeight(&gridPos, rawDataHeight);
+						setRawMapHeight(&gridPos, rawDataHeight);
 
 						//Added the corners so it does a whole 3X3 square... ML
 						gridPos.x = i-1;
 						gridPos.y = j-1;
-						TheTerrainVisual->setRawMapHeight(&gridPos, rawDataHeight);
+						setRawMapHeight(&gridPos, rawDataHeight);
 						gridPos.x = i+1;
 						gridPos.y = j+1;
-						TheTerrainVisual->setRawMapHeight(&gridPos, rawDataHeight);
+						setRawMapHeight(&gridPos, rawDataHeight);
 						gridPos.x = i+1;
 						gridPos.y = j-1;
-						TheTerrainVisual->setRawMapHeight(&gridPos, rawDataHeight);
+						setRawMapHeight(&gridPos, rawDataHeight);
 						gridPos.x = i-1;
 						gridPos.y = j+1;
-						TheTerrainVisual->setRawMapHeight(&gridPos, rawDataHeight);
+						setRawMapHeight(&gridPos, rawDataHeight);
 
 
 					}
@@ -3102,13 +3127,21 @@ Real TerrainLogic::getShipyardPlacementAngle(const Coord3D & worldPos, const Thi
 	}  // end else
 
 	//Check 4 sample points
-	Real hx1 = TheTerrainLogic->getGroundHeight(worldPos.x + check_radius, worldPos.y);
-	Real hx2 = TheTerrainLogic->getGroundHeight(worldPos.x - check_radius, worldPos.y);
-	Real hy1 = TheTerrainLogic->getGroundHeight(worldPos.x, worldPos.y + check_radius);
-	Real hy2 = TheTerrainLogic->getGroundHeight(worldPos.x, worldPos.y - check_radius);
-
-	Real dx = hx1 - hx2;
-	Real dy = hy1 - hy2;
+	Coord2D samplePoints[4];
+	samplePoints[0].x = worldPos.x + check_radius;
+	samplePoints[0].y = worldPos.y;
+	samplePoints[1].x = worldPos.x - check_radius;
+	samplePoints[1].y = worldPos.y;
+	samplePoints[2].x = worldPos.x;
+	samplePoints[2].y = worldPos.y + check_radius;
+	samplePoints[3].x = worldPos.x;
+	samplePoints[3].y = worldPos.y - check_radius;
+
+	Real sampleHeights[4];
+	getGroundHeights(samplePoints, sampleHeights, 4);
+
+	Real dx = sampleHeights[0] - sampleHeights[1];
+	Real dy = sampleHeights[2] - sampleHeights[3];
 
 	Coord2D v;
 	v.x = dx;
@@ -3164,9 +3197,9 @@ void TerrainLogic::createCraterInTerrain(Object *obj)
 
         Real displacementAmount = radius * (1.0f - distance / radius );
 
-        Int targetHeight = MAX( 1, TheTerrainVisual->getRawMapHeight( &gridPos ) - displacementAmount );
+        Int targetHeight = MAX( 1, getRawMapHeight( &gridPos ) - displacementAmount );
 
-				TheTerrainVisual->setRawMapHeight( &gridPos, targetHeight );
+				setRawMapHeight( &gridPos, targetHeight );
 			}
     }
   }
@@ -384,8 +384,8 @@ Real ActiveBody::estimateDamage( DamageInfoInput& damageInfo ) const
 	// Compute Armor Bonuses based on Status Types, Weapon Bonus Conditions and Custom Weapon Bonus Conditions
 	ObjectStatusMaskType objStatus = getObject()->getStatusBits();
 	WeaponBonusConditionFlags objFlags = getObject()->getWeaponBonusCondition();
-	std::vector<AsciiString> objCustomStatus = getObject()->getCustomStatus();
-	std::vector<AsciiString> objCustomFlags = getObject()->getCustomWeaponBonusCondition();
+	const std::vector<AsciiString>& objCustomStatus = getObject()->getCustomStatus();
+	const std::vector<AsciiString>& objCustomFlags = getObject()->getCustomWeaponBonusCondition();
 	amount *= m_curArmor.scaleArmorBonus(objStatus, objFlags, objCustomStatus, objCustomFlags);
 	
 	// Compute damage according to Armor Coefficient.
@@ -493,8 +493,8 @@ void ActiveBody::attemptDamage( DamageInfo *damageInfo )
 
 	ObjectStatusMaskType objStatus = obj->getStatusBits();
 	WeaponBonusConditionFlags objFlags = obj->getWeaponBonusCondition();
-	std::vector<AsciiString> objCustomStatus = obj->getCustomStatus();
-	std::vector<AsciiString> objCustomFlags = obj->getCustomWeaponBonusCondition();
+	const std::vector<AsciiString>& objCustomStatus = obj->getCustomStatus();
+	const std::vector<AsciiString>& objCustomFlags = obj->getCustomWeaponBonusCondition();
 	armorBonus *= m_curArmor.scaleArmorBonus(objStatus, objFlags, objCustomStatus, objCustomFlags);
 
 	amount *= armorBonus;
@@ -882,24 +882,20 @@ void ActiveBody::attemptDamage( DamageInfo *damageInfo )
 		// if our health has gone down then do run the damage module callback
 		if( m_currentHealth < m_prevHealth && doDamageModules)
 		{
-			for (BehaviorModule** m = obj->getBehaviorModules(); *m; ++m)
+			const Int damageCount = obj->getDispatchModuleCount(MODULEDISPATCH_DAMAGE);
+			for (Int i = 0; i < damageCount; ++i)
 			{
-				DamageModuleInterface* d = (*m)->getDamage();
-				if (!d)
-					continue;
-
+				DamageModuleInterface* d = obj->getDispatchModule(MODULEDISPATCH_DAMAGE, i)->getDamage();
 				d->onDamage( damageInfo );
 			}
 		}
 
 		if (m_curDamageState != oldState && adjustConditions)
 		{
-			for (BehaviorModule** m = obj->getBehaviorModules(); *m; ++m)
+			const Int damageCount = obj->getDispatchModuleCount(MODULEDISPATCH_DAMAGE);
+			for (Int i = 0; i < damageCount; ++i)
 			{
-				DamageModuleInterface* d = (*m)->getDamage();
-				if (!d)
-					continue;
-
+				DamageModuleInterface* d = obj->getDispatchModule(MODULEDISPATCH_DAMAGE, i)->getDamage();
 				d->onBodyDamageStateChange( damageInfo, oldState, m_curDamageState );
 			}
 
@@ -1135,12 +1131,10 @@ void ActiveBody::attemptHealing( DamageInfo *damageInfo )
 		// if our health has gone UP then do run the damage module callback
 		if( m_currentHealth > m_prevHealth )
 		{
-			for (BehaviorModule** m = obj->getBehaviorModules(); *m; ++m)
+			const Int damageCount = obj->getDispatchModuleCount(MODULEDISPATCH_DAMAGE);
+			for (Int i = 0; i < damageCount; ++i)
 			{
-				DamageModuleInterface* d = (*m)->getDamage();
-				if (!d)
-					continue;
-
+				DamageModuleInterface* d = obj->getDispatchModule(MODULEDISPATCH_DAMAGE, i)->getDamage();
 				d->onHealing( damageInfo );
 			}
 
@@ -1151,12 +1145,10 @@ void ActiveBody::attemptHealing( DamageInfo *damageInfo )
 
 		if (m_curDamageState != oldState)
 		{
-			for (BehaviorModule** m = obj->getBehaviorModules(); *m; ++m)
+			const Int damageCount = obj->getDispatchModuleCount(MODULEDISPATCH_DAMAGE);
+			for (Int i = 0; i < damageCount; ++i)
 			{
-				DamageModuleInterface* d = (*m)->getDamage();
-				if (!d)
-					continue;
-
+				DamageModuleInterface* d = obj->getDispatchModule(MODULEDISPATCH_DAMAGE, i)->getDamage();
 				d->onBodyDamageStateChange( damageInfo, oldState, m_curDamageState );
 			}
 		}
@@ -1521,6 +1513,8 @@ void ActiveBody::internalChangeHealth( Real delta, Bool changeModelCondition)
 	if( m_currentHealth < lowEndCap )
 		m_currentHealth = lowEndCap;
 
+	getObject()->markCRCDirty();
+
 	if (changeModelCondition) {
 		// recalc the damage state
 		BodyDamageType oldState = m_curDamageState;
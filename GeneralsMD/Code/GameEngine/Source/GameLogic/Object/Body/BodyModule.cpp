@@ -31,6 +31,17 @@
 #include "PreRTS.h"
 #include "Common/Xfer.h"
 #include "GameLogic/Module/BodyModule.h"
+#include "GameLogic/Object.h"
+
+// ------------------------------------------------------------------------------------------------
+// ------------------------------------------------------------------------------------------------
+void BodyModule::applyDamageScalar( Real scalar )
+{
+
+	m_damageScalar *= scalar;
+	getObject()->markCRCDirty();
+
+}
 
 // ------------------------------------------------------------------------------------------------
 /** CRC */
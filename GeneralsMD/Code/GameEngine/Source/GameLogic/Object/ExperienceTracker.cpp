@@ -75,12 +75,14 @@ Bool ExperienceTracker::isTrainable() const
 void ExperienceTracker::setTrainable(Bool trainable)
 {
 	m_isTrainable = trainable;
+	m_parent->markCRCDirty();
 }
 
 //-------------------------------------------------------------------------------------------------
 void ExperienceTracker::resetTrainable()
 {
 	m_isTrainable = m_parent->getTemplate()->isTrainable();
+	m_parent->markCRCDirty();
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -130,6 +132,7 @@ void ExperienceTracker::setMinVeterancyLevel( VeterancyLevel newLevel, Bool prov
 		VeterancyLevel oldLevel = m_currentLevel;
 		m_currentLevel = newLevel;
 		m_currentExperience = m_parent->getTemplate()->getExperienceRequired(m_currentLevel); //Minimum for this level
+		m_parent->markCRCDirty();
 		if (m_parent)
 			m_parent->onVeterancyLevelChanged( oldLevel, newLevel, provideFeedback );
 	}
@@ -147,6 +150,7 @@ void ExperienceTracker::setVeterancyLevel( VeterancyLevel newLevel, Bool provide
 		VeterancyLevel oldLevel = m_currentLevel;
 		m_currentLevel = newLevel;
 		m_currentExperience = m_parent->getTemplate()->getExperienceRequired(m_currentLevel); //Minimum for this level
+		m_parent->markCRCDirty();
 		if (m_parent)
 			m_parent->onVeterancyLevelChanged( oldLevel, newLevel, provideFeedback );
 	}
@@ -218,6 +222,7 @@ void ExperienceTracker::addExperiencePoints( Int experienceGain, Bool canScaleFo
 	}
 
 	m_currentLevel = (VeterancyLevel)levelIndex;
+	m_parent->markCRCDirty();
 
 	if( oldLevel != m_currentLevel )
 	{
@@ -259,6 +264,7 @@ void ExperienceTracker::setExperienceAndLevel( Int experienceIn, Bool provideFee
 	}
 
 	m_currentLevel = (VeterancyLevel)levelIndex;
+	m_parent->markCRCDirty();
 
 	if( oldLevel != m_currentLevel )
 	{
@@ -290,6 +296,7 @@ void ExperienceTracker::setHighestExpOrLevel( Int experienceGain, VeterancyLevel
 	}
 
 	m_currentLevel = (VeterancyLevel)levelIndex;
+	m_parent->markCRCDirty();
 
 	if( oldLevel != m_currentLevel )
 	{
@@ -246,6 +246,8 @@ Object::Object( const ThingTemplate *tt, const ObjectStatusMaskType &objectStatu
 	m_xferContainedByID(INVALID_ID),
 	m_containedByFrame(0),
 	m_behaviors(nullptr),
+	m_moduleDispatch(nullptr),
+	m_firstTemplateModule(0),
 	m_body(nullptr),
 	m_contain(nullptr),
   m_stealth(nullptr),
@@ -291,6 +293,10 @@ Object::Object( const ThingTemplate *tt, const ObjectStatusMaskType &objectStatu
 {
 #if defined(RTS_DEBUG)
 	m_hasDiedAlready = false;
+#endif
+#if ENABLE_INCREMENTAL_CRC
+	m_crcDirty = TRUE;
+	m_cachedCRC = 0;
 #endif
 	//Modules have not been created yet!
 	m_modulesReady = false;
@@ -355,6 +361,7 @@ Object::Object( const ThingTemplate *tt, const ObjectStatusMaskType &objectStatu
 	m_status = objectStatusMask;
 	//m_customStatus.clear();
 	m_customStatusSet.clear();
+	m_customStatusFlags.clear();
 	m_layer = LAYER_GROUND;
 
 	m_weaponBonusConditionIC = 0;
@@ -539,6 +546,8 @@ Object::Object( const ThingTemplate *tt, const ObjectStatusMaskType &objectStatu
 
 	Bool hasSpecialPowerModule = FALSE;
 
+	m_firstTemplateModule = (Short)(curB - m_behaviors);
+
 	m_hasParasiteCrateCollide = FALSE;
 
 	// behaviors are always done first, so they get into the publicModule arrays
@@ -634,6 +643,11 @@ Object::Object( const ThingTemplate *tt, const ObjectStatusMaskType &objectStatu
 
 	*curB = nullptr;
 
+	m_moduleDispatch = &mi.getDispatch(m_behaviors + m_firstTemplateModule);
+#ifdef DEBUG_CRASHING
+	validateModuleDispatch();
+#endif
+
 	AIUpdateInterface *ai = getAIUpdateInterface();
 	if (ai) {
 		ai->setAttitude(getTeam()->getPrototype()->getTemplateInfo()->m_initialTeamAttitude);
@@ -784,11 +798,10 @@ void Object::initObject()
 
 	//For each special power module that we have, add it's type to the specialpower bits. This is
 	//for optimal access later.
-	for (BehaviorModule** m = m_behaviors; *m; ++m)
+	const Int specialPowerCount = getDispatchModuleCount(MODULEDISPATCH_SPECIAL_POWER);
+	for (Int i = 0; i < specialPowerCount; ++i)
 	{
-		SpecialPowerModuleInterface* sp = (*m)->getSpecialPower();
-		if (!sp)
-			continue;
+		SpecialPowerModuleInterface* sp = getDispatchModule(MODULEDISPATCH_SPECIAL_POWER, i)->getSpecialPower();
 
 		const SpecialPowerTemplate *spTemplate = sp->getSpecialPowerTemplate();
 		if( spTemplate )
@@ -887,6 +900,9 @@ Object::~Object()
 
 	m_hasParasiteCrateCollide = FALSE;
 
+	// the dispatch would still find the modules below after they were deleted
+	m_moduleDispatch = nullptr;
+
 	// delete any modules present
 	for (BehaviorModule** b = m_behaviors; *b; ++b)
 	{
@@ -1074,6 +1090,8 @@ void Object::friend_setUndetectedDefector( Bool status )
 		m_privateStatus |= UNDETECTED_DEFECTOR;
 	else
 		m_privateStatus &= ~UNDETECTED_DEFECTOR;
+
+	markCRCDirty();
 }
 
 //=============================================================================
@@ -1326,9 +1344,11 @@ void Object::setCustomStatus( const AsciiString& customStatus, Bool set )
 	// A faster way of determining whether to trigger status change.
 	Bool isDifferent = false;
 
+	// TheSuperHackers @performance The interned bits decide whether anything changes, the string
+	// vector is only kept to preserve the set order for iteration, save games and the CRC.
 	if(set)
 	{
-		if(!checkWithinStringVec(customStatus, m_customStatusSet))
+		if(m_customStatusFlags.set(TheCustomStatusRegistry->intern(customStatus), TRUE))
 		{
 			isDifferent = TRUE;
 			m_customStatusSet.push_back(customStatus);
@@ -1336,7 +1356,8 @@ void Object::setCustomStatus( const AsciiString& customStatus, Bool set )
 	}
 	else
 	{
-		isDifferent = removeWithinStringVec(customStatus, m_customStatusSet);
+		if(m_customStatusFlags.reset(TheCustomStatusRegistry->find(customStatus)))
+			isDifferent = removeWithinStringVec(customStatus, m_customStatusSet);
 	}
 
 	// TO-DO: Change to Hash_Map. DONE.
@@ -1395,7 +1416,7 @@ void Object::setCustomStatus( const AsciiString& customStatus, Bool set )
 //=============================================================================
 Bool Object::testCustomStatus(const AsciiString& cst) const
 {
-	return checkWithinStringVec(cst, m_customStatusSet);
+	return m_customStatusFlags.test(TheCustomStatusRegistry->find(cst));
 }
 
 //=============================================================================
@@ -1410,9 +1431,12 @@ void Object::setCustomStatus( const std::vector<AsciiString>& customStatus, Bool
 
 	for(std::vector<AsciiString>::const_iterator it = customStatus.begin(); it != customStatus.end(); ++it)
 	{
+		if(it->isEmpty())
+			continue;
+
 		if(set)
 		{
-			if(!checkWithinStringVec((*it), m_customStatusSet))
+			if(m_customStatusFlags.set(TheCustomStatusRegistry->intern(*it), TRUE))
 			{
 				isDifferent = TRUE;
 				m_customStatusSet.push_back(*it);
@@ -1420,7 +1444,7 @@ void Object::setCustomStatus( const std::vector<AsciiString>& customStatus, Bool
 		}
 		else
 		{
-			if(removeWithinStringVec((*it), m_customStatusSet))
+			if(m_customStatusFlags.reset(TheCustomStatusRegistry->find(*it)) && removeWithinStringVec((*it), m_customStatusSet))
 				isDifferent = TRUE;
 		}
 		/*ObjectCustomStatusType::iterator it = m_customStatus.find(*str_it);
@@ -1480,7 +1504,7 @@ Bool Object::testCustomStatusForAll(const std::vector<AsciiString>& cst) const
 {
 	for(std::vector<AsciiString>::const_iterator it = cst.begin(); it != cst.end(); ++it)
 	{
-		if(!checkWithinStringVec((*it), m_customStatusSet))
+		if(!m_customStatusFlags.test(TheCustomStatusRegistry->find(*it)))
 			return FALSE;
 		/*ObjectCustomStatusType::const_iterator it2 = m_customStatus.find(*it);
 		if (it2 != m_customStatus.end()) 
@@ -2418,6 +2442,8 @@ void Object::reactToTurretChange( WhichTurretType turret, Real oldRotation, Real
 void Object::reactToTransformChange(const Matrix3D* oldMtx, const Coord3D* oldPos, Real oldAngle)
 {
 	//USE_PERF_TIMER(Object_reactToTransformChange)
+	markCRCDirty();
+
 	if(_isnan(getPosition()->x) || _isnan(getPosition()->y) || _isnan(getPosition()->z)) {
 		DEBUG_CRASH(("Object pos is nan."));
 		TheGameLogic->destroyObject(this);
@@ -2798,6 +2824,8 @@ void Object::setEffectivelyDead(Bool dead)
 	else
 		BitClear(m_privateStatus, EFFECTIVELY_DEAD);
 
+	markCRCDirty();
+
 	if (dead)
 	{
 		if( m_radarData )
@@ -2816,6 +2844,8 @@ void Object::setCaptured(Bool isCaptured)
 		BitClear(m_privateStatus, CAPTURED);
 	}
 
+	markCRCDirty();
+
 	// No need to see if we should skip updates, this flag has no effect on skipping updates.
 }
 
@@ -3568,11 +3598,10 @@ Bool Object::isCommandDisabled(UnsignedInt now, const AsciiString& commandName)
 //-------------------------------------------------------------------------------------------------
 void Object::pauseAllSpecialPowers( const Bool disabling ) const
 {
-	for (BehaviorModule** m = m_behaviors; *m; ++m)
+	const Int specialPowerCount = getDispatchModuleCount(MODULEDISPATCH_SPECIAL_POWER);
+	for (Int i = 0; i < specialPowerCount; ++i)
 	{
-		SpecialPowerModuleInterface* sp = (*m)->getSpecialPower();
-		if (!sp)
-			continue;
+		SpecialPowerModuleInterface* sp = getDispatchModule(MODULEDISPATCH_SPECIAL_POWER, i)->getSpecialPower();
 
 		sp->pauseCountdown( disabling );// So it will pause if we are disabling.
 	}
@@ -3602,11 +3631,10 @@ void Object::updateTriggerAreaFlags()
 //-------------------------------------------------------------------------------------------------
 void Object::onCollide( Object *other, const Coord3D *loc, const Coord3D *normal )
 {
-	for (BehaviorModule** m = m_behaviors; *m; ++m)
+	const Int collideCount = getDispatchModuleCount(MODULEDISPATCH_COLLIDE);
+	for (Int i = 0; i < collideCount; ++i)
 	{
-		CollideModuleInterface* collide = (*m)->getCollide();
-		if (!collide)
-			continue;
+		CollideModuleInterface* collide = getDispatchModule(MODULEDISPATCH_COLLIDE, i)->getCollide();
 
 		// check each time thru the loop, in case a collide module sets it
 		if( getStatusBits().test( OBJECT_STATUS_NO_COLLISIONS ) )
@@ -3626,10 +3654,11 @@ void Object::onCollide( Object *other, const Coord3D *loc, const Coord3D *normal
 //-------------------------------------------------------------------------------------------------
 Bool Object::isSalvageCrate() const
 {
-	for( BehaviorModule** m = m_behaviors; *m; ++m )
+	const Int collideCount = getDispatchModuleCount(MODULEDISPATCH_COLLIDE);
+	for( Int i = 0; i < collideCount; ++i )
 	{
-		CollideModuleInterface* collide = (*m)->getCollide();
-		if( collide && collide->isSalvageCrateCollide() )
+		CollideModuleInterface* collide = getDispatchModule(MODULEDISPATCH_COLLIDE, i)->getCollide();
+		if( collide->isSalvageCrateCollide() )
 		{
 			return true;
 		}
@@ -3659,11 +3688,10 @@ void Object::updateUpgradeModules()
 	// We need to add in all of the already owned upgrades to handle "AND" requiring upgrades.
 	// We combine all the masks in case someone has a Object AND Player combination
 
-	for (BehaviorModule** module = m_behaviors; *module; ++module)
+	const Int upgradeCount = getDispatchModuleCount(MODULEDISPATCH_UPGRADE);
+	for (Int i = 0; i < upgradeCount; ++i)
 	{
-		UpgradeModuleInterface* upgrade = (*module)->getUpgrade();
-		if (!upgrade)
-			continue;
+		UpgradeModuleInterface* upgrade = getDispatchModule(MODULEDISPATCH_UPGRADE, i)->getUpgrade();
 
 		if( !upgrade->isAlreadyUpgraded() )
 		{
@@ -3684,11 +3712,10 @@ void Object::updateUpgradeModules()
 //-------------------------------------------------------------------------------------------------
 void Object::forceRefreshSubObjectUpgradeStatus()
 {
-	for (BehaviorModule** module = m_behaviors; *module; ++module)
+	const Int upgradeCount = getDispatchModuleCount(MODULEDISPATCH_UPGRADE);
+	for (Int i = 0; i < upgradeCount; ++i)
 	{
-		UpgradeModuleInterface* upgrade = (*module)->getUpgrade();
-		if (!upgrade)
-			continue;
+		UpgradeModuleInterface* upgrade = getDispatchModule(MODULEDISPATCH_UPGRADE, i)->getUpgrade();
 
 		if( upgrade->isSubObjectsUpgrade() )
 		{
@@ -3702,11 +3729,10 @@ void Object::forceRefreshSubObjectUpgradeStatus()
 //-------------------------------------------------------------------------------------------------
 void Object::forceRefreshUpgradeStatus()
 {
-	for (BehaviorModule** module = m_behaviors; *module; ++module)
+	const Int upgradeCount = getDispatchModuleCount(MODULEDISPATCH_UPGRADE);
+	for (Int i = 0; i < upgradeCount; ++i)
 	{
-		UpgradeModuleInterface* upgrade = (*module)->getUpgrade();
-		if (!upgrade)
-			continue;
+		UpgradeModuleInterface* upgrade = getDispatchModule(MODULEDISPATCH_UPGRADE, i)->getUpgrade();
 
 		if( upgrade->hasUpgradeRefresh() )
 		{
@@ -3996,6 +4022,7 @@ void Object::setID( ObjectID id )
 
 	// assign new id
 	m_id = id;
+	markCRCDirty();
 
 	// add new id to lookup table
 	TheGameLogic->addObjectToLookupTable( this );
@@ -4066,6 +4093,8 @@ void Object::friend_notifyOfNewMapBoundary(void)
 		m_privateStatus &= ~OFF_MAP;
 	else
 		m_privateStatus |= OFF_MAP;
+
+	markCRCDirty();
 }
 
 
@@ -4098,9 +4127,110 @@ void Object::calcNaturalRallyPoint(Coord2D *pt)
 
 }
 
+//-------------------------------------------------------------------------------------------------
+Int Object::getDispatchModuleCount( ModuleDispatchType type ) const
+{
+	if (m_moduleDispatch == nullptr)
+		return 0;
+
+	return (Int)m_moduleDispatch->m_interfaceModules[type].size();
+}
+
+//-------------------------------------------------------------------------------------------------
+BehaviorModule* Object::getDispatchModule( ModuleDispatchType type, Int index ) const
+{
+	return m_behaviors[m_firstTemplateModule + m_moduleDispatch->m_interfaceModules[type][index]];
+}
+
+#ifdef DEBUG_CRASHING
+//-------------------------------------------------------------------------------------------------
+/** The dispatch is shared by all objects of the template, so make sure that it also describes the
+	* modules that were created for this one. */
+//-------------------------------------------------------------------------------------------------
+void Object::validateModuleDispatch() const
+{
+	Int moduleCount = 0;
+	while (m_behaviors[moduleCount])
+		++moduleCount;
+
+	DEBUG_ASSERTCRASH(m_firstTemplateModule + m_moduleDispatch->m_moduleCount <= moduleCount,
+		("Module dispatch of %s has more modules than the object", getTemplate()->getName().str()));
+
+	for (Int i = 0; i < moduleCount; ++i)
+	{
+		BehaviorModule* module = m_behaviors[i];
+		const Short templateModule = (Short)(i - m_firstTemplateModule);
+		const Bool isTemplateModule = templateModule >= 0 && templateModule < m_moduleDispatch->m_moduleCount;
+
+		const Bool hasInterface[MODULEDISPATCH_COUNT] =
+		{
+			module->getCollide() != nullptr,
+			module->getDamage() != nullptr,
+			module->getDie() != nullptr,
+			module->getSpecialPower() != nullptr,
+			module->getUpgrade() != nullptr,
+		};
+
+		for (Int type = 0; type < MODULEDISPATCH_COUNT; ++type)
+		{
+			const std::vector<Short>& modules = m_moduleDispatch->m_interfaceModules[type];
+			const Bool inDispatch = isTemplateModule && std::find(modules.begin(), modules.end(), templateModule) != modules.end();
+			DEBUG_ASSERTCRASH(hasInterface[type] == inDispatch,
+				("Module dispatch of %s is wrong for interface %d of module %d", getTemplate()->getName().str(), type, i));
+		}
+
+		// a search in module order finds the first module of a name
+		const NameKeyType nameKey = module->getModuleNameKey();
+		Int first = 0;
+		while (m_behaviors[first]->getModuleNameKey() != nameKey)
+			++first;
+
+		DEBUG_ASSERTCRASH(findModule(nameKey) == m_behaviors[first],
+			("Module dispatch of %s does not find module %d by name", getTemplate()->getName().str(), i));
+	}
+}
+#endif
+
+//-------------------------------------------------------------------------------------------------
+/** The template modules are found by name through the dispatch. The helper modules in front of
+	* and behind them are not in there, but no template module can have the name of a helper. */
 //-------------------------------------------------------------------------------------------------
 Module* Object::findModule(NameKeyType key) const
 {
+#ifndef INTENSE_DEBUG
+	if (m_moduleDispatch != nullptr)
+	{
+		const std::vector<ModuleDispatch::NameKeyModule>& nameKeyModules = m_moduleDispatch->m_nameKeyModules;
+		Int lo = 0;
+		Int hi = (Int)nameKeyModules.size();
+		while (lo < hi)
+		{
+			const Int mid = (lo + hi) / 2;
+			if (nameKeyModules[mid].nameKey < key)
+				lo = mid + 1;
+			else
+				hi = mid;
+		}
+
+		if (lo < (Int)nameKeyModules.size() && nameKeyModules[lo].nameKey == key)
+			return m_behaviors[m_firstTemplateModule + nameKeyModules[lo].module];
+
+		for (Int i = 0; i < m_firstTemplateModule; ++i)
+		{
+			if (m_behaviors[i]->getModuleNameKey() == key)
+				return m_behaviors[i];
+		}
+
+		for (BehaviorModule** b = m_behaviors + m_firstTemplateModule + m_moduleDispatch->m_moduleCount; *b; ++b)
+		{
+			if ((*b)->getModuleNameKey() == key)
+				return *b;
+		}
+
+		return nullptr;
+	}
+#endif
+
 	Module* m = nullptr;
 
 	for (BehaviorModule** b = m_behaviors; *b; ++b)
@@ -5236,6 +5366,48 @@ void Object::onDisabledEdge(Bool becomingDisabled)
 /** Object CRC implementation */
 //-------------------------------------------------------------------------------------------------
 void Object::crc( Xfer *xfer )
+{
+	crcState( xfer );
+	crcWeapons( xfer );
+}
+
+#if ENABLE_INCREMENTAL_CRC
+//-------------------------------------------------------------------------------------------------
+/** TheSuperHackers @performance Incremental CRC. The state part of the CRC is cached and only
+	* serialized again after markCRCDirty was called, which is the case for every object whose update
+	* modules ran this frame. Weapons have no link back to their object, so they are always serialized. */
+//-------------------------------------------------------------------------------------------------
+void Object::xferIncrementalCRC( Xfer *xfer )
+{
+#if VALIDATE_INCREMENTAL_CRC
+	if (!m_crcDirty)
+	{
+		XferFastCRC validateCRC;
+		validateCRC.open(AsciiString::TheEmptyString);
+		crcState(&validateCRC);
+		validateCRC.close();
+		DEBUG_ASSERTCRASH(validateCRC.getCRC() == m_cachedCRC, ("Object %d (%s) changed its CRC state without calling markCRCDirty",
+			m_id, getTemplate()->getName().str()));
+	}
+#endif
+
+	if (m_crcDirty)
+	{
+		XferFastCRC stateCRC;
+		stateCRC.open(AsciiString::TheEmptyString);
+		crcState(&stateCRC);
+		stateCRC.close();
+		m_cachedCRC = stateCRC.getCRC();
+		m_crcDirty = FALSE;
+	}
+
+	xfer->xferUnsignedInt(&m_cachedCRC);
+	crcWeapons( xfer );
+}
+#endif
+
+//-------------------------------------------------------------------------------------------------
+void Object::crcState( Xfer *xfer )
 {
 #ifdef DEBUG_CRC
 //	g_logObjectCRCs = TRUE;
@@ -5349,7 +5521,11 @@ void Object::crc( Xfer *xfer )
 		CRCDEBUG_LOG(("%s", logString.str()));
 	}
 #endif // DEBUG_CRC
+}
 
+//-------------------------------------------------------------------------------------------------
+void Object::crcWeapons( Xfer *xfer )
+{
 	for (Int i=0; i<WEAPONSLOT_COUNT; ++i)
 	{
 		Weapon *thisWeapon = getWeaponInWeaponSlot((WeaponSlotType)i);
@@ -5583,6 +5759,7 @@ void Object::xfer( Xfer *xfer )
 				if (bonusName.isEmpty())
 					break;
 				m_customStatusSet.push_back(bonusName);
+				m_customStatusFlags.set(TheCustomStatusRegistry->intern(bonusName), TRUE);
 			}
 		}
 		/*if( xfer->getXferMode() == XFER_SAVE )
@@ -6370,6 +6547,8 @@ void Object::loadPostProcess()
 		m_containedBy = nullptr;
 
 	setNeedUpdateTurretPositioning(TRUE);
+
+	markCRCDirty();
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -6398,11 +6577,10 @@ Bool Object::affectedByUpgrade( const UpgradeTemplate *upgradeT ) const
 	// We need to add in all of the already owned upgrades to handle "AND" requiring upgrades.
 	// We combine all the masks in case someone has a Object AND Player combination
 
-	for (BehaviorModule** module = m_behaviors; *module; ++module)
+	const Int upgradeCount = getDispatchModuleCount(MODULEDISPATCH_UPGRADE);
+	for (Int i = 0; i < upgradeCount; ++i)
 	{
-		UpgradeModuleInterface* upgrade = (*module)->getUpgrade();
-		if (!upgrade)
-			continue;
+		UpgradeModuleInterface* upgrade = getDispatchModule(MODULEDISPATCH_UPGRADE, i)->getUpgrade();
 
 		if( upgrade->wouldUpgrade( maskToCheck ) )
 		{
@@ -6422,6 +6600,7 @@ void Object::giveUpgrade( const UpgradeTemplate *upgradeT )
 	if (upgradeT)
 	{
 		m_objectUpgradesCompleted.set( upgradeT->getUpgradeMask() );
+		markCRCDirty();
 
 		//
 		// iterate through all the upgrade modules of this object and call the method to
@@ -6437,11 +6616,11 @@ void Object::giveUpgrade( const UpgradeTemplate *upgradeT )
 void Object::removeUpgrade( const UpgradeTemplate *upgradeT )
 {
 	m_objectUpgradesCompleted.clear( upgradeT->getUpgradeMask() );
-	for (BehaviorModule** module = m_behaviors; *module; ++module)
+	markCRCDirty();
+	const Int upgradeCount = getDispatchModuleCount(MODULEDISPATCH_UPGRADE);
+	for (Int i = 0; i < upgradeCount; ++i)
 	{
-		UpgradeModuleInterface* upgrade = (*module)->getUpgrade();
-		if (!upgrade)
-			continue;
+		UpgradeModuleInterface* upgrade = getDispatchModule(MODULEDISPATCH_UPGRADE, i)->getUpgrade();
 
 		// Whoa, please note that while the function is called Object::RemoveUpgrade, it is not removing anything
 		// in the sense of undoing the effects.  It is just resetting the upgrade so it may be run again.
@@ -6628,11 +6807,11 @@ void Object::onDie( DamageInfo *damageInfo )
 	Bool selfInflicted = (damageInfo->in.m_sourceID == getID());
 
 	// FIRST, call our die modules.
-	for (BehaviorModule** d = m_behaviors; *d; ++d)
+	const Int dieCount = getDispatchModuleCount(MODULEDISPATCH_DIE);
+	for (Int i = 0; i < dieCount; ++i)
 	{
-		DieModuleInterface* die = (*d)->getDie();
-		if (die)
-			die->onDie(damageInfo);
+		DieModuleInterface* die = getDispatchModule(MODULEDISPATCH_DIE, i)->getDie();
+		die->onDie(damageInfo);
 	}
 
 	// When objects die we remove from the radar as they're really not interesting anymore
@@ -6728,6 +6907,7 @@ void Object::setWeaponBonusCondition(WeaponBonusConditionType wst, Bool setIgnor
 {
 	WeaponBonusConditionFlags oldCondition = m_weaponBonusCondition;
 	m_weaponBonusCondition.set(wst);
+	markCRCDirty();
 
 	assert(&oldCondition != &m_weaponBonusCondition);
 
@@ -6746,6 +6926,7 @@ void Object::clearWeaponBonusCondition(WeaponBonusConditionType wst, Bool setIgn
 {
 	WeaponBonusConditionFlags oldCondition = m_weaponBonusCondition;
 	m_weaponBonusCondition.set(wst, 0);
+	markCRCDirty();
 
 	assert(&oldCondition != &m_weaponBonusCondition);
 
@@ -6766,6 +6947,7 @@ void Object::applyWeaponBonusConditionFlags(WeaponBonusConditionFlags flags)
 {
 	WeaponBonusConditionFlags oldCondition = m_weaponBonusCondition;
 	m_weaponBonusCondition.set(flags);
+	markCRCDirty();
 
 	if (oldCondition != m_weaponBonusCondition)
 	{
@@ -6780,6 +6962,7 @@ void Object::removeWeaponBonusConditionFlags(WeaponBonusConditionFlags flags)
 		WeaponBonusConditionFlags oldCondition = m_weaponBonusCondition;
 		//m_weaponBonusCondition &= ~flags;
 		m_weaponBonusCondition.clear(flags);
+		markCRCDirty();
 
 		if (oldCondition != m_weaponBonusCondition)
 		{
@@ -7837,11 +8020,10 @@ SpecialPowerModuleInterface *Object::getSpecialPowerModule( const SpecialPowerTe
 		return nullptr;
 
 	// search the modules for the one with the matching template
-	for( BehaviorModule** m = m_behaviors; *m; ++m )
+	const Int specialPowerCount = getDispatchModuleCount(MODULEDISPATCH_SPECIAL_POWER);
+	for( Int i = 0; i < specialPowerCount; ++i )
 	{
-		SpecialPowerModuleInterface* sp = (*m)->getSpecialPower();
-		if (!sp)
-			continue;
+		SpecialPowerModuleInterface* sp = getDispatchModule(MODULEDISPATCH_SPECIAL_POWER, i)->getSpecialPower();
 
 		if( sp->isModuleForPower( specialPowerTemplate ) )
 			return sp;
@@ -8532,11 +8714,10 @@ DockUpdateInterface *Object::getDockUpdateInterface( void )
 // ------------------------------------------------------------------------------------------------
 SpecialPowerModuleInterface* Object::findSpecialPowerModuleInterface( SpecialPowerType type ) const
 {
-	for (BehaviorModule** m = m_behaviors; *m; ++m)
+	const Int specialPowerCount = getDispatchModuleCount(MODULEDISPATCH_SPECIAL_POWER);
+	for (Int i = 0; i < specialPowerCount; ++i)
 	{
-		SpecialPowerModuleInterface* sp = (*m)->getSpecialPower();
-		if (!sp)
-			continue;
+		SpecialPowerModuleInterface* sp = getDispatchModule(MODULEDISPATCH_SPECIAL_POWER, i)->getSpecialPower();
 
 		if (type == SPECIAL_INVALID)
 		{
@@ -8557,11 +8738,10 @@ SpecialPowerModuleInterface* Object::findSpecialPowerModuleInterface( SpecialPow
 // ------------------------------------------------------------------------------------------------
 SpecialPowerModuleInterface* Object::findAnyShortcutSpecialPowerModuleInterface() const
 {
-	for( BehaviorModule** m = m_behaviors; *m; ++m )
+	const Int specialPowerCount = getDispatchModuleCount(MODULEDISPATCH_SPECIAL_POWER);
+	for( Int i = 0; i < specialPowerCount; ++i )
 	{
-		SpecialPowerModuleInterface* sp = (*m)->getSpecialPower();
-		if (!sp)
-			continue;
+		SpecialPowerModuleInterface* sp = getDispatchModule(MODULEDISPATCH_SPECIAL_POWER, i)->getSpecialPower();
 
 		const SpecialPowerTemplate *spTemplate = sp->getSpecialPowerTemplate();
 		if( spTemplate && spTemplate->isShortcutPower() )
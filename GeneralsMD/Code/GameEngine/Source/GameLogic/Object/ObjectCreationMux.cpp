@@ -395,7 +395,7 @@ void ObjectCreationMux::doInherit( const Object *sourceObj, Object *obj, ObjectS
 	if( data->m_inheritsStatus )
 	{
 		obj->setStatus( sourceObj->getStatusBits() );
-		obj->setCustomStatusFlags( sourceObj->getCustomStatus() );
+		obj->copyCustomStatusFrom( sourceObj );
 
 		obj->doObjectStatusChecks();
 
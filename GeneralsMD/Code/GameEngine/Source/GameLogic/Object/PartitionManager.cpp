@@ -273,6 +273,57 @@ inline Bool filtersAllow(PartitionFilter **filters, Object *objOther)
 #endif
 }
 
+//-----------------------------------------------------------------------------
+Bool PartitionFilterMasks::allow(const Object *objOther) const
+{
+	if (m_rejectDead && objOther->isEffectivelyDead())
+		return false;
+
+	if (!objOther->getTemplate()->isKindOfMulti(m_kindOfMustBeSet, m_kindOfMustBeClear))
+		return false;
+
+	return TEST_OBJECT_STATUS_MASK_MULTI(objOther->getStatusBits(), m_statusMustBeSet, m_statusMustBeClear);
+}
+
+//-----------------------------------------------------------------------------
+enum { MAX_GATHERED_FILTERS = 32 };
+
+/**
+	TheSuperHackers @performance Move the filters that are plain mask tests into masks, and copy the
+	others into remaining. Returns the filter list that still has to be called, which is filters
+	itself if there was nothing to gather. Gathering stops at the first filter with side effects.
+*/
+static PartitionFilter **gatherFilterMasks(PartitionFilter **filters, PartitionFilterMasks& masks, PartitionFilter **remaining)
+{
+#ifdef FILTER_PROFILING
+	return filters;
+#else
+	Int count = 0;
+	for (PartitionFilter **fp = filters; fp && *fp; fp++)
+		++count;
+
+	if (count == 0 || count >= MAX_GATHERED_FILTERS)
+		return filters;
+
+	Bool gathered = false;
+	Bool gather = true;
+	Int numRemaining = 0;
+	for (PartitionFilter **fp = filters; *fp; fp++)
+	{
+		if (gather && (*fp)->hasSideEffects())
+			gather = false;
+
+		if (gather && (*fp)->addMasks(masks))
+			gathered = true;
+		else
+			remaining[numRemaining++] = *fp;
+	}
+	remaining[numRemaining] = nullptr;
+
+	return gathered ? remaining : filters;
+#endif
+}
+
 //-----------------------------------------------------------------------------
 inline void vecDiff_2D(const Coord3D *posA, const Coord3D *posB, Coord3D *resultVec)
 {
@@ -1677,8 +1728,14 @@ void CellAndObjectIntersection::addCoverage(PartitionCell *cell, PartitionData *
 	}
 
 	if (m_cell == nullptr)
+	{
 		cell->friend_addToCellList(this);
 
+		const Object *obj = module->getObject();
+		if (obj)
+			cell->friend_addKindOf(obj->getTemplate()->getKindOfMask());
+	}
+
 	m_cell = cell;
 	m_module = module;
 }
@@ -1711,18 +1768,8 @@ PartitionCell::PartitionCell()
 	m_loTerrainZ = HUGE_DIST;		// huge positive
 	m_hiTerrainZ = -HUGE_DIST;	// huge negative
 #endif
-	/*
-		You may be asking yourself: why do we model the shroud for all players,
-		rather than just the local player? And the answer is: because this allows
-		us to checksum these values for net games, to help prevent "shroud cheaters"
-		(who use a trainer to disable the shroud on their system).
-	*/
 	for (int i = 0; i < MAX_PLAYER_COUNT; ++i)
 	{
-		// Default is "passive shroud".  1,0.
-		m_shroudLevel[i].m_currentShroud = 1;
-		m_shroudLevel[i].m_activeShroudLevel = 0;
-
 		// default cash value is 0
 		m_cashValue[i] = 0;
 
@@ -1750,124 +1797,31 @@ void PartitionCell::invalidateShroudedStatusForAllCois(Int playerIndex)
 //-----------------------------------------------------------------------------
 void PartitionCell::addLooker(Int playerIndex)
 {
-	CellShroudStatus oldShroud = getShroudStatusForPlayer( playerIndex );
-	// The decreasing Algorithm: A 1 will go straight to -1, otherwise it just gets decremented
-	m_shroudLevel[playerIndex].m_currentShroud = min( m_shroudLevel[playerIndex].m_currentShroud - 1, -1 );
-
-	CellShroudStatus newShroud = getShroudStatusForPlayer( playerIndex );
-
-//	DEBUG_LOG(( "ADD    %d, %d.  CS = %d, AS = %d for player %d.",
-//							m_cellX,
-//							m_cellY,
-//							m_shroudLevel[playerIndex].m_currentShroud,
-//							m_shroudLevel[playerIndex].m_activeShroudLevel,
-//							playerIndex
-//							));
-
-	if( oldShroud != newShroud )
-	{
-		// On an edge trigger, tell all objects to think about their shroudedness
-		invalidateShroudedStatusForAllCois( playerIndex );
-
-		if( playerIndex == rts::getObservedOrLocalPlayer()->getPlayerIndex() )
-		{
-			// and if this is the local player, do the Client update.
-			TheDisplay->setShroudLevel(m_cellX, m_cellY, newShroud);
-			TheRadar->setShroudLevel(m_cellX, m_cellY, newShroud);
-		}
-	}
+	ThePartitionManager->addLookers(playerIndex, m_cellY, m_cellX, m_cellX);
 }
 
 //-----------------------------------------------------------------------------
 void PartitionCell::removeLooker(Int playerIndex)
 {
-	CellShroudStatus oldShroud = getShroudStatusForPlayer( playerIndex );
-	// the increasing Algorithm: a -1 goes up to min(1,activeLevel), otherwise it just gets incremented
-	if( m_shroudLevel[playerIndex].m_currentShroud == -1 )
-		m_shroudLevel[playerIndex].m_currentShroud = min( m_shroudLevel[playerIndex].m_activeShroudLevel, (Short)1 );
-	else
-	{
-		DEBUG_ASSERTCRASH( m_shroudLevel[playerIndex].m_currentShroud < 0, ("Someone is RemoveLooker-ing on a cell that is not looked at.  This will make a permanent shroud blob.") );
-		m_shroudLevel[playerIndex].m_currentShroud++;
-	}
-	CellShroudStatus newShroud = getShroudStatusForPlayer( playerIndex );
-
-//	DEBUG_LOG(( "REMOVE %d, %d.  CS = %d, AS = %d for player %d.",
-//							m_cellX,
-//							m_cellY,
-//							m_shroudLevel[playerIndex].m_currentShroud,
-//							m_shroudLevel[playerIndex].m_activeShroudLevel,
-//							playerIndex
-//							));
-
-	if( oldShroud != newShroud )
-	{
-		// On an edge trigger, tell all objects to think about their shroudedness
-		invalidateShroudedStatusForAllCois( playerIndex );
-
-		if( playerIndex == rts::getObservedOrLocalPlayer()->getPlayerIndex() )
-		{
-			// and if this is the local player, do the Client update.
-			TheDisplay->setShroudLevel(m_cellX, m_cellY, newShroud);
-			TheRadar->setShroudLevel(m_cellX, m_cellY, newShroud);
-		}
-	}
+	ThePartitionManager->removeLookers(playerIndex, m_cellY, m_cellX, m_cellX);
 }
 
 //-----------------------------------------------------------------------------
 void PartitionCell::addShrouder( Int playerIndex )
 {
-	CellShroudStatus oldShroud = getShroudStatusForPlayer( playerIndex );
-	// Increasing active shroud: activeLevel gets incremented, and CS is set to 1 if at zero
-	// do the algorithm
-	m_shroudLevel[playerIndex].m_activeShroudLevel++;
-	if( m_shroudLevel[playerIndex].m_currentShroud == 0 )
-	{
-		m_shroudLevel[playerIndex].m_currentShroud = 1;
-	}
-	CellShroudStatus newShroud = getShroudStatusForPlayer( playerIndex );
-
-	if( oldShroud != newShroud )
-	{
-		// On an edge trigger, tell all objects to think about their shroudedness
-		invalidateShroudedStatusForAllCois( playerIndex );
-
-		// and update the client if we are on the local player
-		if( playerIndex == rts::getObservedOrLocalPlayer()->getPlayerIndex() )
-		{
-			TheDisplay->setShroudLevel(m_cellX, m_cellY, newShroud);
-			TheRadar->setShroudLevel(m_cellX, m_cellY, newShroud);
-		}
-	}
+	ThePartitionManager->addShrouders(playerIndex, m_cellY, m_cellX, m_cellX);
 }
 
 //-----------------------------------------------------------------------------
 void PartitionCell::removeShrouder( Int playerIndex )
 {
-	// Decreasing active shroud: just decrement activeLevel.  This will never result in a client change.
-	// Either it was passive shroud and is now active, or it was being looked at and still is.
-	m_shroudLevel[playerIndex].m_activeShroudLevel--;
-	DEBUG_ASSERTCRASH( m_shroudLevel[playerIndex].m_activeShroudLevel >= 0, ("Shroud generation has gone negative.  This can't happen.") );
+	ThePartitionManager->removeShrouders(playerIndex, m_cellY, m_cellX, m_cellX);
 }
 
-//-----------------------------------------------------------------------------
-//Bool PartitionCell::isShroudedForPlayer( Int playerIndex ) const
-//{
-	// There isn't an absolute answer.  This cell is only shrouded in regards to a person
-//	return (m_shroudLevel[playerIndex].m_currentShroud == 1);
-//}
-
 //-----------------------------------------------------------------------------
 CellShroudStatus PartitionCell::getShroudStatusForPlayer( Int playerIndex ) const
 {
-	// There are now three answers, but the question still requires "to whom"
-
-	if( m_shroudLevel[playerIndex].m_currentShroud == 1 )
-		return CELLSHROUD_SHROUDED;
-	else if( m_shroudLevel[playerIndex].m_currentShroud == 0 )
-		return CELLSHROUD_FOGGED;// ie Nobody actively looking
-	else
-		return CELLSHROUD_CLEAR;
+	return ThePartitionManager->getCellShroudStatus(playerIndex, m_cellY * ThePartitionManager->m_cellCountX + m_cellX);
 }
 
 //-----------------------------------------------------------------------------
@@ -1953,6 +1907,9 @@ void PartitionCell::friend_removeFromCellList(CellAndObjectIntersection *coi)
 	{
 		coi->friend_removeFromCellList(&m_firstCoiInCell);
 		--m_coiCount;
+
+		if (m_coiCount == 0)
+			m_kindOfAny.clear();
 	}
 }
 
@@ -1984,7 +1941,9 @@ void PartitionCell::validateCoiList()
 void PartitionCell::crc( Xfer *xfer )
 {
 
-	xfer->xferUser(&m_shroudLevel, sizeof(ShroudLevel) * MAX_PLAYER_COUNT);
+	ShroudLevel shroudLevel[MAX_PLAYER_COUNT];
+	ThePartitionManager->getShroudLevels(m_cellY * ThePartitionManager->m_cellCountX + m_cellX, shroudLevel);
+	xfer->xferUser(shroudLevel, sizeof(ShroudLevel) * MAX_PLAYER_COUNT);
 	xfer->xferUser(&m_cellX, sizeof(m_cellX));
 	xfer->xferUser(&m_cellY, sizeof(m_cellY));
 
@@ -2001,8 +1960,13 @@ void PartitionCell::xfer( Xfer *xfer )
 	XferVersion version = currentVersion;
 	xfer->xferVersion( &version, currentVersion );
 
-	// xfer shroud data
-	xfer->xferUser( &m_shroudLevel, sizeof( ShroudLevel ) * MAX_PLAYER_COUNT );
+	// xfer shroud data, the cell writes the same bytes it did when it held its shroud itself
+	const Int cellIndex = m_cellY * ThePartitionManager->m_cellCountX + m_cellX;
+	ShroudLevel shroudLevel[MAX_PLAYER_COUNT];
+	ThePartitionManager->getShroudLevels( cellIndex, shroudLevel );
+	xfer->xferUser( shroudLevel, sizeof( ShroudLevel ) * MAX_PLAYER_COUNT );
+	if( xfer->getXferMode() == XFER_LOAD )
+		ThePartitionManager->setShroudLevels( cellIndex, shroudLevel );
 
 }
 
@@ -3105,6 +3069,12 @@ PartitionManager::PartitionManager()
 	m_cellCountY = 0;
 	m_totalCellCount = 0;
 	m_cells = nullptr;
+	m_shroudPlanes = nullptr;
+	for (Int i = 0; i < MAX_PLAYER_COUNT; ++i)
+	{
+		m_currentShroud[i] = nullptr;
+		m_activeShroudLevel[i] = nullptr;
+	}
 	m_worldExtents.lo.zero();
 	m_worldExtents.hi.zero();
 	m_dirtyModules = nullptr;
@@ -3172,6 +3142,27 @@ void PartitionManager::init()
 		m_cellCountY = REAL_TO_INT_CEIL(m_worldExtents.height() * m_cellSizeInv);
 		m_totalCellCount = m_cellCountX * m_cellCountY;
 		m_cells = MSGNEW("PartitionManager_Cells") PartitionCell[m_totalCellCount];
+
+		/*
+			You may be asking yourself: why do we model the shroud for all players,
+			rather than just the local player? And the answer is: because this allows
+			us to checksum these values for net games, to help prevent "shroud cheaters"
+			(who use a trainer to disable the shroud on their system).
+		*/
+		m_shroudPlanes = MSGNEW("PartitionManager_Shroud") Short[2 * MAX_PLAYER_COUNT * m_totalCellCount];
+		for (Int i = 0; i < MAX_PLAYER_COUNT; ++i)
+		{
+			m_currentShroud[i] = m_shroudPlanes + (2 * i) * m_totalCellCount;
+			m_activeShroudLevel[i] = m_shroudPlanes + (2 * i + 1) * m_totalCellCount;
+
+			// Default is "passive shroud".  1,0.
+			for (Int j = 0; j < m_totalCellCount; ++j)
+			{
+				m_currentShroud[i][j] = 1;
+				m_activeShroudLevel[i][j] = 0;
+			}
+		}
+
 		for (Int x = 0; x < m_cellCountX; x++)
 		{
 			for (Int y = 0; y < m_cellCountY; y++)
@@ -3261,6 +3252,14 @@ void PartitionManager::shutdown()
 	delete [] m_cells;
 	m_cells = nullptr;
 
+	delete [] m_shroudPlanes;
+	m_shroudPlanes = nullptr;
+	for (Int i = 0; i < MAX_PLAYER_COUNT; ++i)
+	{
+		m_currentShroud[i] = nullptr;
+		m_activeShroudLevel[i] = nullptr;
+	}
+
 	m_cellSize = m_cellSizeInv = 0.0f;
 	m_cellCountX = 0;
 	m_cellCountY = 0;
@@ -3526,10 +3525,10 @@ void PartitionManager::revealMapForPlayer( Int playerIndex )
 {
 	// By looking and then stopping on every cell, I clear all Passive Shroud
 	// By adding a looker directly I don't hit the Ally logic of the normal look/doShroudReveal
-	for (int i = 0; i < m_totalCellCount; ++i)
+	for (Int y = 0; y < m_cellCountY; ++y)
 	{
-		m_cells[i].addLooker( playerIndex );
-		m_cells[i].removeLooker( playerIndex );
+		addLookers( playerIndex, y, 0, m_cellCountX - 1 );
+		removeLookers( playerIndex, y, 0, m_cellCountX - 1 );
 	}
 }
 
@@ -3541,9 +3540,9 @@ void PartitionManager::revealMapForPlayerPermanently( Int playerIndex )
 	// By skipping the removeLooker, I consider myself as actively looking at everything,
 	// so Shroud generation will no longer function
 	// By adding a looker directly I don't hit the Ally logic of the normal look/doShroudReveal
-	for (int i = 0; i < m_totalCellCount; ++i)
+	for (Int y = 0; y < m_cellCountY; ++y)
 	{
-		m_cells[i].addLooker( playerIndex );
+		addLookers( playerIndex, y, 0, m_cellCountX - 1 );
 	}
 }
 
@@ -3557,9 +3556,9 @@ void PartitionManager::undoRevealMapForPlayerPermanently( Int playerIndex )
 
 	// This will have amusing consequences if done without a preceding revealMapForPlayerPermanently.
 	// Everything you own can become shrouded.
-	for (int i = 0; i < m_totalCellCount; ++i)
+	for (Int y = 0; y < m_cellCountY; ++y)
 	{
-		m_cells[i].removeLooker( playerIndex );
+		removeLookers( playerIndex, y, 0, m_cellCountX - 1 );
 	}
 }
 
@@ -3572,10 +3571,10 @@ void PartitionManager::shroudMapForPlayer( Int playerIndex )
 	processEntirePendingUndoShroudRevealQueue();
 
 	// By pulsing a blast of shroud like this, we will set everything not actively looked at as Passive Shroud
-	for (int i = 0; i < m_totalCellCount; ++i)
+	for (Int y = 0; y < m_cellCountY; ++y)
 	{
-		m_cells[i].addShrouder( playerIndex );
-		m_cells[i].removeShrouder( playerIndex );
+		addShrouders( playerIndex, y, 0, m_cellCountX - 1 );
+		removeShrouders( playerIndex, y, 0, m_cellCountX - 1 );
 	}
 }
 
@@ -3610,8 +3609,154 @@ CellShroudStatus PartitionManager::getShroudStatusForPlayer(Int playerIndex, Int
 	if( playerIndex < 0 )
 		return CELLSHROUD_SHROUDED;// Safety.  There are no Negative players, but PlayerIndex is typedef'd to Int, not UnsignedInt
 
-	const PartitionCell* cell = getCellAt(x, y);
-	return cell ? cell->getShroudStatusForPlayer(playerIndex) : CELLSHROUD_SHROUDED;
+	if (x < 0 || y < 0 || x >= m_cellCountX || y >= m_cellCountY)
+		return CELLSHROUD_SHROUDED;
+
+	return getCellShroudStatus(playerIndex, y * m_cellCountX + x);
+}
+
+//-----------------------------------------------------------------------------
+CellShroudStatus PartitionManager::getCellShroudStatus( Int playerIndex, Int cellIndex ) const
+{
+	// There are now three answers, but the question still requires "to whom"
+	const Short currentShroud = m_currentShroud[playerIndex][cellIndex];
+
+	if( currentShroud == 1 )
+		return CELLSHROUD_SHROUDED;
+	else if( currentShroud == 0 )
+		return CELLSHROUD_FOGGED;// ie Nobody actively looking
+	else
+		return CELLSHROUD_CLEAR;
+}
+
+//-----------------------------------------------------------------------------
+/** Adds a looker to the cells x1 to x2 of row y. Only a cell that nobody looked at becomes clear,
+	and a looker that moves on mostly looks at cells it already looked at, so the loop that counts
+	the lookers runs alone and the cells are only visited again when one of them became clear. */
+//-----------------------------------------------------------------------------
+void PartitionManager::addLookers( Int playerIndex, Int y, Int x1, Int x2 )
+{
+	Short *currentShroud = m_currentShroud[playerIndex] + y * m_cellCountX;
+	Bool changed = false;
+	Int x;
+
+	for (x = x1; x <= x2; ++x)
+	{
+		// The decreasing Algorithm: A 1 will go straight to -1, otherwise it just gets decremented
+		const Short current = currentShroud[x];
+		changed |= (current >= 0);
+		currentShroud[x] = (Short)min( current - 1, -1 );
+	}
+
+	if (!changed)
+		return;
+
+	// Only the cells that nobody looked at went to -1
+	const Bool isLocalPlayer = playerIndex == rts::getObservedOrLocalPlayer()->getPlayerIndex();
+	for (x = x1; x <= x2; ++x)
+	{
+		if (currentShroud[x] == -1)
+			shroudStatusChanged( playerIndex, y * m_cellCountX + x, CELLSHROUD_CLEAR, isLocalPlayer );
+	}
+}
+
+//-----------------------------------------------------------------------------
+void PartitionManager::removeLookers( Int playerIndex, Int y, Int x1, Int x2 )
+{
+	Short *currentShroud = m_currentShroud[playerIndex] + y * m_cellCountX;
+	const Short *activeShroudLevel = m_activeShroudLevel[playerIndex] + y * m_cellCountX;
+	Bool changed = false;
+	Int x;
+
+	for (x = x1; x <= x2; ++x)
+	{
+		// the increasing Algorithm: a -1 goes up to min(1,activeLevel), otherwise it just gets incremented
+		const Short current = currentShroud[x];
+		DEBUG_ASSERTCRASH( current < 0, ("Someone is RemoveLooker-ing on a cell that is not looked at.  This will make a permanent shroud blob.") );
+		const Short next = (current == -1) ? min( activeShroudLevel[x], (Short)1 ) : (Short)(current + 1);
+		changed |= (next >= 0);
+		currentShroud[x] = next;
+	}
+
+	if (!changed)
+		return;
+
+	// Only the cells that lost their last looker are no longer clear
+	const Bool isLocalPlayer = playerIndex == rts::getObservedOrLocalPlayer()->getPlayerIndex();
+	for (x = x1; x <= x2; ++x)
+	{
+		if (currentShroud[x] >= 0)
+			shroudStatusChanged( playerIndex, y * m_cellCountX + x, getCellShroudStatus( playerIndex, y * m_cellCountX + x ), isLocalPlayer );
+	}
+}
+
+//-----------------------------------------------------------------------------
+void PartitionManager::addShrouders( Int playerIndex, Int y, Int x1, Int x2 )
+{
+	Short *currentShroud = m_currentShroud[playerIndex] + y * m_cellCountX;
+	Short *activeShroudLevel = m_activeShroudLevel[playerIndex] + y * m_cellCountX;
+	const Bool isLocalPlayer = playerIndex == rts::getObservedOrLocalPlayer()->getPlayerIndex();
+
+	for (Int x = x1; x <= x2; ++x)
+	{
+		// Increasing active shroud: activeLevel gets incremented, and CS is set to 1 if at zero
+		++activeShroudLevel[x];
+		if( currentShroud[x] == 0 )
+		{
+			currentShroud[x] = 1;
+			shroudStatusChanged( playerIndex, y * m_cellCountX + x, CELLSHROUD_SHROUDED, isLocalPlayer );
+		}
+	}
+}
+
+//-----------------------------------------------------------------------------
+void PartitionManager::removeShrouders( Int playerIndex, Int y, Int x1, Int x2 )
+{
+	Short *activeShroudLevel = m_activeShroudLevel[playerIndex] + y * m_cellCountX;
+
+	// Decreasing active shroud: just decrement activeLevel.  This will never result in a client change.
+	// Either it was passive shroud and is now active, or it was being looked at and still is.
+	for (Int x = x1; x <= x2; ++x)
+	{
+		--activeShroudLevel[x];
+		DEBUG_ASSERTCRASH( activeShroudLevel[x] >= 0, ("Shroud generation has gone negative.  This can't happen.") );
+	}
+}
+
+//-----------------------------------------------------------------------------
+void PartitionManager::shroudStatusChanged( Int playerIndex, Int cellIndex, CellShroudStatus newShroud, Bool isLocalPlayer )
+{
+	PartitionCell &cell = m_cells[cellIndex];
+
+	// On an edge trigger, tell all objects to think about their shroudedness
+	cell.invalidateShroudedStatusForAllCois( playerIndex );
+
+	if( isLocalPlayer )
+	{
+		// and if this is the local player, do the Client update.
+		TheDisplay->setShroudLevel(cell.getCellX(), cell.getCellY(), newShroud);
+		TheRadar->setShroudLevel(cell.getCellX(), cell.getCellY(), newShroud);
+	}
+}
+
+//-----------------------------------------------------------------------------
+void PartitionManager::getShroudLevels( Int cellIndex, ShroudLevel *shroudLevels ) const
+{
+	for (Int i = 0; i < MAX_PLAYER_COUNT; ++i)
+	{
+		shroudLevels[i].m_currentShroud = m_currentShroud[i][cellIndex];
+		shroudLevels[i].m_activeShroudLevel = m_activeShroudLevel[i][cellIndex];
+	}
+}
+
+//-----------------------------------------------------------------------------
+void PartitionManager::setShroudLevels( Int cellIndex, const ShroudLevel *shroudLevels )
+{
+	for (Int i = 0; i < MAX_PLAYER_COUNT; ++i)
+	{
+		m_currentShroud[i][cellIndex] = shroudLevels[i].m_currentShroud;
+		m_activeShroudLevel[i][cellIndex] = shroudLevels[i].m_activeShroudLevel;
+	}
 }
 
 //-----------------------------------------------------------------------------
@@ -3766,7 +3911,7 @@ Object *PartitionManager::getClosestObjects(
 	Real maxDist,
 	DistanceCalculationType dc,
 	PartitionFilter **filters,
-	SimpleObjectIterator *iterArg,	// if nonnull, append ALL satisfactory objects to the iterator (not just the single closest)
+	ObjectQueryResults *resultsArg,	// if nonnull, append ALL satisfactory objects to the results (not just the single closest)
 	Real *closestDistArg,
 	Coord3D *closestVecArg
 )
@@ -3812,6 +3957,14 @@ Object *PartitionManager::getClosestObjects(
 	Int cellCenterX, cellCenterY;
 	worldToCell(objPos->x, objPos->y, &cellCenterX, &cellCenterY);
 
+	// TheSuperHackers @performance Test the mask filters without virtual calls, and skip the cells
+	// where no object has the required KindOf bits.
+	PartitionFilterMasks masks;
+	PartitionFilter *remainingFilters[MAX_GATHERED_FILTERS];
+	filters = gatherFilterMasks(filters, masks, remainingFilters);
+	const Bool useMasks = (filters == remainingFilters);
+	const Bool useCellMasks = useMasks && masks.hasCellMask();
+
 	Object* closestObj = nullptr;
 	Real closestDistSqr = maxDist * maxDist;	// if it's not closer than this, we shouldn't consider it anyway...
 	Coord3D closestVec;
@@ -3860,11 +4013,20 @@ Object *PartitionManager::getClosestObjects(
 			if (thisCell == nullptr)
 				continue;
 
+			if (useCellMasks && !masks.allowCell(thisCell))
+				continue;
+
+			// every object of the cell is visited, so this is the exact KindOf summary afterwards
+			KindOfMaskType cellKindOf;
+
 			for (CellAndObjectIntersection *thisCoi = thisCell->getFirstCoiInCell(); thisCoi; thisCoi = thisCoi->getNextCoi())
 			{
 				PartitionData *thisMod = thisCoi->getModule();
 				Object *thisObj = thisMod->getObject();
 
+				if (useCellMasks && thisObj != nullptr)
+					cellKindOf.set(thisObj->getTemplate()->getKindOfMask());
+
 				// never compare against ourself.
 				if (thisObj == obj || thisObj == nullptr)
 					continue;
@@ -3875,6 +4037,9 @@ Object *PartitionManager::getClosestObjects(
 					continue;
 				thisMod->friend_setDoneFlag(theIterFlag);
 
+				if (useMasks && !masks.allow(thisObj))
+					continue;
+
 				if (!filtersAllow(filters, thisObj))
 					continue;
 
@@ -3905,10 +4070,10 @@ Object *PartitionManager::getClosestObjects(
 				//	DEBUG_LOG(("Object Pos: X: %f Y: %f Z: %f", thisObj->getPosition()->x, thisObj->getPosition()->y, thisObj->getPosition()->z));
 				//}
 				// ok, this is within the range, and the filters allow it.
-				// add it to the iter, if we have one....
-				if (iterArg)
+				// add it to the results, if we have one....
+				if (resultsArg)
 				{
-					iterArg->insert(thisObj, thisDistSqr);
+					resultsArg->add(thisObj, thisDistSqr);
 				}
 				else
 				{
@@ -3921,13 +4086,16 @@ Object *PartitionManager::getClosestObjects(
 
 					if (!foundAny)
 					{
-						// if not adding to iterArg, we want to stop once we have the closest object.
+						// if not adding to resultsArg, we want to stop once we have the closest object.
 						maxRadiusLimit = curRadius;
 					}
 					foundAny = true;
 				}
 
 			}
+
+			if (useCellMasks)
+				thisCell->friend_setKindOfAny(cellKindOf);
 		}
   }
 
@@ -3952,6 +4120,9 @@ Object *PartitionManager::getClosestObjects(
 	PartitionCell *thisCell;
 	while ((thisCell = iter.nextNonEmpty()) != nullptr)
 	{
+		if (useCellMasks && !masks.allowCell(thisCell))
+			continue;
+
 		CellAndObjectIntersection *nextCoi;
 		for (CellAndObjectIntersection *thisCoi = thisCell->getFirstCoiInCell(); thisCoi; thisCoi = nextCoi)
 		{
@@ -3971,6 +4142,9 @@ Object *PartitionManager::getClosestObjects(
 			thisMod->friend_setDoneFlag(theIterFlag);
 
 			// check the filters
+			if (useMasks && !masks.allow(thisObj))
+				continue;
+
 			if (!filtersAllow(filters, thisObj))
 				continue;
 
@@ -3993,9 +4167,9 @@ Object *PartitionManager::getClosestObjects(
 				continue;
 
 			// ok, guess this is a winner!
-			if (iterArg)
+			if (resultsArg)
 			{
-				iterArg->insert(thisObj, thisDistSqr);
+				resultsArg->add(thisObj, thisDistSqr);
 			}
 			else
 			{
@@ -4005,10 +4179,10 @@ Object *PartitionManager::getClosestObjects(
 
 				if (!foundAny)
 				{
-					// if not adding to iterArg, we want to stop once we have the closest object.
+					// if not adding to resultsArg, we want to stop once we have the closest object.
 					// since all objects in this radius (and the next radius, due to slop) might
 					// be slightly closer, we still have to check all of them. so set the termination
-					// radius to be our-current-radius-plus-1. (if we ARE adding to the iterArg, we skip
+					// radius to be our-current-radius-plus-1. (if we ARE adding to the resultsArg, we skip
 					// this, cuz we want to go all the way out to the original max we specified as an arg.)
 					iter.setMaxRadius(iter.getCurCellRadius() + 2);
 				}
@@ -4043,427 +4217,83 @@ Object *PartitionManager::getClosestObjects(
 }
 
 //-----------------------------------------------------------------------------
-std::list<Drawable*> PartitionManager::getDrawablesInRegion( IRegion2D *region2D )
+Object *PartitionManager::getClosestObject(
+	const Object *obj,
+	Real maxDist,
+	DistanceCalculationType dc,
+	PartitionFilter **filters,
+	Real *closestDist,
+	Coord3D *closestDistVec
+)
 {
-	//IamInnocent - Attempted to use PartitionManager code to use WorldCell for Finding Drawables - 6/10/2025
-	std::list<Drawable*> drawables;
+	return getClosestObjects(obj, nullptr, maxDist, dc, filters, nullptr, closestDist, closestDistVec);
+}
 
-	ICoord2D loRegion, hiRegion;
-	Coord3D loWorld, hiWorld;
+//-----------------------------------------------------------------------------
+Object *PartitionManager::getClosestObject(
+	const Coord3D *pos,
+	Real maxDist,
+	DistanceCalculationType dc,
+	PartitionFilter **filters,
+	Real *closestDist,
+	Coord3D *closestDistVec
+)
+{
+	return getClosestObjects(nullptr, pos, maxDist, dc, filters, nullptr, closestDist, closestDistVec);
+}
 
-	if(region2D != nullptr)
-	{
-		loRegion.x = region2D->lo.x;
-		loRegion.y = region2D->lo.y;
-		hiRegion.x = region2D->hi.x;
-		hiRegion.y = region2D->hi.y;
-	}
-	else
-	{
-		IRegion2D region;
-		ICoord2D origin;
-		ICoord2D size;
+//-----------------------------------------------------------------------------
+void PartitionManager::getVectorTo(const Object *obj, const Object *otherObj, DistanceCalculationType dc, Coord3D& vec)
+{
+	DistCalcProc distProc = theDistCalcProcs[dc];
+	Real distSqr;
+	(*distProc)(obj->getPosition(), obj, otherObj->getPosition(), otherObj, distSqr, vec, HUGE_DIST_SQR);
+}
 
-		TheTacticalView->getOrigin( &origin.x, &origin.y );
-		size.x = TheTacticalView->getWidth();
-		size.y = TheTacticalView->getHeight();
+//-----------------------------------------------------------------------------
+void PartitionManager::getVectorTo(const Object *obj, const Coord3D *pos, DistanceCalculationType dc, Coord3D& vec)
+{
+	DistCalcProc distProc = theDistCalcProcs[dc];
+	Real distSqr;
+	(*distProc)(obj->getPosition(), obj, pos, nullptr, distSqr, vec, HUGE_DIST_SQR);
+}
 
-		TheInGameUI->buildRegion( &origin, &size, &region );
-		loRegion.x = region.lo.x;
-		loRegion.y = region.lo.y;
-		hiRegion.x = region.hi.x;
-		hiRegion.y = region.hi.y;
-		//loRegion.x = region3D->lo.x;
-		//loRegion.y = region3D->lo.y;
-		//hiRegion.x = region3D->hi.x;
-		//hiRegion.y = region3D->hi.y;
-	}
-	TheTacticalView->screenToTerrain( &loRegion, &loWorld );
-	TheTacticalView->screenToTerrain( &hiRegion, &hiWorld );
+//-----------------------------------------------------------------------------
+Real PartitionManager::getDistanceSquared(const Object *obj, const Object *otherObj, DistanceCalculationType dc, Coord3D *vec)
+{
+	DistCalcProc distProc = theDistCalcProcs[dc];
+	Real thisDistSqr;
+	Coord3D thisVec;
+	(*distProc)(obj->getPosition(), obj, otherObj->getPosition(), otherObj, thisDistSqr, thisVec, HUGE_DIST_SQR);
+	if (vec)
+		*vec = thisVec;
+	return thisDistSqr;
+}
 
-	Int cellCenterX, cellCenterY;
-	Real centerX = loWorld.x + (hiWorld.x - loWorld.x) / 2;
-	Real centerY = loWorld.y + (hiWorld.y - loWorld.y) / 2;
-	worldToCell(centerX, centerY, &cellCenterX, &cellCenterY);
+//-----------------------------------------------------------------------------
+Real PartitionManager::getDistanceSquared(const Object *obj, const Coord3D *pos, DistanceCalculationType dc, Coord3D *vec)
+{
+	DistCalcProc distProc = theDistCalcProcs[dc];
+	Real thisDistSqr;
+	Coord3D thisVec;
+	(*distProc)(obj->getPosition(), obj, pos, nullptr, thisDistSqr, thisVec, HUGE_DIST_SQR);
+	if (vec)
+		*vec = thisVec;
+	return thisDistSqr;
+}
 
-	/*
-		m_radiusVec[curRadius] contains a list of the cells (foo) that could
-		contain objects that are <= (curRadius * cellSize) distance away from cell (0,0).
-	*/
-#ifdef FASTER_GCO
-
-	Int maxRadius = m_maxGcoRadius;
-	Real maxDist = hiWorld.x - loWorld.x > loWorld.y - hiWorld.y ? hiWorld.x - loWorld.x : loWorld.y - hiWorld.y;
-	if (maxDist < HUGE_DIST)
-	{
-		// don't go outwards any farther than necessary.
-		/// Need to increase the minimum value to be able to select air units under a small region
-		maxRadius = minInt(m_maxGcoRadius, worldToCellDist(max(200.0f,maxDist)));
-	}
-#if defined(INTENSE_DEBUG)
-	/*
-		Note, if you ever enable this code, be forewarned that it can give
-		you "false positives" for objects that are located just off the map... (srj)
-	*/
-	Int maxRadiusLimit = maxRadius + 3;
-	if (maxRadiusLimit > m_maxGcoRadius) maxRadiusLimit = m_maxGcoRadius;
-#else
-	Int maxRadiusLimit = maxRadius;
-#endif
-
-	static Int theIterFlag = 1;	// nonzero, thanks
-	++theIterFlag;
-
-	/*
-		m_radiusVec[curRadius] contains a list of the cells (foo) that could
-		contain objects that are <= (curRadius * cellSize) distance away from cell (0,0).
-	*/
-  for (Int curRadius = 0; curRadius <= maxRadiusLimit; ++curRadius)
-  {
-    const OffsetVec& offsets = m_radiusVec[curRadius];
-		if (offsets.empty())
-			continue;
-    for (OffsetVec::const_iterator it = offsets.begin(); it != offsets.end(); ++it)
-		{
-			PartitionCell* thisCell = getCellAt(cellCenterX + it->x, cellCenterY + it->y);
-			if (thisCell == nullptr)
-				continue;
-
-			for (CellAndObjectIntersection *thisCoi = thisCell->getFirstCoiInCell(); thisCoi; thisCoi = thisCoi->getNextCoi())
-			{
-				PartitionData *thisMod = thisCoi->getModule();
-				Object *thisObj = thisMod->getObject();
-
-				if (thisObj == nullptr)
-					continue;
-
-				// since an object can exist in multiple COIs, we use this to avoid processing
-				// the same one more than once.
-				if (thisMod->friend_getDoneFlag() == theIterFlag)
-					continue;
-				thisMod->friend_setDoneFlag(theIterFlag);
-
-				if (!thisObj->getDrawable())
-					continue;
-
-				drawables.push_back( thisObj->getDrawable() );
-
-			} // next coi
-		}	// next cell in this radius
-  } // next radius
-
-#else // not FASTER_GCO
-
-	CellOutwardIterator iter(this, cellCenterX, cellCenterY);
-	if (maxDist < HUGE_DIST)
-	{
-		// don't go outwards any farther than necessary.
-		Int max = worldToCellDist(maxDist) + 1;
-		// default value for "max" is largest possible, based on map size, so we should
-		// never make it any larger than that
-		if (max < iter.getMaxRadius())
-			iter.setMaxRadius(max);
-	}
-
-	static Int theIterFlag = 1;	// nonzero, thanks
-	++theIterFlag;
-
-	PartitionCell *thisCell;
-	while ((thisCell = iter.nextNonEmpty()) != nullptr)
-	{
-		CellAndObjectIntersection *nextCoi;
-		for (CellAndObjectIntersection *thisCoi = thisCell->getFirstCoiInCell(); thisCoi; thisCoi = nextCoi)
-		{
-			nextCoi = thisCoi->getNextCoi();
-
-			PartitionData *thisMod = thisCoi->getModule();
-
-			Object *thisObj = thisMod->getObject();
-
-			if (thisObj == nullptr)
-				continue;
-
-			if (thisMod->friend_getDoneFlag() == theIterFlag)
-				continue;
-
-			thisMod->friend_setDoneFlag(theIterFlag);
-
-			if (!thisObj->getDrawable())
-				continue;
-
-			drawables.push_back( thisObj->getDrawable() );
-		}
-	}
-
-#endif  // not FASTER_GCO
-	return drawables;
-}
-
-
-std::list<Drawable*> PartitionManager::getDrawablesInRegionEfficient()
-{
-	//IamInnocent - Attempted to use PartitionManager code to use WorldCell for Finding Drawables Only check borders- 6/10/2025
-
-	std::list<Drawable*> drawables;
-
-	ICoord2D loRegion, hiRegion;
-	Coord3D loWorld, hiWorld;
-
-	IRegion2D region;
-	ICoord2D origin;
-	ICoord2D size;
-
-	TheTacticalView->getOrigin( &origin.x, &origin.y );
-	size.x = TheTacticalView->getWidth();
-	size.y = TheTacticalView->getHeight();
-
-	TheInGameUI->buildRegion( &origin, &size, &region );
-	loRegion.x = region.lo.x;
-	loRegion.y = region.lo.y;
-	hiRegion.x = region.hi.x;
-	hiRegion.y = region.hi.y;
-
-	TheTacticalView->screenToTerrain( &loRegion, &loWorld );
-	TheTacticalView->screenToTerrain( &hiRegion, &hiWorld );
-
-	Int loCellCenterX, loCellCenterY, hiCellCenterX, hiCellCenterY;
-	worldToCell(loWorld.x, loWorld.y, &loCellCenterX, &loCellCenterY);
-	worldToCell(hiWorld.x, hiWorld.y, &hiCellCenterX, &hiCellCenterY);
-
-	// Prevents scanning the border of the edge that may cause lags
-	hiCellCenterY++;
-
-  for (Int direction = 0; direction < 2; direction++)
-  {
-		Int curCell, endCell;
-		switch(direction){
-			case 0:
-				curCell = loCellCenterX;
-				endCell = hiCellCenterX;
-				break;
-			case 1:
-				curCell = hiCellCenterY;
-				endCell = loCellCenterY;
-				break;
-		}
-			for (Int direction2 = 0; direction2 < 2; direction2++)
-			{
-				Int curX, curY;
-				switch(direction){
-					case 0:
-					{
-						if(direction2 == 0)
-						{
-							curX = curCell;
-							curY = loCellCenterY;
-						}
-						else
-						{
-							curX = curCell;
-							curY = hiCellCenterY;
-						}
-						break;
-					}
-					case 1:
-					{
-						if(direction2 == 0)
-						{
-							curX = loCellCenterX;
-							curY = curCell;
-						}
-						else
-						{
-							curX = hiCellCenterX;
-							curY = curCell;
-						}
-						break;
-					}
-				}
-			for (Int cur = curCell; cur <= endCell; ++cur)
-			{
-
-				Int useX, useY;
-				switch(direction){
-					case 0:
-					{
-						useX = cur;
-						useY = curY;
-						break;
-					}
-					case 1:
-					{
-						useX = curX;
-						useY = cur;
-						break;
-					}
-				}
-
-			#ifdef FASTER_GCO
-
-				static Int theIterFlag = 1;	// nonzero, thanks
-				++theIterFlag;
-
-				for (Int curRadius = 0; curRadius <= 2; ++curRadius)
-				{
-					const OffsetVec& offsets = m_radiusVec[curRadius];
-						if (offsets.empty())
-							continue;
-					for (OffsetVec::const_iterator it = offsets.begin(); it != offsets.end(); ++it)
-						{
-							PartitionCell* thisCell = getCellAt(useX + it->x, useY + it->y);
-							if (thisCell == nullptr)
-								continue;
-
-							for (CellAndObjectIntersection *thisCoi = thisCell->getFirstCoiInCell(); thisCoi; thisCoi = thisCoi->getNextCoi())
-							{
-								PartitionData *thisMod = thisCoi->getModule();
-								Object *thisObj = thisMod->getObject();
-
-								if (thisObj == nullptr)
-									continue;
-
-								// since an object can exist in multiple COIs, we use this to avoid processing
-								// the same one more than once.
-								if (thisMod->friend_getDoneFlag() == theIterFlag)
-									continue;
-								thisMod->friend_setDoneFlag(theIterFlag);
-
-								if (!thisObj->getDrawable())
-									continue;
-
-								drawables.push_back( thisObj->getDrawable() );
-
-							} // next coi
-						}	// next cell in this radius
-				} // next radius
-
-				
-			#else // not FASTER_GCO
-
-				CellOutwardIterator iter(this, useX, useY);
-				// don't go outwards any farther than necessary.
-				Int max = worldToCellDist(2) + 1;
-				// default value for "max" is largest possible, based on map size, so we should
-				// never make it any larger than that
-				if (2 < iter.getMaxRadius())
-					iter.setMaxRadius(2);
-
-				static Int theIterFlag = 1;	// nonzero, thanks
-				++theIterFlag;
-
-				PartitionCell *thisCell;
-				while ((thisCell = iter.nextNonEmpty()) != nullptr)
-				{
-					CellAndObjectIntersection *nextCoi;
-					for (CellAndObjectIntersection *thisCoi = thisCell->getFirstCoiInCell(); thisCoi; thisCoi = nextCoi)
-					{
-						nextCoi = thisCoi->getNextCoi();
-
-						PartitionData *thisMod = thisCoi->getModule();
-
-						Object *thisObj = thisMod->getObject();
-
-						if (thisObj == nullptr)
-							continue;
-
-						if (thisMod->friend_getDoneFlag() == theIterFlag)
-							continue;
-
-						thisMod->friend_setDoneFlag(theIterFlag);
-
-						if (!thisObj->getDrawable())
-							continue;
-
-						drawables.push_back( thisObj->getDrawable() );
-					}
-				}
-
-			#endif  // not FASTER_GCO
-			}   // next cell
-		}	// next direction2
-  } // next direction
-
-	return drawables;
-}
-
-//-----------------------------------------------------------------------------
-Object *PartitionManager::getClosestObject(
-	const Object *obj,
-	Real maxDist,
-	DistanceCalculationType dc,
-	PartitionFilter **filters,
-	Real *closestDist,
-	Coord3D *closestDistVec
-)
-{
-	return getClosestObjects(obj, nullptr, maxDist, dc, filters, nullptr, closestDist, closestDistVec);
-}
-
-//-----------------------------------------------------------------------------
-Object *PartitionManager::getClosestObject(
-	const Coord3D *pos,
-	Real maxDist,
-	DistanceCalculationType dc,
-	PartitionFilter **filters,
-	Real *closestDist,
-	Coord3D *closestDistVec
-)
-{
-	return getClosestObjects(nullptr, pos, maxDist, dc, filters, nullptr, closestDist, closestDistVec);
-}
-
-//-----------------------------------------------------------------------------
-void PartitionManager::getVectorTo(const Object *obj, const Object *otherObj, DistanceCalculationType dc, Coord3D& vec)
-{
-	DistCalcProc distProc = theDistCalcProcs[dc];
-	Real distSqr;
-	(*distProc)(obj->getPosition(), obj, otherObj->getPosition(), otherObj, distSqr, vec, HUGE_DIST_SQR);
-}
-
-//-----------------------------------------------------------------------------
-void PartitionManager::getVectorTo(const Object *obj, const Coord3D *pos, DistanceCalculationType dc, Coord3D& vec)
-{
-	DistCalcProc distProc = theDistCalcProcs[dc];
-	Real distSqr;
-	(*distProc)(obj->getPosition(), obj, pos, nullptr, distSqr, vec, HUGE_DIST_SQR);
-}
-
-//-----------------------------------------------------------------------------
-Real PartitionManager::getDistanceSquared(const Object *obj, const Object *otherObj, DistanceCalculationType dc, Coord3D *vec)
-{
-	DistCalcProc distProc = theDistCalcProcs[dc];
-	Real thisDistSqr;
-	Coord3D thisVec;
-	(*distProc)(obj->getPosition(), obj, otherObj->getPosition(), otherObj, thisDistSqr, thisVec, HUGE_DIST_SQR);
-	if (vec)
-		*vec = thisVec;
-	return thisDistSqr;
-}
-
-//-----------------------------------------------------------------------------
-Real PartitionManager::getDistanceSquared(const Object *obj, const Coord3D *pos, DistanceCalculationType dc, Coord3D *vec)
-{
-	DistCalcProc distProc = theDistCalcProcs[dc];
-	Real thisDistSqr;
-	Coord3D thisVec;
-	(*distProc)(obj->getPosition(), obj, pos, nullptr, thisDistSqr, thisVec, HUGE_DIST_SQR);
-	if (vec)
-		*vec = thisVec;
-	return thisDistSqr;
-}
-
-//-----------------------------------------------------------------------------
-// Gets the distance if obj were at goalPos.  Used to calculate attack position paths.
-Real PartitionManager::getGoalDistanceSquared(const Object *obj, const Coord3D *goalPos, const Object *otherObj, DistanceCalculationType dc, Coord3D *vec)
-{
-	DistCalcProc distProc = theDistCalcProcs[dc];
-	Real thisDistSqr;
-	Coord3D thisVec;
-	(*distProc)(goalPos, obj, otherObj->getPosition(), otherObj, thisDistSqr, thisVec, HUGE_DIST_SQR);
-	if (vec)
-		*vec = thisVec;
-	return thisDistSqr;
-}
+//-----------------------------------------------------------------------------
+// Gets the distance if obj were at goalPos.  Used to calculate attack position paths.
+Real PartitionManager::getGoalDistanceSquared(const Object *obj, const Coord3D *goalPos, const Object *otherObj, DistanceCalculationType dc, Coord3D *vec)
+{
+	DistCalcProc distProc = theDistCalcProcs[dc];
+	Real thisDistSqr;
+	Coord3D thisVec;
+	(*distProc)(goalPos, obj, otherObj->getPosition(), otherObj, thisDistSqr, thisVec, HUGE_DIST_SQR);
+	if (vec)
+		*vec = thisVec;
+	return thisDistSqr;
+}
 
 //-----------------------------------------------------------------------------
 // Gets the distance if obj were at goalPos.  Used to calculate attack position paths.
@@ -4588,67 +4418,118 @@ Real PartitionManager::getRelativeAngle2DWithOffset(const Object* obj, Vector2 o
 }
 
 //-----------------------------------------------------------------------------
-SimpleObjectIterator *PartitionManager::iterateObjectsInRange(
+/**
+	The queries reverse their results, because the iterators always returned the objects in the
+	reverse order of finding them and the game logic depends on it. The iterator inserts at the
+	head, so the results are inserted from the back to keep their order.
+*/
+static SimpleObjectIterator *newIteratorFromResults(const ObjectQueryResults &results)
+{
+	SimpleObjectIterator *iter = newInstance(SimpleObjectIterator);
+
+	for (Int i = results.getCount() - 1; i >= 0; --i)
+		iter->insert(results.getObject(i), results.getNumeric(i));
+
+	return iter;
+}
+
+//-----------------------------------------------------------------------------
+void PartitionManager::queryObjectsInRange(
 	const Object *obj,
 	Real maxDist,
 	DistanceCalculationType dc,
+	ObjectQueryResults &results,
 	PartitionFilter **filters,
 	IterOrderType order
 )
 {
-	MemoryPoolObjectHolder iterHolder;
-	SimpleObjectIterator *iter = newInstance(SimpleObjectIterator);
-	iterHolder.hold(iter);
+	results.clear();
 
-	getClosestObjects(obj, nullptr, maxDist, dc, filters, iter, nullptr, nullptr);
+	getClosestObjects(obj, nullptr, maxDist, dc, filters, &results, nullptr, nullptr);
 
-	iter->sort(order);
-	iterHolder.release();
-	return iter;
+	results.reverse();
+	results.sort(order);
 }
 
 //-----------------------------------------------------------------------------
-SimpleObjectIterator *PartitionManager::iterateObjectsInRange(
+void PartitionManager::queryObjectsInRange(
 	const Coord3D *pos,
 	Real maxDist,
 	DistanceCalculationType dc,
+	ObjectQueryResults &results,
 	PartitionFilter **filters,
 	IterOrderType order
 )
 {
-	MemoryPoolObjectHolder iterHolder;
-	SimpleObjectIterator *iter = newInstance(SimpleObjectIterator);
-	iterHolder.hold(iter);
+	results.clear();
 
-	getClosestObjects(nullptr, pos, maxDist, dc, filters, iter, nullptr, nullptr);
+	getClosestObjects(nullptr, pos, maxDist, dc, filters, &results, nullptr, nullptr);
 
-	iter->sort(order);
-	iterHolder.release();
-	return iter;
+	results.reverse();
+	results.sort(order);
 }
 
 //-----------------------------------------------------------------------------
-SimpleObjectIterator* PartitionManager::iteratePotentialCollisions(
+void PartitionManager::queryPotentialCollisions(
 	const Coord3D* pos,
 	const GeometryInfo& geom,
 	Real angle,
+	ObjectQueryResults &results,
 	Bool use2D
 )
 {
 	Real maxDist = geom.getBoundingSphereRadius();
 	maxDist *= 1.1f;	// just a little slop
 
-	MemoryPoolObjectHolder iterHolder;
-	SimpleObjectIterator *iter = newInstance(SimpleObjectIterator);
-	iterHolder.hold(iter);
-
 	PartitionFilterWouldCollide filter(*pos, geom, angle, true);
 	PartitionFilter *filters[] = { &filter, nullptr };
 
-	getClosestObjects(nullptr, pos, maxDist, use2D ? FROM_BOUNDINGSPHERE_2D : FROM_BOUNDINGSPHERE_3D, filters, iter, nullptr, nullptr);
+	results.clear();
 
-	iterHolder.release();
-	return iter;
+	getClosestObjects(nullptr, pos, maxDist, use2D ? FROM_BOUNDINGSPHERE_2D : FROM_BOUNDINGSPHERE_3D, filters, &results, nullptr, nullptr);
+
+	results.reverse();
+}
+
+//-----------------------------------------------------------------------------
+SimpleObjectIterator *PartitionManager::iterateObjectsInRange(
+	const Object *obj,
+	Real maxDist,
+	DistanceCalculationType dc,
+	PartitionFilter **filters,
+	IterOrderType order
+)
+{
+	ObjectQueryResults results;
+	queryObjectsInRange(obj, maxDist, dc, results, filters, order);
+	return newIteratorFromResults(results);
+}
+
+//-----------------------------------------------------------------------------
+SimpleObjectIterator *PartitionManager::iterateObjectsInRange(
+	const Coord3D *pos,
+	Real maxDist,
+	DistanceCalculationType dc,
+	PartitionFilter **filters,
+	IterOrderType order
+)
+{
+	ObjectQueryResults results;
+	queryObjectsInRange(pos, maxDist, dc, results, filters, order);
+	return newIteratorFromResults(results);
+}
+
+//-----------------------------------------------------------------------------
+SimpleObjectIterator* PartitionManager::iteratePotentialCollisions(
+	const Coord3D* pos,
+	const GeometryInfo& geom,
+	Real angle,
+	Bool use2D
+)
+{
+	ObjectQueryResults results;
+	queryPotentialCollisions(pos, geom, angle, results, use2D);
+	return newIteratorFromResults(results);
 }
 
 /*struct IterData
@@ -4703,7 +4584,7 @@ Int PartitionManager::getObjectsAlongLine(
 	const ObjectCreationList *railgunocl,
 	DistanceCalculationType dc,
 	PartitionFilter **filters,
-	SimpleObjectIterator *iterArg,
+	ObjectQueryResults *resultsArg,
 	Bool checkBehind,
 	Real *closestDistArg,
 	Coord3D *closestVecArg
@@ -4740,7 +4621,7 @@ Int PartitionManager::getObjectsAlongLine(
 		Real groundHeight = TheTerrainLogic->getGroundHeight( currentPos.x, currentPos.y );
 		currentPos.z = max(groundHeight, pos.z + i * heightCheckPerTime);
 
-		checkObjectsAlongLine(sourceID, pos, currentPos, posOther, radius, infantryRadius, angle, dc, filters, iterArg, checkBehind, closestDistArg, closestVecArg);
+		checkObjectsAlongLine(sourceID, pos, currentPos, posOther, radius, infantryRadius, angle, dc, filters, resultsArg, checkBehind, closestDistArg, closestVecArg);
 
 		if( railgunfx )
 			FXList::doFXPos(railgunfx, &currentPos);
@@ -4766,7 +4647,7 @@ Int PartitionManager::checkObjectsAlongLine(
 	Real dirAngle,
 	DistanceCalculationType dc,
 	PartitionFilter **filters,
-	SimpleObjectIterator *iterArg,
+	ObjectQueryResults *resultsArg,
 	Bool checkBehind,
 	Real *closestDistArg,
 	Coord3D *closestVecArg
@@ -5009,14 +4890,14 @@ Int PartitionManager::checkObjectsAlongLine(
 					continue;
 
 				// ok, this is within the range, and the filters allow it.
-				// add it to the iter, if we have one....
-				if (iterArg)
+				// add it to the results, if we have one....
+				if (resultsArg)
 				{
-					iterArg->insert(thisObj, thisDistSqr);
+					resultsArg->add(thisObj, thisDistSqr);
 				}
 				else
 				{
-					DEBUG_CRASH(("Iterate Cells Along Line needs iter!"));
+					DEBUG_CRASH(("Iterate Cells Along Line needs results!"));
 				}
 
 			}
@@ -5199,13 +5080,13 @@ Int PartitionManager::checkObjectsAlongLine(
 				continue;
 
 			// ok, guess this is a winner!
-			if (iterArg)
+			if (resultsArg)
 			{
-				iterArg->insert(thisObj, thisDistSqr);
+				resultsArg->add(thisObj, thisDistSqr);
 			}
 			else
 			{
-				DEBUG_CRASH(("Iterate Cells Along Line needs iter!"));
+				DEBUG_CRASH(("Iterate Cells Along Line needs results!"));
 			}
 		}
 	}
@@ -5237,7 +5118,7 @@ Int PartitionManager::checkObjectsAlongLine(
 }
 
 //-----------------------------------------------------------------------------
-SimpleObjectIterator *PartitionManager::iterateObjectsAlongLine(
+void PartitionManager::queryObjectsAlongLine(
 	const Object* source,
 	const Coord3D *pos,
 	const Coord3D *posOther,
@@ -5247,29 +5128,39 @@ SimpleObjectIterator *PartitionManager::iterateObjectsAlongLine(
 	const FXList* railgunfx,
 	const ObjectCreationList *railgunocl,
 	DistanceCalculationType dc,
+	ObjectQueryResults &results,
 	Bool checkBehind,
 	PartitionFilter **filters,
 	IterOrderType order
 )
 {
-	MemoryPoolObjectHolder iterHolder;
-	SimpleObjectIterator *iter = newInstance(SimpleObjectIterator);
-	iterHolder.hold(iter);
-
-	/*IterData data;
-	data.radius = radius;
-	data.startingPos = *pos;
-	data.dc = dc;
-	data.filters = filters;
-	data.iterArg = iter;*/
+	results.clear();
 
-	getObjectsAlongLine(source, *pos, *posOther, radius, infantryRadius, checkPerDistance, railgunfx, railgunocl, dc, filters, iter, checkBehind, nullptr, nullptr);
+	getObjectsAlongLine(source, *pos, *posOther, radius, infantryRadius, checkPerDistance, railgunfx, railgunocl, dc, filters, &results, checkBehind, nullptr, nullptr);
 
-	//iterateCellsAlongLine(*pos, *posOther, (*CellAlongLineProc)checkObjectsAlongLine, &data);
+	results.reverse();
+	results.sort(order);
+}
 
-	iter->sort(order);
-	iterHolder.release();
-	return iter;
+//-----------------------------------------------------------------------------
+SimpleObjectIterator *PartitionManager::iterateObjectsAlongLine(
+	const Object* source,
+	const Coord3D *pos,
+	const Coord3D *posOther,
+	Real radius,
+	Real infantryRadius,
+	Real checkPerDistance,
+	const FXList* railgunfx,
+	const ObjectCreationList *railgunocl,
+	DistanceCalculationType dc,
+	Bool checkBehind,
+	PartitionFilter **filters,
+	IterOrderType order
+)
+{
+	ObjectQueryResults results;
+	queryObjectsAlongLine(source, pos, posOther, radius, infantryRadius, checkPerDistance, railgunfx, railgunocl, dc, results, checkBehind, filters, order);
+	return newIteratorFromResults(results);
 }
 
 //-----------------------------------------------------------------------------
@@ -6928,6 +6819,13 @@ Bool PartitionFilterAlive::allow( Object *objOther )
 	return !objOther->isEffectivelyDead();
 }
 
+//-----------------------------------------------------------------------------
+Bool PartitionFilterAlive::addMasks( PartitionFilterMasks& masks ) const
+{
+	masks.m_rejectDead = TRUE;
+	return TRUE;
+}
+
 //-----------------------------------------------------------------------------
 //-----------------------------------------------------------------------------
 //-----------------------------------------------------------------------------
@@ -7109,6 +7007,14 @@ Bool PartitionFilterAcceptByObjectStatus::allow(Object *objOther)
 	return status.testForAll( m_mustBeSet ) && status.testForNone( m_mustBeClear );
 }
 
+//-----------------------------------------------------------------------------
+Bool PartitionFilterAcceptByObjectStatus::addMasks(PartitionFilterMasks& masks) const
+{
+	masks.m_statusMustBeSet.set( m_mustBeSet );
+	masks.m_statusMustBeClear.set( m_mustBeClear );
+	return TRUE;
+}
+
 
 //-----------------------------------------------------------------------------
 //-----------------------------------------------------------------------------
@@ -7122,24 +7028,43 @@ Bool PartitionFilterRejectByObjectStatus::allow(Object *objOther)
 	return !( status.testForAll( m_mustBeSet ) && status.testForNone( m_mustBeClear ) );
 }
 
+//-----------------------------------------------------------------------------
+Bool PartitionFilterRejectByObjectStatus::addMasks(PartitionFilterMasks& masks) const
+{
+	// Rejecting a single set bit is the same as requiring it to be clear, and the other way around.
+	if( m_mustBeSet.count() == 1 && !m_mustBeClear.any() )
+	{
+		masks.m_statusMustBeClear.set( m_mustBeSet );
+		return TRUE;
+	}
+	if( !m_mustBeSet.any() && m_mustBeClear.count() == 1 )
+	{
+		masks.m_statusMustBeSet.set( m_mustBeClear );
+		return TRUE;
+	}
+	return FALSE;
+}
+
 
 //-----------------------------------------------------------------------------
 //-----------------------------------------------------------------------------
 //-----------------------------------------------------------------------------
 
+//-----------------------------------------------------------------------------
+PartitionFilterAcceptByObjectCustomStatus::PartitionFilterAcceptByObjectCustomStatus( const std::vector<AsciiString>& mustBeSet, const std::vector<AsciiString>& mustBeClear )
+{
+	// Resolve the names once per query instead of once per candidate object.
+	m_mustBeSetIsKnown = TheCustomStatusRegistry->findSet( mustBeSet, m_mustBeSet );
+	TheCustomStatusRegistry->findSet( mustBeClear, m_mustBeClear );
+}
+
 //-----------------------------------------------------------------------------
 Bool PartitionFilterAcceptByObjectCustomStatus::allow(Object *objOther)
 {
-	Bool allow = objOther->testCustomStatusForAll( m_mustBeSet ) ? TRUE : FALSE;
-	if(allow)
-	{
-		for (std::vector<AsciiString>::const_iterator it = m_mustBeClear.begin(); it != m_mustBeClear.end(); ++it)
-		{
-			if(objOther->testCustomStatus( *it ))
-				return FALSE;
-		}
-	}
-	return allow;
+	if(!m_mustBeSetIsKnown)
+		return FALSE;
+
+	return objOther->testCustomStatusForAll( m_mustBeSet ) && !objOther->testCustomStatusForAny( m_mustBeClear );
 }
 
 //-----------------------------------------------------------------------------
@@ -7152,6 +7077,14 @@ Bool PartitionFilterAcceptByKindOf::allow(Object *objOther)
 	return objOther->isKindOfMulti(m_mustBeSet, m_mustBeClear);
 }
 
+//-----------------------------------------------------------------------------
+Bool PartitionFilterAcceptByKindOf::addMasks(PartitionFilterMasks& masks) const
+{
+	masks.m_kindOfMustBeSet.set(m_mustBeSet);
+	masks.m_kindOfMustBeClear.set(m_mustBeClear);
+	return TRUE;
+}
+
 
 //-----------------------------------------------------------------------------
 //-----------------------------------------------------------------------------
@@ -7163,6 +7096,23 @@ Bool PartitionFilterRejectByKindOf::allow(Object *objOther)
 	return !objOther->isKindOfMulti(m_mustBeSet, m_mustBeClear);
 }
 
+//-----------------------------------------------------------------------------
+Bool PartitionFilterRejectByKindOf::addMasks(PartitionFilterMasks& masks) const
+{
+	// Rejecting a single set bit is the same as requiring it to be clear, and the other way around.
+	if (m_mustBeSet.count() == 1 && !m_mustBeClear.any())
+	{
+		masks.m_kindOfMustBeClear.set(m_mustBeSet);
+		return TRUE;
+	}
+	if (!m_mustBeSet.any() && m_mustBeClear.count() == 1)
+	{
+		masks.m_kindOfMustBeSet.set(m_mustBeClear);
+		return TRUE;
+	}
+	return FALSE;
+}
+
 
 //-----------------------------------------------------------------------------
 //-----------------------------------------------------------------------------
@@ -7277,13 +7227,8 @@ void hLineAddLooker(Int x1, Int x2, Int y, void *playerIndexVoid)
 
 	Int playerIndex = (Int)(playerIndexVoid);
 
-	PartitionCell* cell = &ThePartitionManager->m_cells[y * ThePartitionManager->m_cellCountX + x1];	// yes, this could be invalid. we'll skip the bad ones.
-	for (Int x = x1; x <= x2; ++x, ++cell)
-	{
-		if (x < 0 || x >= ThePartitionManager->m_cellCountX)
-			continue;
-		cell->addLooker(playerIndex);
-	}
+	// skip the cells off the map
+	ThePartitionManager->addLookers(playerIndex, y, max(x1, 0), min(x2, ThePartitionManager->m_cellCountX - 1));
 }
 
 // -----------------------------------------------------------------------------
@@ -7294,13 +7239,8 @@ void hLineRemoveLooker(Int x1, Int x2, Int y, void *playerIndexVoid)
 
 	Int playerIndex = (Int)(playerIndexVoid);
 
-	PartitionCell* cell = &ThePartitionManager->m_cells[y * ThePartitionManager->m_cellCountX + x1];	// yes, this could be invalid. we'll skip the bad ones.
-	for (Int x = x1; x <= x2; ++x, ++cell)
-	{
-		if (x < 0 || x >= ThePartitionManager->m_cellCountX)
-			continue;
-		cell->removeLooker(playerIndex);
-	}
+	// skip the cells off the map
+	ThePartitionManager->removeLookers(playerIndex, y, max(x1, 0), min(x2, ThePartitionManager->m_cellCountX - 1));
 }
 
 // -----------------------------------------------------------------------------
@@ -7311,13 +7251,8 @@ void hLineAddShrouder(Int x1, Int x2, Int y, void *playerIndexVoid)
 
 	Int playerIndex = (Int)(playerIndexVoid);
 
-	PartitionCell* cell = &ThePartitionManager->m_cells[y * ThePartitionManager->m_cellCountX + x1];	// yes, this could be invalid. we'll skip the bad ones.
-	for (Int x = x1; x <= x2; ++x, ++cell)
-	{
-		if (x < 0 || x >= ThePartitionManager->m_cellCountX)
-			continue;
-		cell->addShrouder( playerIndex );
-	}
+	// skip the cells off the map
+	ThePartitionManager->addShrouders(playerIndex, y, max(x1, 0), min(x2, ThePartitionManager->m_cellCountX - 1));
 }
 
 // -----------------------------------------------------------------------------
@@ -7328,13 +7263,8 @@ void hLineRemoveShrouder(Int x1, Int x2, Int y, void *playerIndexVoid)
 
 	Int playerIndex = (Int)(playerIndexVoid);
 
-	PartitionCell* cell = &ThePartitionManager->m_cells[y * ThePartitionManager->m_cellCountX + x1];	// yes, this could be invalid. we'll skip the bad ones.
-	for (Int x = x1; x <= x2; ++x, ++cell)
-	{
-		if (x < 0 || x >= ThePartitionManager->m_cellCountX)
-			continue;
-		cell->removeShrouder( playerIndex );
-	}
+	// skip the cells off the map
+	ThePartitionManager->removeShrouders(playerIndex, y, max(x1, 0), min(x2, ThePartitionManager->m_cellCountX - 1));
 }
 
 // -----------------------------------------------------------------------------
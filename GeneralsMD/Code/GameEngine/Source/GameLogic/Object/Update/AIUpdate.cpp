@@ -344,6 +344,9 @@ AIUpdateInterface::AIUpdateInterface( Thing *thing, const ModuleData* moduleData
 	m_turretSyncFlag = TURRET_INVALID;
 	m_attitude = ATTITUDE_NORMAL;
 	m_nextMoodCheckTime = 0;
+#if ENABLE_TARGET_SCAN_BUDGET
+	m_targetScanTicket = 0;
+#endif
 	//m_locoClumpScanFrame = 0;
 #ifdef ALLOW_DEMORALIZE
 	m_demoralizedFramesLeft = 0;
@@ -5236,6 +5239,15 @@ Object* AIUpdateInterface::getNextMoodTarget( Bool calledByAI, Bool calledDuring
 		if (now < m_nextMoodCheckTime)
 			return nullptr;
 
+#if ENABLE_TARGET_SCAN_BUDGET
+		// TheSuperHackers @performance When too many units want to scan in this frame, wait in line and try again next frame.
+		if (!TheAI->requestTargetScan(m_targetScanTicket))
+		{
+			m_nextMoodCheckTime = now + 1;
+			return nullptr;
+		}
+#endif
+
 		Int checkRate = d->m_moodAttackCheckRate;
 		m_nextMoodCheckTime = now + checkRate;
 		if (m_randomlyOffsetMoodCheck)
@@ -5789,12 +5801,17 @@ void AIUpdateInterface::crc( Xfer *x )
 /** Xfer method
 	* Version Info:
 	* 1: Initial version
-	* 5: Added m_forceMoveBackwards (REVERSE_MOVE order) */
+	* 5: Added m_forceMoveBackwards (REVERSE_MOVE order)
+	* 6: TheSuperHackers @tweak Serialize the target scan ticket */
 // ------------------------------------------------------------------------------------------------
 void AIUpdateInterface::xfer( Xfer *xfer )
 {
   // version
+#if ENABLE_TARGET_SCAN_BUDGET
+  const XferVersion currentVersion = 6;
+#else
   const XferVersion currentVersion = 5;
+#endif
   XferVersion version = currentVersion;
   xfer->xferVersion( &version, currentVersion );
 
@@ -6019,6 +6036,10 @@ void AIUpdateInterface::xfer( Xfer *xfer )
 
 	if (version >= 5)
 		xfer->xferBool(&m_forceMoveBackwards);
+#if ENABLE_TARGET_SCAN_BUDGET
+	if (version >= 6)
+		xfer->xferUnsignedInt(&m_targetScanTicket);
+#endif
 
 }
 
@@ -274,10 +274,11 @@ UpdateSleepTime StealthDetectorUpdate::update( void )
 	}
 	Bool foundSomeone = FALSE;
 
-	SimpleObjectIterator *iter = ThePartitionManager->iterateObjectsInRange(
-								self, visionRange, FROM_CENTER_2D, filters);
-	MemoryPoolObjectHolder hold(iter);
-	for (Object *them = iter->first(); them; them = iter->next())
+	// TheSuperHackers @performance Collected in place, without allocating an iterator
+	ObjectQueryResults results;
+	ThePartitionManager->queryObjectsInRange(
+								self, visionRange, FROM_CENTER_2D, results, filters);
+	for (Object *them = results.first(); them; them = results.next())
 	{
 		if ( them->isEffectivelyDead() )
 			continue;
@@ -2637,7 +2637,9 @@ void WeaponTemplate::dealDamageInternal(ObjectID sourceID, ObjectID victimID, co
 		AsciiString railgunCustomDamageType = getRailgunCustomDamageType().isEmpty() ? customDamageType : getRailgunCustomDamageType();
 		AsciiString railgunCustomDeathType = getRailgunCustomDeathType().isEmpty() ? customDeathType : getRailgunCustomDeathType();
 
-		SimpleObjectIterator *iter;
+		// TheSuperHackers @performance The victims are collected in place, without allocating an iterator
+		ObjectQueryResults victims;
+		ObjectQueryResults *iter;
 		Object *curVictim;
 		Real curVictimDistSqr;
 
@@ -2677,7 +2679,8 @@ void WeaponTemplate::dealDamageInternal(ObjectID sourceID, ObjectID victimID, co
 		Real radius = max(primaryRadius, secondaryRadius);
 		if (radius > 0.0f)
 		{
-			iter = ThePartitionManager->iterateObjectsInRange(pos, radius, DAMAGE_RANGE_CALC_TYPE);
+			ThePartitionManager->queryObjectsInRange(pos, radius, DAMAGE_RANGE_CALC_TYPE, victims);
+			iter = &victims;
 			curVictim = iter->firstWithNumeric(&curVictimDistSqr);
 		}
 		else
@@ -2718,8 +2721,6 @@ void WeaponTemplate::dealDamageInternal(ObjectID sourceID, ObjectID victimID, co
 				return;
 			}
 		}
-		MemoryPoolObjectHolder hold(iter);
-
 		for (;; curVictim = iter ? iter->nextWithNumeric(&curVictimDistSqr) : nullptr)
 		{
 			// IamInnocent - Check for Railgun targets within LOS
@@ -2806,7 +2807,8 @@ void WeaponTemplate::dealDamageInternal(ObjectID sourceID, ObjectID victimID, co
 
 					IterOrderType order = railgunAmount > 0 ? ITER_SORTED_NEAR_TO_FAR : ITER_FASTEST;
 
-					iter = ThePartitionManager->iterateObjectsAlongLine(source, &srcPos, &posOther, getRailgunRadius(), getRailgunInfantryRadius(), getRailgunRadiusCheckPerDistance(), getRailgunFX(v), getRailgunOCL(v), DAMAGE_RANGE_CALC_TYPE, RailgunPiercesBehind, nullptr, order);
+					ThePartitionManager->queryObjectsAlongLine(source, &srcPos, &posOther, getRailgunRadius(), getRailgunInfantryRadius(), getRailgunRadiusCheckPerDistance(), getRailgunFX(v), getRailgunOCL(v), DAMAGE_RANGE_CALC_TYPE, victims, RailgunPiercesBehind, nullptr, order);
+					iter = &victims;
 					curVictim = iter->firstWithNumeric(&curVictimDistSqr);
 
 					// If nothing to check, do nothing and return
@@ -4538,9 +4540,9 @@ Bool Weapon::isWithinAttackRange(const Object *source, const Object *target) con
 		{
 			//We're close enough to fire off ranged weapons -- but in the case of contact weapons
 			//we want to do a more detailed check to see if we're actually colliding with the target.
-			ObjectIterator *iter = ThePartitionManager->iteratePotentialCollisions( source->getPosition(), source->getGeometryInfo(), 0.0f );
-			MemoryPoolObjectHolder hold( iter );
-			for( Object *them = iter->first(); them; them = iter->next() )
+			ObjectQueryResults collisions;
+			ThePartitionManager->queryPotentialCollisions( source->getPosition(), source->getGeometryInfo(), 0.0f, collisions );
+			for( Object *them = collisions.first(); them; them = collisions.next() )
 			{
 				if( target == them )
 				{
@@ -0,0 +1,339 @@
+/*
+**	Command & Conquer Generals Zero Hour(tm)
+**	Copyright 2026 TheSuperHackers
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// FILE: DesyncBisect.cpp /////////////////////////////////////////////////////////////////////////
+// Desc:   Writes the CRC of every object and every module at each logic CRC frame
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "PreRTS.h"	// This must go first in EVERY cpp file in the GameEngine
+
+#include "GameLogic/DesyncBisect.h"
+
+#include "Common/NameKeyGenerator.h"
+#include "Common/PlayerList.h"
+#include "Common/RandomValue.h"
+#include "Common/ThingTemplate.h"
+#include "Common/XferCRC.h"
+#include "Common/XferSave.h"
+#include "GameLogic/AI.h"
+#include "GameLogic/GameLogic.h"
+#include "GameLogic/Module/BehaviorModule.h"
+#include "GameLogic/Object.h"
+#include "GameLogic/PartitionManager.h"
+
+using namespace DesyncBisect;
+
+// PRIVATE TYPES //////////////////////////////////////////////////////////////////////////////////
+
+//-------------------------------------------------------------------------------------------------
+/** Runs the save game xfer of a snapshot, but only folds the data into a CRC. Modules do not
+	* implement the light CRC, so this is what tells them apart. */
+//-------------------------------------------------------------------------------------------------
+class XferSaveCRC : public XferSave
+{
+public:
+
+	virtual void open( AsciiString identifier ) { Xfer::open(identifier); m_crc.open(identifier); }
+	virtual void close( void ) { }
+	virtual Int beginBlock( void ) { return 0; }
+	virtual void endBlock( void ) { }
+	virtual void skip( Int dataSize ) { }
+
+	UnsignedInt getCRC( void ) { return m_crc.getCRC(); }
+
+protected:
+
+	virtual void xferImplementation( void *data, Int dataSize ) { m_crc.xferUser(data, dataSize); }
+
+	XferCRC m_crc;
+};
+
+//-------------------------------------------------------------------------------------------------
+static UnsignedInt lightCRC( Snapshot *snapshot )
+{
+	XferFastCRC xfer;
+	xfer.open(AsciiString::TheEmptyString);
+	xfer.xferSnapshot(snapshot);
+	xfer.close();
+	return xfer.getCRC();
+}
+
+//-------------------------------------------------------------------------------------------------
+static UnsignedInt saveCRC( Snapshot *snapshot )
+{
+	XferSaveCRC xfer;
+	xfer.open(AsciiString::TheEmptyString);
+	xfer.xferSnapshot(snapshot);
+	xfer.close();
+	return xfer.getCRC();
+}
+
+//-------------------------------------------------------------------------------------------------
+static Bool entriesEqual( const std::vector<Entry>& a, const std::vector<Entry>& b )
+{
+	if (a.size() != b.size())
+		return FALSE;
+
+	for (size_t i = 0; i < a.size(); ++i)
+	{
+		if (a[i].name != b[i].name || a[i].crc != b[i].crc)
+			return FALSE;
+	}
+	return TRUE;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// PUBLIC METHODS /////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+//-------------------------------------------------------------------------------------------------
+DesyncBisectWriter::DesyncBisectWriter()
+{
+	m_file = nullptr;
+	m_frameObjectCount = 0;
+}
+
+//-------------------------------------------------------------------------------------------------
+DesyncBisectWriter::~DesyncBisectWriter()
+{
+	close();
+}
+
+//-------------------------------------------------------------------------------------------------
+Bool DesyncBisectWriter::open( const AsciiString& filename )
+{
+	close();
+
+	m_file = fopen(filename.str(), "wb");
+	if (m_file == nullptr)
+	{
+		DEBUG_LOG(("DesyncBisectWriter::open - Unable to open '%s'", filename.str()));
+		return FALSE;
+	}
+
+	FileHeader header;
+	header.magic = FILE_MAGIC;
+	header.version = FILE_VERSION;
+	write(&header, sizeof(header));
+
+	return TRUE;
+}
+
+//-------------------------------------------------------------------------------------------------
+void DesyncBisectWriter::close()
+{
+	if (m_file == nullptr)
+		return;
+
+	IndexTrailer trailer;
+	trailer.indexOffset = (UnsignedInt)ftell(m_file);
+	trailer.magic = FILE_MAGIC;
+
+	writeRecordHeader(RECORD_INDEX, (UnsignedInt)(m_index.size() * sizeof(IndexEntry)));
+	if (!m_index.empty())
+		write(&m_index[0], m_index.size() * sizeof(IndexEntry));
+	write(&trailer, sizeof(trailer));
+
+	fclose(m_file);
+	m_file = nullptr;
+
+	m_strings.clear();
+	m_objects.clear();
+	m_index.clear();
+}
+
+//-------------------------------------------------------------------------------------------------
+/** Writes a frame record with every object whose CRCs changed since the previous frame record,
+	* and every object that was removed since then. Frames up to the last written one are skipped,
+	* because a replay seek back to a snapshot plays them again. */
+//-------------------------------------------------------------------------------------------------
+void DesyncBisectWriter::recordFrame( UnsignedInt frame, UnsignedInt logicCRC )
+{
+	if (m_file == nullptr)
+		return;
+
+	if (!m_index.empty() && frame <= m_index.back().frame)
+		return;
+
+	m_frameData.clear();
+	m_frameObjectCount = 0;
+
+	EntryList entries;
+
+	collectGlobalEntries(entries);
+	addObject((ObjectID)GLOBAL_OBJECT_ID, getString("Global"), entries, frame);
+
+	for (Object *obj = TheGameLogic->getFirstObject(); obj; obj = obj->getNextObject())
+	{
+		collectObjectEntries(obj, entries);
+		addObject(obj->getID(), getString(obj->getTemplate()->getName()), entries, frame);
+	}
+
+	// everything that was not seen this frame is gone
+	for (ObjectRecordMap::iterator it = m_objects.begin(); it != m_objects.end(); )
+	{
+		if (it->second.seenFrame == frame)
+		{
+			++it;
+			continue;
+		}
+
+		ObjectHeader header;
+		header.objectID = (UnsignedInt)it->first;
+		header.templateName = it->second.templateName;
+		header.entryCount = OBJECT_REMOVED;
+		const UnsignedByte *bytes = reinterpret_cast<const UnsignedByte *>(&header);
+		m_frameData.insert(m_frameData.end(), bytes, bytes + sizeof(header));
+		++m_frameObjectCount;
+
+		m_objects.erase(it++);
+	}
+
+	IndexEntry indexEntry;
+	indexEntry.frame = frame;
+	indexEntry.logicCRC = logicCRC;
+	indexEntry.offset = (UnsignedInt)ftell(m_file);
+	m_index.push_back(indexEntry);
+
+	FrameHeader frameHeader;
+	frameHeader.frame = frame;
+	frameHeader.logicCRC = logicCRC;
+	frameHeader.objectCount = m_frameObjectCount;
+
+	writeRecordHeader(RECORD_FRAME, (UnsignedInt)(sizeof(frameHeader) + m_frameData.size()));
+	write(&frameHeader, sizeof(frameHeader));
+	if (!m_frameData.empty())
+		write(&m_frameData[0], m_frameData.size());
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// PRIVATE METHODS ////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+//-------------------------------------------------------------------------------------------------
+UnsignedInt DesyncBisectWriter::getString( const AsciiString& str )
+{
+	StringMap::const_iterator it = m_strings.find(str);
+	if (it != m_strings.end())
+		return it->second;
+
+	const UnsignedInt index = (UnsignedInt)m_strings.size();
+	m_strings[str] = index;
+
+	writeRecordHeader(RECORD_STRING, (UnsignedInt)str.getLength());
+	write(str.str(), str.getLength());
+
+	return index;
+}
+
+//-------------------------------------------------------------------------------------------------
+/** The first entry is the light CRC that goes into the logic CRC. Then one entry per module with
+	* the CRC of its save data, named by module tag and module class. */
+//-------------------------------------------------------------------------------------------------
+void DesyncBisectWriter::collectObjectEntries( Object *obj, EntryList& entries )
+{
+	entries.clear();
+
+	Entry entry;
+	entry.name = getString("Object");
+	entry.crc = lightCRC(obj);
+	entries.push_back(entry);
+
+	AsciiString name;
+	for (BehaviorModule **m = obj->getBehaviorModules(); *m; ++m)
+	{
+		name = TheNameKeyGenerator->keyToName((*m)->getModuleTagNameKey());
+		name.concat(' ');
+		name.concat(TheNameKeyGenerator->keyToName((*m)->getModuleNameKey()));
+
+		entry.name = getString(name);
+		entry.crc = saveCRC(*m);
+		entries.push_back(entry);
+	}
+}
+
+//-------------------------------------------------------------------------------------------------
+/** The parts of the logic CRC that do not belong to an object */
+//-------------------------------------------------------------------------------------------------
+void DesyncBisectWriter::collectGlobalEntries( EntryList& entries )
+{
+	entries.clear();
+
+	Entry entry;
+
+	entry.name = getString("RandomSeed");
+	entry.crc = GetGameLogicRandomSeedCRC();
+	entries.push_back(entry);
+
+	entry.name = getString("ThePartitionManager");
+	entry.crc = lightCRC(ThePartitionManager);
+	entries.push_back(entry);
+
+	entry.name = getString("ThePlayerList");
+	entry.crc = lightCRC(ThePlayerList);
+	entries.push_back(entry);
+
+	entry.name = getString("TheAI");
+	entry.crc = lightCRC(TheAI);
+	entries.push_back(entry);
+}
+
+//-------------------------------------------------------------------------------------------------
+void DesyncBisectWriter::addObject( ObjectID id, UnsignedInt templateName, const EntryList& entries, UnsignedInt frame )
+{
+	ObjectRecordMap::iterator it = m_objects.find(id);
+	if (it != m_objects.end() && it->second.templateName == templateName && entriesEqual(it->second.entries, entries))
+	{
+		it->second.seenFrame = frame;
+		return;
+	}
+
+	ObjectRecord& record = m_objects[id];
+	record.templateName = templateName;
+	record.entries = entries;
+	record.seenFrame = frame;
+
+	ObjectHeader header;
+	header.objectID = (UnsignedInt)id;
+	header.templateName = templateName;
+	header.entryCount = (UnsignedInt)entries.size();
+
+	const UnsignedByte *bytes = reinterpret_cast<const UnsignedByte *>(&header);
+	m_frameData.insert(m_frameData.end(), bytes, bytes + sizeof(header));
+	bytes = reinterpret_cast<const UnsignedByte *>(&entries[0]);
+	m_frameData.insert(m_frameData.end(), bytes, bytes + entries.size() * sizeof(Entry));
+	++m_frameObjectCount;
+}
+
+//-------------------------------------------------------------------------------------------------
+void DesyncBisectWriter::writeRecordHeader( UnsignedInt type, UnsignedInt size )
+{
+	RecordHeader header;
+	header.type = type;
+	header.size = size;
+	write(&header, sizeof(header));
+}
+
+//-------------------------------------------------------------------------------------------------
+void DesyncBisectWriter::write( const void *data, size_t size )
+{
+	if (size > 0 && fwrite(data, size, 1, m_file) != 1)
+	{
+		DEBUG_CRASH(("DesyncBisectWriter::write - Error writing %d bytes", (Int)size));
+	}
+}
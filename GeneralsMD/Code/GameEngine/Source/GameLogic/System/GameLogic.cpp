@@ -45,6 +45,7 @@
 #include "Common/MultiplayerSettings.h"
 #include "Common/OSDisplay.h"
 #include "Common/PerfTimer.h"
+#include "Common/PerfTrace.h"
 #include "Common/Player.h"
 #include "Common/PlayerList.h"
 #include "Common/PlayerTemplate.h"
@@ -84,6 +85,7 @@
 #include "GameLogic/AIPathfind.h"
 #include "GameLogic/CaveSystem.h"
 #include "GameLogic/CrateSystem.h"
+#include "GameLogic/DesyncBisect.h"
 #include "GameLogic/FPUControl.h"
 #include "GameLogic/GameLogic.h"
 #include "GameLogic/Locomotor.h"
@@ -222,6 +224,7 @@ GameLogic::GameLogic( void )
 {
 	m_background = nullptr;
 	m_CRC = 0;
+	m_desyncBisect = nullptr;
 	m_isInUpdate = FALSE;
 
 	m_rankPointsToAddAtGameStart = 0;
@@ -321,6 +324,9 @@ GameLogic::~GameLogic()
 		m_background = nullptr;
 	}
 
+	delete m_desyncBisect;
+	m_desyncBisect = nullptr;
+
 	// destroy all remaining objects
 	destroyAllObjectsImmediate();
 
@@ -412,6 +418,13 @@ void GameLogic::reset( void )
 
 	setFPMode();
 
+	// finish the desync bisect file of the previous game, but keep writing it when a replay seek restores a snapshot
+	if (TheRecorder == nullptr || !TheRecorder->isRestoringSnapshot())
+	{
+		delete m_desyncBisect;
+		m_desyncBisect = nullptr;
+	}
+
 	// destroy all objects
 	destroyAllObjectsImmediate();
 
@@ -3710,6 +3723,8 @@ extern __int64 Total_Load_3D_Assets;
 // ------------------------------------------------------------------------------------------------
 void GameLogic::update( void )
 {
+	// TheSuperHackers @feature Frame markers and update phases for the PerfTrace timeline
+	PERF_TRACE_FRAME(m_frame)
 	USE_PERF_TIMER(GameLogic_update)
 
 	LatchRestore<Bool> inUpdateLatch(m_isInUpdate, TRUE);
@@ -3759,12 +3774,14 @@ void GameLogic::update( void )
 
 	// update (execute) scripts
 	{
+		PERF_TRACE_SCOPE(GameLogic_scripts)
 		TheScriptEngine->UPDATE();
 	}
 
 	// Note - TerrainLogic update needs to happen after ScriptEngine update, but before object updates.  jba.
 	// This way changes in bridges are noted in the script engine before being cleared in TerrainLogic->update
 	{
+		PERF_TRACE_SCOPE(GameLogic_terrain)
 		TheTerrainLogic->UPDATE();
 	}
 
@@ -3782,9 +3799,23 @@ void GameLogic::update( void )
 
 	if (generateForSolo || generateForMP)
 	{
-		m_CRC = getCRC( CRC_RECALC );
+		{
+			PERF_TRACE_SCOPE(GameLogic_crc)
+			m_CRC = getCRC( CRC_RECALC );
+		}
 		bool isPlayback = (TheRecorder && TheRecorder->isPlaybackMode());
 
+		// TheSuperHackers @feature Record the CRC of every object and module, to find where two runs of a replay diverge
+		if (isPlayback && !TheGlobalData->m_desyncBisectFile.isEmpty())
+		{
+			if (m_desyncBisect == nullptr)
+			{
+				m_desyncBisect = NEW DesyncBisectWriter;
+				m_desyncBisect->open(TheGlobalData->m_desyncBisectFile);
+			}
+			m_desyncBisect->recordFrame(m_frame, m_CRC);
+		}
+
 		GameMessage *msg = newInstance(GameMessage)(GameMessage::MSG_LOGIC_CRC);
 		msg->appendIntegerArgument(m_CRC);
 		msg->appendBooleanArgument(isPlayback);
@@ -3808,11 +3839,13 @@ void GameLogic::update( void )
 
 	// Update the Recorder
 	{
+		PERF_TRACE_SCOPE(GameLogic_recorder)
 		TheRecorder->UPDATE();
 	}
 
 	// process client commands
 	{
+		PERF_TRACE_SCOPE(GameLogic_commands)
 		processCommandList( TheCommandList );
 	}
 
@@ -3827,6 +3860,7 @@ void GameLogic::update( void )
 				USE_PERF_TIMER(GameLogic_update_normal)
 
 				m_curUpdateModule = u;
+				u->friend_getObject()->markCRCDirty();
 
 				#ifdef DEBUG_LOGGING
 					UpdateSleepTime sleep = u->update();
@@ -3842,6 +3876,7 @@ void GameLogic::update( void )
 #endif
 
 	{
+		PERF_TRACE_SCOPE(GameLogic_sleepyUpdates)
 		while (!m_sleepyUpdates.empty())
 		{
 			UpdateModulePtr u = peekSleepyUpdate();
@@ -3868,6 +3903,7 @@ void GameLogic::update( void )
 
 				//DEBUG_LOG(("calling update %08lx (%d %d)...",update,update->friend_getNextCallFrame(),update->friend_getNextCallPhase()));
 				m_curUpdateModule = u;
+				u->friend_getObject()->markCRCDirty();
 
 				sleepLen = u->update();
 				DEBUG_ASSERTCRASH(sleepLen > 0, ("you may not return 0 from update"));
@@ -3888,16 +3924,19 @@ void GameLogic::update( void )
 
 	// update the Artificial Intelligence system
 	{
+		PERF_TRACE_SCOPE(GameLogic_ai)
 		TheAI->UPDATE();
 	}
 
 	// production updates
 	{
+		PERF_TRACE_SCOPE(GameLogic_buildAssistant)
 		TheBuildAssistant->UPDATE();
 	}
 
 	// update partition info
 	{
+		PERF_TRACE_SCOPE(GameLogic_partition)
 		ThePartitionManager->UPDATE();
 	}
 
@@ -3906,7 +3945,10 @@ void GameLogic::update( void )
 	//
 
 	// destroy all pending objects
-	processDestroyList();
+	{
+		PERF_TRACE_SCOPE(GameLogic_destroyList)
+		processDestroyList();
+	}
 
 	// reset the command list, destroying all messages
 	TheCommandList->reset();
@@ -4174,7 +4216,7 @@ UnsignedInt GameLogic::getCRC( Int mode, AsciiString deepCRCFileName )
 		else
 #endif // DEBUG_CRC
 		{
-			xferCRC = NEW XferCRC;
+			xferCRC = NEW XferFastCRC;
 			crcName = "lightCRC";
 		}
 		xferCRC->open(crcName);
@@ -4192,6 +4234,13 @@ UnsignedInt GameLogic::getCRC( Int mode, AsciiString deepCRCFileName )
 	xferCRC->xferAsciiString(&marker);
 	for( obj = m_objList; obj; obj=obj->getNextObject() )
 	{
+#if ENABLE_INCREMENTAL_CRC
+		if (xferCRC->getXferMode() == XFER_CRC)
+		{
+			obj->xferIncrementalCRC( xferCRC );
+			continue;
+		}
+#endif
 		xferCRC->xferSnapshot( obj );
 	}
 	UnsignedInt seed = GetGameLogicRandomSeedCRC();
@@ -46,7 +46,9 @@
 
 #include "assetmgr.h"
 #include "Lib/BaseType.h"
+#include <vector>
 
+class AsciiString;
 class Vector3;
 class VertexMaterialClass;
 
@@ -60,6 +62,7 @@ public:
 	// unique to W3DAssetManager
 	virtual HAnimClass *	Get_HAnim(const char * name);
 	virtual bool Load_3D_Assets( const char * filename ); // This CANNOT be Bool, as it will not inherit properly if you make Bool == Int
+	void Load_3D_Assets( const AsciiString * filenames, Int count );	///< Like calling Load_3D_Assets for each file, but parses what it can on the worker threads
 
 	virtual TextureClass *	Get_Texture
 	(
@@ -83,6 +86,14 @@ public:
 	int replacePrototypeTexture(RenderObjClass *robj, const char * oldname, const char * newname);
 
 private:
+	struct PreloadChunk;
+	struct PreloadFile;
+
+	bool Load_3D_Assets( const char * filename, const PreloadFile * preloadFile );
+	bool Load_Preloaded_3D_Assets( const PreloadFile & preloadFile );
+	void Read_Preload_File( PreloadFile & preloadFile, std::vector<PreloadChunk> & preloadChunks );
+	static void Parse_Preload_Chunk( void *userData, Int index );
+
 	void Make_Mesh_Unique(RenderObjClass *robj,Bool geometry, Bool colors);
 	void Make_HLOD_Unique(RenderObjClass *robj,Bool geometry, Bool colors);
 	void Make_Unique(RenderObjClass *robj,Bool geometry, Bool colors);
@@ -33,6 +33,7 @@
 
 #pragma once
 
+#include "Common/STLTypedefs.h"
 #include "GameClient/Display.h"
 #include "WW3D2/lightenvironment.h"
 
@@ -137,6 +138,8 @@ public:
 #endif
 	virtual void preloadModelAssets( AsciiString model );			///< preload model asset
 	virtual void preloadTextureAssets( AsciiString texture );	///< preload texture asset
+	virtual void beginPreloadModelAssets();
+	virtual void endPreloadModelAssets();
 
 	/// @todo Need a scene abstraction
 	static RTS3DScene *m_3DScene;							///< our 3d scene representation
@@ -199,4 +202,7 @@ protected:
 
 	W3DDebugDisplay *m_nativeDebugDisplay;		///< W3D specific debug display interface
 
+	Bool m_holdPreloadModelAssets;						///< TRUE between beginPreloadModelAssets and endPreloadModelAssets
+	std::vector<AsciiString> m_heldPreloadModelAssets;	///< file names of the held back models, in call order
+
 };
@@ -404,6 +404,8 @@ W3DDisplay::W3DDisplay()
 	for (i = 0; i < DisplayStringCount; i++)
 		m_displayStrings[i] = nullptr;
 
+	m_holdPreloadModelAssets = FALSE;
+
 }
 
 // W3DDisplay::~W3DDisplay ====================================================
@@ -3233,12 +3235,36 @@ void W3DDisplay::preloadModelAssets( AsciiString model )
 		AsciiString nameWithExtension;
 
 		nameWithExtension.format( "%s.w3d", model.str() );
-		m_assetManager->Load_3D_Assets( nameWithExtension.str() );
+
+		if( m_holdPreloadModelAssets )
+			m_heldPreloadModelAssets.push_back( nameWithExtension );
+		else
+			m_assetManager->Load_3D_Assets( nameWithExtension.str() );
 
 	}
 
 }
 
+//-------------------------------------------------------------------------------------------------
+/** Hold back the models of preloadModelAssets, so that endPreloadModelAssets can hand them to
+	* the asset manager at once and it can parse them on the worker threads. */
+//-------------------------------------------------------------------------------------------------
+void W3DDisplay::beginPreloadModelAssets()
+{
+	m_holdPreloadModelAssets = TRUE;
+}
+
+//-------------------------------------------------------------------------------------------------
+void W3DDisplay::endPreloadModelAssets()
+{
+	m_holdPreloadModelAssets = FALSE;
+
+	if( m_assetManager && !m_heldPreloadModelAssets.empty() )
+		m_assetManager->Load_3D_Assets( &m_heldPreloadModelAssets[0], (Int)m_heldPreloadModelAssets.size() );
+
+	m_heldPreloadModelAssets.clear();
+}
+
 //-------------------------------------------------------------------------------------------------
 /** Preload using the W3D asset manager the texture referenced by the string parameter */
 //-------------------------------------------------------------------------------------------------
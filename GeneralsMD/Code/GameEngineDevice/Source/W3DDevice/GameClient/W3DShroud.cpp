@@ -80,6 +80,7 @@ W3DShroud::W3DShroud(void)
 	m_dstTextureHeight=m_numMaxVisibleCellsY=0;
 	m_boderShroudLevel = (W3DShroudLevel)TheGlobalData->m_shroudAlpha;	//assume border is black
 	m_clearDstTexture = TRUE;	//force clearing of destination texture;
+	m_dirtyRect.left = m_dirtyRect.top = m_dirtyRect.right = m_dirtyRect.bottom = 0;
 
 	m_cellWidth=DEFAULT_SHROUD_CELL_SIZE;
 	m_cellHeight=DEFAULT_SHROUD_CELL_SIZE;
@@ -178,6 +179,7 @@ void W3DShroud::init(WorldHeightMap *pMap, Real worldCellSizeX, Real worldCellSi
 
 	//clear entire texture to black
 	memset(m_srcTextureData,0,m_srcTexturePitch*srcHeight);
+	setAllDirty();
 
 #if defined(RTS_DEBUG)
 	if (TheGlobalData && TheGlobalData->m_fogOfWarOn)
@@ -343,10 +345,34 @@ void W3DShroud::setShroudLevel(Int x, Int y, W3DShroudLevel level, Bool textureO
 
 			*texel = ( ((bluepixel&0xf8) >> 3) | ((greenpixel&0xfc)<<3) | ((redpixel&0xf8)<<8));
 		}
+
+		if (m_dirtyRect.left >= m_dirtyRect.right)
+		{
+			m_dirtyRect.left = x;
+			m_dirtyRect.top = y;
+			m_dirtyRect.right = x + 1;
+			m_dirtyRect.bottom = y + 1;
+		}
+		else
+		{
+			m_dirtyRect.left = __min(m_dirtyRect.left, (LONG)x);
+			m_dirtyRect.top = __min(m_dirtyRect.top, (LONG)y);
+			m_dirtyRect.right = __max(m_dirtyRect.right, (LONG)(x + 1));
+			m_dirtyRect.bottom = __max(m_dirtyRect.bottom, (LONG)(y + 1));
+		}
 		return;
 	}
 }
 
+//-----------------------------------------------------------------------------
+void W3DShroud::setAllDirty(void)
+{
+	m_dirtyRect.left = 0;
+	m_dirtyRect.top = 0;
+	m_dirtyRect.right = m_numCellsX;
+	m_dirtyRect.bottom = m_numCellsY;
+}
+
 //-----------------------------------------------------------------------------
 ///Quickly sets the shroud level of entire map to a single value
 void W3DShroud::fillShroudData(W3DShroudLevel level)
@@ -399,6 +425,7 @@ void W3DShroud::fillShroudData(W3DShroudLevel level)
 			ptr[x]=pixel;
 		ptr	+= pitch;
 	}
+	setAllDirty();
 
 #ifdef DO_FOG_INTERPOLATION
 	//Set the final shroud state.  May differe from current state because of time interpolation.
@@ -708,7 +735,19 @@ void W3DShroud::render(CameraClass *cam)
 
 		fillBorderShroudData(m_boderShroudLevel, pDestSurface);
 	}
+	else
+	{
+		// TheSuperHackers @performance Only copy the cells that changed since the last copy. The video memory
+		// texture keeps the others. After it was cleared above, all cells are copied.
+		dstPoint.x += __max(m_dirtyRect.left, srcRect.left) - srcRect.left;
+		dstPoint.y += __max(m_dirtyRect.top, srcRect.top) - srcRect.top;
+		srcRect.left = __max(m_dirtyRect.left, srcRect.left);
+		srcRect.top = __max(m_dirtyRect.top, srcRect.top);
+		srcRect.right = __min(m_dirtyRect.right, srcRect.right);
+		srcRect.bottom = __min(m_dirtyRect.bottom, srcRect.bottom);
+	}
 
+	if (srcRect.left < srcRect.right && srcRect.top < srcRect.bottom)
 	{
 		//USE_PERF_TIMER(shroudCopy)
 		DX8Wrapper::_Copy_DX8_Rects(
@@ -719,6 +758,8 @@ void W3DShroud::render(CameraClass *cam)
 				&dstPoint);
 	}
 
+	m_dirtyRect.left = m_dirtyRect.right = 0;
+
 	REF_PTR_RELEASE (pDestSurface);
 }
 
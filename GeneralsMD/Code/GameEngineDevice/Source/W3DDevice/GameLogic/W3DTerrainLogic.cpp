@@ -33,9 +33,11 @@
 #include "W3DDevice/GameClient/WorldHeightMap.h"
 #include "Common/PerfTimer.h"
 #include "Common/MapReaderWriterInfo.h"
+#include "Common/GameState.h"
 #include "Common/GlobalData.h"
 #include "Common/Xfer.h"
 #include "GameClient/GameClient.h"
+#include "GameClient/TerrainVisual.h"
 
 #include "GameClient/MapUtil.h"
 #include "GameLogic/AI.h"
@@ -46,7 +48,8 @@
 //-------------------------------------------------------------------------------------------------
 W3DTerrainLogic::W3DTerrainLogic():
 m_mapMinZ(0),
-m_mapMaxZ(1)
+m_mapMaxZ(1),
+m_loadHeightFieldFromVisual(FALSE)
 {
 	m_mapData = nullptr;
 }
@@ -85,6 +88,8 @@ void W3DTerrainLogic::reset( void )
 	m_mapDY = 0;
 	m_mapMinZ = 0;
 	m_mapMaxZ = 1;
+	m_heightField.reset();
+	m_loadHeightFieldFromVisual = FALSE;
 	WorldHeightMap::freeListOfMapObjects();
 }
 
@@ -153,6 +158,11 @@ Bool W3DTerrainLogic::loadMap( AsciiString filename , Bool query )
 		}
 		m_mapMinZ = minHt * MAP_HEIGHT_SCALE;
 		m_mapMaxZ = maxHt * MAP_HEIGHT_SCALE;
+
+		// TheSuperHackers @performance The logic keeps its own copy of the heights, so height queries
+		// neither need the terrain render object nor go through it.
+		m_heightField.init(terrainHeightMap->getDataPtr(), m_mapDX, m_mapDY, terrainHeightMap->getBorderSizeInline());
+
 		//release temporary object used for loading height values
 		REF_PTR_RELEASE(terrainHeightMap);
 	}
@@ -232,7 +242,8 @@ void W3DTerrainLogic::getExtentIncludingBorder( Region3D *extent ) const
 	extent->lo.x = 0.0f;
 	extent->lo.y = 0.0f;
 
-	Real border = TheTerrainRenderObject->getMap()->getBorderSizeInline() * MAP_XY_FACTOR;
+	Int borderSize = m_heightField.isLoaded() ? m_heightField.getBorderSize() : TheTerrainRenderObject->getMap()->getBorderSizeInline();
+	Real border = borderSize * MAP_XY_FACTOR;
 	extent->lo.x -= border;
 	extent->lo.y -= border;
 	extent->hi.x = (m_mapDX * MAP_XY_FACTOR)-border;
@@ -242,7 +253,11 @@ void W3DTerrainLogic::getExtentIncludingBorder( Region3D *extent ) const
 //-------------------------------------------------------------------------------------------------
 Bool W3DTerrainLogic::isClearLineOfSight(const Coord3D& pos, const Coord3D& posOther) const
 {
-	if (TheTerrainRenderObject)
+	if (m_heightField.isLoaded())
+	{
+		return m_heightField.isClearLineOfSight(pos, posOther);
+	}
+	else if (TheTerrainRenderObject)
 	{
 		return TheTerrainRenderObject->isClearLineOfSight(pos, posOther);
 	}
@@ -257,6 +272,11 @@ Bool W3DTerrainLogic::isClearLineOfSight(const Coord3D& pos, const Coord3D& posO
 //-------------------------------------------------------------------------------------------------
 Real W3DTerrainLogic::getGroundHeight( Real x, Real y, Coord3D* normal ) const
 {
+	if (m_heightField.isLoaded())
+	{
+		return m_heightField.getHeight(x, y, normal);
+	}
+
 #define USE_THE_TERRAIN_OBJECT
 #ifdef USE_THE_TERRAIN_OBJECT
 	// TheSuperHackers @logic-client-separation helmutbuhler 11/04/2025
@@ -279,6 +299,20 @@ Real W3DTerrainLogic::getGroundHeight( Real x, Real y, Coord3D* normal ) const
 #endif
 }
 
+//-------------------------------------------------------------------------------------------------
+/** Get the heights of many points without going through the virtual call for each */
+//-------------------------------------------------------------------------------------------------
+void W3DTerrainLogic::getGroundHeights( const Coord2D *points, Real *heights, Int count ) const
+{
+	if (m_heightField.isLoaded())
+	{
+		m_heightField.getHeights(points, heights, count);
+		return;
+	}
+
+	TerrainLogic::getGroundHeights(points, heights, count);
+}
+
 //-------------------------------------------------------------------------------------------------
 /** Get the height considering the layer. */
 //-------------------------------------------------------------------------------------------------
@@ -286,7 +320,16 @@ Real W3DTerrainLogic::getLayerHeight( Real x, Real y, PathfindLayerEnum layer, C
 {
 #ifdef USE_THE_TERRAIN_OBJECT
 
-	if (!TheTerrainRenderObject)
+	Real height;
+	if (m_heightField.isLoaded())
+	{
+		height = m_heightField.getHeight(x, y, normal);
+	}
+	else if (TheTerrainRenderObject)
+	{
+		height = TheTerrainRenderObject->getHeightMapHeight(x,y,normal);
+	}
+	else
 	{
 		if (normal)
 		{
@@ -298,8 +341,6 @@ Real W3DTerrainLogic::getLayerHeight( Real x, Real y, PathfindLayerEnum layer, C
 		return 0;
 	}
 
-	Real height = TheTerrainRenderObject->getHeightMapHeight(x,y,normal);
-
 	if (layer != LAYER_GROUND)
 	{
 		Coord3D loc;
@@ -344,6 +385,29 @@ Bool W3DTerrainLogic::isCliffCell( Real x, Real y) const
 
 }
 
+//-------------------------------------------------------------------------------------------------
+/** Raw height of the logic height map */
+//-------------------------------------------------------------------------------------------------
+Int W3DTerrainLogic::getRawMapHeight( const ICoord2D *gridPos ) const
+{
+	if (m_heightField.isLoaded())
+	{
+		return m_heightField.getRawMapHeight(gridPos);
+	}
+
+	return TerrainLogic::getRawMapHeight(gridPos);
+}
+
+//-------------------------------------------------------------------------------------------------
+/** Lower the logic height map, and the one of the terrain visual with it */
+//-------------------------------------------------------------------------------------------------
+void W3DTerrainLogic::setRawMapHeight( const ICoord2D *gridPos, Int height )
+{
+	m_heightField.setRawMapHeight(gridPos, height);
+
+	TerrainLogic::setRawMapHeight(gridPos, height);
+}
+
 // ------------------------------------------------------------------------------------------------
 /** CRC */
 // ------------------------------------------------------------------------------------------------
@@ -358,19 +422,57 @@ void W3DTerrainLogic::crc( Xfer *xfer )
 // ------------------------------------------------------------------------------------------------
 /** Xfer
 	* Version Info:
-	* 1: Initial version */
+	* 1: Initial version
+	* 2: TheSuperHackers @tweak The heights of the logic height map */
 // ------------------------------------------------------------------------------------------------
 void W3DTerrainLogic::xfer( Xfer *xfer )
 {
 
 	// version
+#if RETAIL_COMPATIBLE_XFER_SAVE
 	XferVersion currentVersion = 1;
+#else
+	XferVersion currentVersion = 2;
+#endif
 	XferVersion version = currentVersion;
 	xfer->xferVersion( &version, currentVersion );
 
 	// extend base class
 	TerrainLogic::xfer( xfer );
 
+	if (version >= 2)
+	{
+		Int xExtent = m_heightField.getXExtent();
+		Int yExtent = m_heightField.getYExtent();
+		xfer->xferInt( &xExtent );
+		xfer->xferInt( &yExtent );
+		if( xExtent != m_heightField.getXExtent() || yExtent != m_heightField.getYExtent() )
+		{
+
+			DEBUG_CRASH(( "W3DTerrainLogic::xfer - height map size mismatch '%dx%d' should be '%dx%d'",
+										xExtent, yExtent, m_heightField.getXExtent(), m_heightField.getYExtent() ));
+			throw SC_INVALID_DATA;
+
+		}
+
+		const Int count = xExtent * yExtent;
+		if (count > 0)
+		{
+			std::vector<UnsignedShort> heights(count);
+			if (xfer->getXferMode() == XFER_SAVE)
+				m_heightField.getRawHeights(&heights[0]);
+
+			xfer->xferUser( &heights[0], count * sizeof(UnsignedShort) );
+
+			if (xfer->getXferMode() == XFER_LOAD)
+				m_heightField.setRawHeights(&heights[0]);
+		}
+	}
+
+	// the terrain visual saved the same heights, and loads them after us
+	if (xfer->getXferMode() == XFER_LOAD)
+		m_loadHeightFieldFromVisual = version < 2;
+
 }
 
 // ------------------------------------------------------------------------------------------------
@@ -382,4 +484,16 @@ void W3DTerrainLogic::loadPostProcess( void )
 	// extend base class
 	TerrainLogic::loadPostProcess();
 
+	if (m_loadHeightFieldFromVisual)
+	{
+		m_loadHeightFieldFromVisual = FALSE;
+
+		WorldHeightMap *logicHeightMap = TheTerrainVisual ? TheTerrainVisual->getLogicHeightMap() : nullptr;
+		if (logicHeightMap && logicHeightMap->getXExtent() == m_heightField.getXExtent()
+			&& logicHeightMap->getYExtent() == m_heightField.getYExtent())
+		{
+			m_heightField.setRawHeights(logicHeightMap->getDataPtr());
+		}
+	}
+
 }